@@ -25,8 +25,13 @@ application_t* foreground_app = NULL;
 void RegisterUserApplication(application_t* app) {
 
     // Assign a scheduler task to the app
-    if (app->process != NULL)
-        app->task = RegisterTask(app->name, app->process);
+    if (app->process != NULL) {
+        uint stack_size = (app->stack_size) ? app->stack_size : TASK_STACK_SIZE;
+        app->task = RegisterTask(app->name, app->process, PRIORITY_NORMAL, stack_size);
+
+        if (app->period)
+            SetTaskPeriod(app->task, app->period);
+    }
 
     installed_apps[app_count++] = app;
 }
@@ -50,12 +55,23 @@ void SetForegroundApp(application_t* app) {
     }
     app->isForeground = true;
     foreground_app = app;
+    RequestRedraw();
 
     //app->task->state = tsRun;
 
     //TODO: Maybe some sort of transition between screens?
 }
 
+void AppInvalidate(application_t* app) {
+    if (app->isForeground)
+        RequestRedraw();
+}
+
+void AppInvalidateAt(application_t* app, systick_t time) {
+    if (app->isForeground)
+        RequestRedrawAt(time);
+}
+
 void AppForegroundEvent(event_type_t type, uint param) {
     if (foreground_app != NULL && foreground_app->event != NULL) {
         foreground_app->event(type, param);
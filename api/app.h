@@ -23,8 +23,11 @@ typedef struct {
 
     proc_t init;
     proc_t process;     // Optional background processing task
+    uint stack_size;    // Optional stack size for the process task (defaults to TASK_STACK_SIZE)
+    uint period;        // Optional release period for the process task, in ms (see WaitNextPeriod)
     proc_t draw;
     event_proc_t event;
+    uint frame_interval; // Optional minimum time between frames, in ms (defaults to DRAW_INTERVAL)
 
     // READ ONLY, SYSTEM USE
     bool isForeground;  // App is currently the foreground process being drawn on the screen
@@ -37,6 +40,13 @@ void RegisterUserApplication(application_t* app);
 // Set the current foreground app
 void SetForegroundApp(application_t* app);
 
+// Ask for the app to be redrawn (ignored unless it is in the foreground).
+// Frames are only drawn on request, so an app that animates calls this each frame.
+void AppInvalidate(application_t* app);
+
+// Ask for the app to be redrawn at a later systick, eg. when the time shown changes
+void AppInvalidateAt(application_t* app, systick_t time);
+
 // Send an event to the current foreground app
 void AppForegroundEvent(event_type_t type, uint param);
 
@@ -61,16 +61,27 @@ event_t* AddTimetableEvent(const char* label, const char* location, dow_t day_of
     return event;
 }
 
-void CalendarAddEvent(event_t* event) {
-    if (num_events < MAX_EVENTS) {
-        event_t* new_event = malloc(sizeof(event_t));
+event_t* CalendarAddEvent(event_t* event) {
+    event_t* new_event = malloc_event();
+
+    if (new_event != NULL)
         memcpy(new_event, event, sizeof(event_t));
+    return new_event;
+}
 
-        events[num_events] = new_event;
-        num_events++;
-    }
+void CalendarClear() {
+    num_events = 0;
 }
 
+uint CalendarGetNumEvents() {
+    return num_events;
+}
+
+event_t* CalendarGetEvent(int index) {
+    if (index < 0 || index >= num_events)
+        return NULL;
+    return events[index];
+}
 
 timestamp_t EventGetTimestamp(timestamp_t ts, event_t* event) {
 
@@ -133,7 +144,7 @@ event_t* CalendarGetNextEvent(timestamp_t ts) {
 
 
 int CalendarDrawEvent(uint8 x, uint8 y, event_t* event, color_t color) {
-    char s[10];
+    char s[12];     // "65535:65535"
     uint w;
 
     // Time
@@ -82,6 +82,15 @@ extern uint num_events;
 // Allocate a new event and store it in the internal calendar
 event_t* AddTimetableEvent(const char* label, const char* location, dow_t day_of_week, uint hr, uint min);
 
+// Copy an event into the internal calendar (NULL if it is full)
+event_t* CalendarAddEvent(event_t* event);
+
+// Remove all events
+void CalendarClear();
+
+uint CalendarGetNumEvents();
+event_t* CalendarGetEvent(int index);
+
 // Calculate the timestamp of the next occurrance of the given event
 timestamp_t EventGetTimestamp(timestamp_t now, event_t* event);
 
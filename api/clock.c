@@ -25,12 +25,16 @@ const int days_in_month[] = {0,31,28,31,30,31,30,31,31,30,31,30,31};
 ////////// Methods /////////////////////////////////////////////////////////////
 
 __inline__ void SetRtcWren() {
+#ifdef POSIX
+    RCFGCALbits.RTCWREN = 1;
+#else
     asm volatile("disi #5");
     asm volatile("mov #0x55, w7");
     asm volatile("mov w7, _NVMKEY");
     asm volatile("mov #0xAA, w8");
     asm volatile("mov w8, _NVMKEY");
     asm volatile("bset _RCFGCAL, #13");
+#endif
 }
 
 __inline__ void ClearRtcWren() {
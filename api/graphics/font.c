@@ -19,33 +19,33 @@
 ////////// Font Definitions ////////////////////////////////////////////////////
 
 // Default Stellaris API font
-#include "fonts\stellaris_font.h"
+#include "fonts/stellaris_font.h"
 
 
 // Small fonts
-#include "fonts\pzim3x5_font.h" // upper-case, plain text, 3px wide
-#include "fonts\5x5_font.h" 		// upper-case, square characters
-//#include "fonts\BMplain_font.h"  // square characters, 'e' and 's' look sharp like 'z'
+#include "fonts/pzim3x5_font.h" // upper-case, plain text, 3px wide
+#include "fonts/5x5_font.h" 		// upper-case, square characters
+//#include "fonts/BMplain_font.h"  // square characters, 'e' and 's' look sharp like 'z'
 
 // Artsy
-//#include "fonts\m38_font.h" 	//very blocky
-//#include "fonts\bubblesstandard_font.h"
-//#include "fonts\haiku_font.h" 	//doesnt look right
-//#include "fonts\Blokus_font.h" 	//broken? freehand style
+//#include "fonts/m38_font.h" 	//very blocky
+//#include "fonts/bubblesstandard_font.h"
+//#include "fonts/haiku_font.h" 	//doesnt look right
+//#include "fonts/Blokus_font.h" 	//broken? freehand style
 
 // Futuristic
-//#include "fonts\SUPERDIG_font.h"
-//#include "fonts\sloth_font.h"
-//#include "fonts\7linedigital_font.h" //7-seg display
-//#include "fonts\Raumsond_font.h" //good small font
+//#include "fonts/SUPERDIG_font.h"
+//#include "fonts/sloth_font.h"
+//#include "fonts/7linedigital_font.h" //7-seg display
+//#include "fonts/Raumsond_font.h" //good small font
 
 // Variable-width
 // NOTE: Variable width characters are not currently implemented. These fonts will have bad kerning
-//#include "fonts\tama_mini02_font.h" // square numbers, plain text
-//#include "fonts\zxpix_font.h" // large print
-//#include "fonts\BMSPA_font.h" // upper-case, very large print
-//#include "fonts\aztech_font.h" // squiggly
-//#include "fonts\formplex12_font.h" // bold, blocky, '0' needs tweaking
+//#include "fonts/tama_mini02_font.h" // square numbers, plain text
+//#include "fonts/zxpix_font.h" // large print
+//#include "fonts/BMSPA_font.h" // upper-case, very large print
+//#include "fonts/aztech_font.h" // squiggly
+//#include "fonts/formplex12_font.h" // bold, blocky, '0' needs tweaking
  
 
 ////////// Font Table //////////////////////////////////////////////////////////
@@ -111,8 +111,21 @@ static int CharWidth(const font_t* font, char c) {
     return width;
 }
 
+// Draw it again in the font it was recorded with (see RecordCommand)
+static void replay_char(const gfx_cmd_t* cmd) {
+    const font_t* font = active_font;
+    unsigned int size = font_size;
+
+    active_font = cmd->ptr;
+    font_size = cmd->u;
+    DrawChar(cmd->v, cmd->x, cmd->y, cmd->color);
+    active_font = font;
+    font_size = size;
+}
+
 int DrawChar(char c, uint8 x, uint8 y, color_t color) {
     uint8 i, j;
+    gfx_cmd_t* cmd;
 
     // active_font->data is a pointer to a multidimensional array of [96][char_width]
     // which is really just a 1D array of size 96*char_width.
@@ -121,24 +134,34 @@ int DrawChar(char c, uint8 x, uint8 y, color_t color) {
 
 	uint8 width = CharWidth(active_font, c);
 
-    // Draw pixels
-    if (font_size == 1) { // For performance, avoid scaling if size==1
-        for (j = 0; j < width; j++) {
-            for (i = 0; i < active_font->char_height; i++) {
+    InvalidateRect(x, y, width * font_size, active_font->char_height * font_size);
 
-                if (chr[j] & (1 << i)) {
-                    SetPixel(x + j, y + i, color);
-                }
-            }
-        }
-    } else {
-        for (j = 0; j < width * font_size; j++) {
-            for (i = 0; i < active_font->char_height * font_size; i++) {
+    if ((cmd = RecordCommand(replay_char, x, y, width * font_size, active_font->char_height * font_size)) != NULL) {
+        cmd->x = x; cmd->y = y;
+        cmd->u = font_size; cmd->v = c;
+        cmd->color = color;
+        cmd->ptr = active_font;
+        return width;
+    }
+
+    // Draw each row as runs of set pixels, scaled by font_size
+    for (i = 0; i < active_font->char_height; i++) {
+        uint8 row_mask = 1 << i;
+        j = 0;
+        while (j < width) {
+            uint8 start, k;
 
-                if (chr[j / font_size] & (1 << (i / font_size))) {
-                    SetPixel(x + j, y + i, color);
-                }
+            if (!(chr[j] & row_mask)) {
+                j++;
+                continue;
             }
+
+            start = j;
+            while (j < width && (chr[j] & row_mask))
+                j++;
+
+            for (k = 0; k < font_size; k++)
+                FillSpan(x + start * font_size, y + i * font_size + k, (j - start) * font_size, color);
         }
     }
 
@@ -11,18 +11,85 @@
 
 ////////// Includes ////////////////////////////////////////////////////////////
 
+#include <string.h>
 #include <system.h>
 #include "gfx.h"
-#include <drivers\ssd1351.h>
+#include <drivers/ssd1351.h>
 
 ////////// Variables ///////////////////////////////////////////////////////////
 
+#ifdef GFX_BANDED
+// Only one band of the screen is buffered at a time, starting at row band_y
+__eds__ pixel_t screen[DISPLAY_WIDTH*BAND_HEIGHT] __attribute__((space(eds),section(".gfx"),eds));
+static uint8 band_y = 0;
+#else
 // Internal screen buffer
-__eds__ color_t screen[DISPLAY_SIZE] __attribute__((space(eds),section(".gfx"),eds));
+__eds__ pixel_t screen[DISPLAY_SIZE] __attribute__((space(eds),section(".gfx"),eds));
 //color_t screen[DISPLAY_SIZE-1];
+#define band_y 0
+#endif
 
 drawop_t global_drawop = SRCCOPY;
 
+// A small set of rectangles covering the changed parts of the screen
+typedef struct {
+    rect_t rects[MAX_DIRTY_RECTS];
+    uint count;
+    uint last;          // Most recently extended rectangle, checked first
+} rect_set_t;
+
+#define FULL_SCREEN {0, 0, DISPLAY_WIDTH-1, DISPLAY_HEIGHT-1}
+
+// Areas that have changed since the last UpdateDisplay()
+static rect_set_t dirty = {{FULL_SCREEN}, 1, 0};
+
+// Areas drawn on since the last clear, everything else is clear_color.
+// The screen starts out unknown, so it all needs clearing the first time.
+static rect_set_t drawn = {{FULL_SCREEN}, 1, 0};
+static color_t clear_color = 0x0000;
+
+// Drawing outside this area is ignored
+static rect_t clip = FULL_SCREEN;
+
+#ifdef GFX_DISPLAY_LIST
+// Drawing calls since the last clear
+static gfx_cmd_t display_list[DISPLAY_LIST_SIZE];
+static uint list_count = 0;
+static gfx_cmd_t unused_cmd;            // Filled in and ignored, for calls that aren't recorded
+static rect_t frame_clip = FULL_SCREEN; // Clip rectangle when the list was started
+static rect_t replay_area;              // Replayed calls only draw in here
+static bool replaying = false;
+#else
+#define replaying false
+#endif
+
+#ifdef GFX_RETAINED
+// The last frame's display list, to find what changed
+typedef struct {
+    uint32 hash;            // Of the whole command
+    rect_t box;
+} cmd_summary_t;
+
+static cmd_summary_t last_frame[DISPLAY_LIST_SIZE];
+static uint last_frame_count = 0;
+
+// Areas to clear and draw again, as something in them has changed.
+// The screen starts out unknown, so it all needs drawing the first time.
+static rect_set_t damage = {{FULL_SCREEN}, 1, 0};
+
+// Changes are found from the display list instead
+#define track_changes false
+#else
+// Replayed calls were tracked when they were recorded
+#define track_changes (!replaying)
+#endif
+
+static gfx_stats_t gfx_stats;
+
+// Merge rectangles if that sends at most this many extra pixels,
+// which is about the cost of setting up another window on the display.
+#define MERGE_SLACK 16
+
 // Custom fonts
 //#include "font.h"
 //extern const font_t* active_font;
@@ -31,7 +98,13 @@ drawop_t global_drawop = SRCCOPY;
 // Uncomment to flip the screen vertically
 //#define FLIP_DISPLAY
 
+#if defined(GFX_BANDED) && defined(FLIP_DISPLAY)
+#error FLIP_DISPLAY is not supported with GFX_BANDED
+#endif
+
+#ifndef POSIX
 #pragma code
+#endif
 
 
 ////////// Utilities ///////////////////////////////////////////////////////////
@@ -43,14 +116,378 @@ int abs(int v) {
 extern int16 sine_table[];
 
 
+////////// Dirty Rectangles ////////////////////////////////////////////////////
+
+static INLINE bool rect_contains(const rect_t* r, uint8 x, uint8 y) {
+    return (x >= r->x1) && (x <= r->x2) && (y >= r->y1) && (y <= r->y2);
+}
+
+static INLINE int32 rect_area(const rect_t* r) {
+    return (int32)(r->x2 - r->x1 + 1) * (int32)(r->y2 - r->y1 + 1);
+}
+
+static void rect_union(rect_t* dest, const rect_t* a, const rect_t* b) {
+    dest->x1 = (a->x1 < b->x1) ? a->x1 : b->x1;
+    dest->y1 = (a->y1 < b->y1) ? a->y1 : b->y1;
+    dest->x2 = (a->x2 > b->x2) ? a->x2 : b->x2;
+    dest->y2 = (a->y2 > b->y2) ? a->y2 : b->y2;
+}
+
+// Number of pixels that merging two rectangles would add (negative if they overlap)
+static int32 merge_cost(const rect_t* a, const rect_t* b) {
+    rect_t u;
+    rect_union(&u, a, b);
+    return rect_area(&u) - rect_area(a) - rect_area(b);
+}
+
+static void rect_set_clear(rect_set_t* set) {
+    // Leave an empty rectangle behind so the SetPixel() fast path fails
+    set->rects[0].x1 = 1; set->rects[0].x2 = 0;
+    set->rects[0].y1 = 1; set->rects[0].y2 = 0;
+    set->count = 0;
+    set->last = 0;
+}
+
+static void rect_set_add(rect_set_t* set, const rect_t* r) {
+    uint i, best = 0;
+    int32 best_cost = 0x7FFFFFFF;
+
+    // Usually already covered by the last rectangle (eg. each span of a primitive)
+    rect_t* last = &set->rects[set->last];
+    if (r->x1 >= last->x1 && r->x2 <= last->x2 && r->y1 >= last->y1 && r->y2 <= last->y2)
+        return;
+
+    for (i=0; i<set->count; i++) {
+        int32 cost = merge_cost(&set->rects[i], r);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = i;
+        }
+    }
+
+    if (set->count < MAX_DIRTY_RECTS && best_cost > MERGE_SLACK) {
+        set->last = set->count++;
+        set->rects[set->last] = *r;
+        return;
+    }
+
+    // Merge with the closest rectangle (or the least bad one if the set is full),
+    // then with any others it now overlaps.
+    rect_union(&set->rects[best], &set->rects[best], r);
+    i = 0;
+    while (i < set->count) {
+        if (i != best && merge_cost(&set->rects[best], &set->rects[i]) <= MERGE_SLACK) {
+            rect_union(&set->rects[best], &set->rects[best], &set->rects[i]);
+            set->rects[i] = set->rects[--set->count];
+            if (best == set->count) best = i;
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+    set->last = best;
+}
+
+// The part of an area inside the clip rectangle. Returns false if there's none.
+static bool clip_rect(rect_t* r, int x, int y, int w, int h) {
+    if (x < clip.x1) { w -= clip.x1 - x; x = clip.x1; }
+    if (y < clip.y1) { h -= clip.y1 - y; y = clip.y1; }
+    if (x + w > clip.x2 + 1) w = clip.x2 + 1 - x;
+    if (y + h > clip.y2 + 1) h = clip.y2 + 1 - y;
+    if (w <= 0 || h <= 0)
+        return false;
+
+    r->x1 = x; r->y1 = y;
+    r->x2 = x + w - 1; r->y2 = y + h - 1;
+    return true;
+}
+
+static INLINE bool rect_empty(const rect_t* r) {
+    return r->x1 > r->x2;
+}
+
+static INLINE bool rect_overlaps(const rect_t* a, const rect_t* b) {
+    return a->x1 <= b->x2 && a->x2 >= b->x1 && a->y1 <= b->y2 && a->y2 >= b->y1;
+}
+
+void InvalidateRect(int x, int y, int w, int h) {
+    rect_t r;
+
+    if (!track_changes)
+        return;
+
+    // Nothing can be drawn outside the clip rectangle
+    if (!clip_rect(&r, x, y, w, h))
+        return;
+
+    rect_set_add(&dirty, &r);
+    rect_set_add(&drawn, &r);
+}
+
+#ifdef GFX_DISPLAY_LIST
+// Also clip to the area being replayed
+static void clip_to_replay_area() {
+    if (clip.x1 < replay_area.x1) clip.x1 = replay_area.x1;
+    if (clip.y1 < replay_area.y1) clip.y1 = replay_area.y1;
+    if (clip.x2 > replay_area.x2) clip.x2 = replay_area.x2;
+    if (clip.y2 > replay_area.y2) clip.y2 = replay_area.y2;
+}
+#endif
+
+static void replay_clip(const gfx_cmd_t* cmd) {
+    SetClipRect(cmd->x, cmd->y, cmd->w, cmd->h);
+}
+
+void SetClipRect(int x, int y, int w, int h) {
+    gfx_cmd_t* cmd;
+
+    // Recorded, but it still applies to the calls being recorded
+    if ((cmd = RecordState(replay_clip)) != NULL) {
+        cmd->x = x; cmd->y = y;
+        cmd->w = w; cmd->h = h;
+    }
+
+    // Limit it to the screen
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > DISPLAY_WIDTH) w = DISPLAY_WIDTH - x;
+    if (y + h > DISPLAY_HEIGHT) h = DISPLAY_HEIGHT - y;
+
+    if (w <= 0 || h <= 0) {
+        // Empty, so everything gets clipped
+        clip.x1 = 1; clip.x2 = 0;
+        clip.y1 = 1; clip.y2 = 0;
+        return;
+    }
+
+    clip.x1 = x; clip.x2 = x + w - 1;
+    clip.y1 = y; clip.y2 = y + h - 1;
+
+#ifdef GFX_DISPLAY_LIST
+    if (replaying)
+        clip_to_replay_area();
+#endif
+}
+
+void ResetClipRect() {
+    SetClipRect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+}
+
+void InvalidateDisplay() {
+    rect_t r = FULL_SCREEN;
+    rect_set_clear(&dirty);
+    rect_set_add(&dirty, &r);
+}
+
+////////// Display List ////////////////////////////////////////////////////////
+
+#ifdef GFX_DISPLAY_LIST
+
+static void clear_rect(const rect_t* r, color_t c);
+
+gfx_cmd_t* RecordCommand(gfx_cmd_fn draw, int x, int y, int w, int h) {
+    gfx_cmd_t* cmd;
+    rect_t box;
+
+    if (replaying)
+        return NULL;
+
+    if (w < 0) {
+        // RecordState(), replayed everywhere
+        box.x1 = 1; box.x2 = 0;
+        box.y1 = 1; box.y2 = 0;
+    } else if (!clip_rect(&box, x, y, w, h)) {
+        // Nothing would be drawn
+        return &unused_cmd;
+    }
+
+    if (list_count >= DISPLAY_LIST_SIZE) {
+        // Lost, as there's nowhere to draw it now either
+        gfx_stats.overflows++;
+        return &unused_cmd;
+    }
+
+    cmd = &display_list[list_count++];
+    if (list_count > gfx_stats.max_commands)
+        gfx_stats.max_commands = list_count;
+    gfx_stats.commands++;
+
+    memset(cmd, 0, sizeof(gfx_cmd_t));  // Unused fields don't change the hash
+    cmd->draw = draw;
+    cmd->drawop = global_drawop;
+    cmd->box = box;
+    return cmd;
+}
+
+// Draw the display list again, only within an area
+static void replay(const rect_t* area) {
+    rect_t saved_clip = clip;
+    drawop_t saved_drawop = global_drawop;
+    uint i;
+
+    replaying = true;
+    replay_area = *area;
+    clip = frame_clip;
+    clip_to_replay_area();
+
+    for (i = 0; i < list_count; i++) {
+        const gfx_cmd_t* cmd = &display_list[i];
+        if (!rect_empty(&cmd->box)) {
+            if (!rect_overlaps(&cmd->box, area))
+                continue;
+            gfx_stats.replayed++;
+        }
+        global_drawop = cmd->drawop;
+        cmd->draw(cmd);
+    }
+
+    replaying = false;
+    clip = saved_clip;
+    global_drawop = saved_drawop;
+}
+
+#endif
+
+#ifdef GFX_BANDED
+// Draw the band of the screen starting at row y
+static void render_band(uint8 y) {
+    rect_t band = {0, y, DISPLAY_WIDTH-1, y + BAND_HEIGHT - 1};
+
+    band_y = y;
+    clear_rect(&band, clear_color);
+    replay(&band);
+    gfx_stats.bands++;
+}
+#endif
+
+#ifdef GFX_RETAINED
+static uint32 hash_command(const gfx_cmd_t* cmd) {
+    const uint16* p = (const uint16*)cmd;
+    uint32 hash = 5381;
+    uint i;
+
+    for (i = 0; i < sizeof(gfx_cmd_t) / sizeof(uint16); i++)
+        hash = (hash << 5) + hash + p[i];
+    return hash;
+}
+
+// Checksum of pixels a command reads from, so it changes if they do
+static uint16 hash_pixels(const __eds__ color_t* p, uint count) {
+    uint16 hash = 0;
+    while (count--)
+        hash = (hash << 1) + (hash >> 15) + *p++;
+    return hash;
+}
+
+// Compare the display list with the last frame's, in order. Anything that
+// changed damages the area it used to cover and the area it covers now.
+static void find_damage() {
+    uint count = (list_count > last_frame_count) ? list_count : last_frame_count;
+    cmd_summary_t cmd;
+    uint i;
+
+    for (i = 0; i < count; i++) {
+        if (i < list_count) {
+            cmd.hash = hash_command(&display_list[i]);
+            cmd.box = display_list[i].box;
+        }
+
+        if (i < list_count && i < last_frame_count && cmd.hash == last_frame[i].hash &&
+                !memcmp(&cmd.box, &last_frame[i].box, sizeof(rect_t)))
+            continue;
+
+        // The clip rectangle is part of each box, so RecordState() calls don't damage anything
+        if (i < last_frame_count && !rect_empty(&last_frame[i].box))
+            rect_set_add(&damage, &last_frame[i].box);
+        if (i < list_count) {
+            if (!rect_empty(&cmd.box))
+                rect_set_add(&damage, &cmd.box);
+            last_frame[i] = cmd;
+        }
+    }
+    last_frame_count = list_count;
+}
+
+// Draw the damaged areas again, and mark them to be sent
+static void repair_damage() {
+    uint i;
+
+    find_damage();
+
+    for (i = 0; i < damage.count; i++) {
+        rect_t* r = &damage.rects[i];
+#ifndef GFX_BANDED
+        clear_rect(r, clear_color);
+        replay(r);
+#endif
+        rect_set_add(&dirty, r);
+    }
+    rect_set_clear(&damage);
+}
+#endif
+
+void GetGfxStats(gfx_stats_t* stats) {
+    *stats = gfx_stats;
+}
+
 ////////// Device Dependant Functions //////////////////////////////////////////
 
 void UpdateDisplay() {
-    ssd1351_UpdateScreen(screen, DISPLAY_SIZE);
+    uint i;
+#ifdef GFX_BANDED
+    uint8 y, last;
+#endif
+
+    gfx_stats.frames++;
+
+#ifdef GFX_RETAINED
+    repair_damage();
+#endif
+
+#ifdef GFX_BANDED
+    // Draw the bands that have changed, then send the changed parts of them
+    for (y = 0; y < DISPLAY_HEIGHT; y += BAND_HEIGHT) {
+        bool rendered = false;
+        last = y + BAND_HEIGHT - 1;
+
+        for (i=0; i<dirty.count; i++) {
+            rect_t* r = &dirty.rects[i];
+            if (r->y2 < y || r->y1 > last)
+                continue;
+            if (!rendered) {
+                render_band(y);
+                rendered = true;
+            }
+            ssd1351_UpdateWindowRows(screen, y, r->x1, (r->y1 > y) ? r->y1 : y, r->x2, (r->y2 < last) ? r->y2 : last);
+        }
+    }
+#else
+    for (i=0; i<dirty.count; i++) {
+        rect_t* r = &dirty.rects[i];
+#ifdef FLIP_DISPLAY
+        ssd1351_UpdateWindow(screen, DISPLAY_WIDTH-1 - r->x2, DISPLAY_HEIGHT-1 - r->y2,
+                DISPLAY_WIDTH-1 - r->x1, DISPLAY_HEIGHT-1 - r->y1);
+#else
+        ssd1351_UpdateWindow(screen, r->x1, r->y1, r->x2, r->y2);
+#endif
+    }
+#endif
+
+    rect_set_clear(&dirty);
 }
 
 void UpdateDisplayWipeIn(int dir) {
+#ifdef GFX_BANDED
+    // The whole screen isn't there to wipe in
+    UpdateDisplay();
+#else
+    gfx_stats.frames++;
+#ifdef GFX_RETAINED
+    repair_damage();
+#endif
     ssd1351_WipeIn(screen, dir);
+    rect_set_clear(&dirty);
+#endif
 }
 
 ////////// Low Level Functions /////////////////////////////////////////////////
@@ -60,8 +497,9 @@ static INLINE uint16 threshold(uint16 color) {
 	return (color > COLOR(0x7F,0x7F,0x7F)) ? 0xFFFF : 0x0000;
 }
 
-static INLINE void DrawOp(drawop_t drawop, __eds__ color_t* destbuf, __eds__ color_t* srcbuf, __eds__ color_t* maskbuf, bool invert) {
-    color_t srccol = (invert) ? ~*srcbuf : *srcbuf;
+// The source is an ordinary colour, and the destination is in the screen buffer's order
+static INLINE void DrawOp(drawop_t drawop, __eds__ pixel_t* destbuf, __eds__ color_t* srcbuf, __eds__ color_t* maskbuf, bool invert) {
+    pixel_t srccol = (invert) ? ~ScreenPixel(*srcbuf) : ScreenPixel(*srcbuf);
 
     switch (drawop) {
 
@@ -75,12 +513,12 @@ static INLINE void DrawOp(drawop_t drawop, __eds__ color_t* destbuf, __eds__ col
         case PATCOPY:		*destbuf |= threshold(*maskbuf); break;
         case PATINVERT:		*destbuf = *destbuf ^ threshold(*maskbuf); break;
         case PATPAINT:		*destbuf = *destbuf | ~srccol | threshold(*maskbuf); break;
-        case SRCAND:		*destbuf = *destbuf & *srcbuf; break;
+        case SRCAND:		*destbuf = *destbuf & ScreenPixel(*srcbuf); break;
         case SRCCOPY:		*destbuf = srccol; break;
         case SRCERASE:		*destbuf = ~*destbuf & srccol; break;
         case SRCINVERT:		*destbuf = *destbuf ^ srccol; break;
         case SRCPAINT:		*destbuf = *destbuf | srccol; break;
-        case WHITENESS:		*destbuf = 0xFFFF; break;
+        case WHITENESS:		*destbuf = (pixel_t)0xFFFF; break;
 
         // Extra Operations
         //case ADD:			*destbuf += *srcbuf; break;
@@ -111,8 +549,8 @@ static INLINE void DrawOp(drawop_t drawop, __eds__ color_t* destbuf, __eds__ col
         case ADD: {
             color_s src, dest;
             uint8 r,g,b;
-            src.val = srccol;
-            dest.val = *destbuf;
+            src.val = ScreenColor(srccol);
+            dest.val = ScreenColor(*destbuf);
 
             r = dest.r + src.r;
             g = dest.g + src.g;
@@ -123,14 +561,14 @@ static INLINE void DrawOp(drawop_t drawop, __eds__ color_t* destbuf, __eds__ col
             if (b > 0x1F) b = 0x1F;
 
             dest.r = r; dest.g = g; dest.b = b;
-            *destbuf = dest.val;
+            *destbuf = ScreenPixel(dest.val);
         } break;
 
         case SUBTRACT: {
             color_s src, dest;
             int8 r,g,b;
-            src.val = srccol;
-            dest.val = *destbuf;
+            src.val = ScreenColor(srccol);
+            dest.val = ScreenColor(*destbuf);
 
             r = dest.r;
             g = dest.g;
@@ -145,42 +583,465 @@ static INLINE void DrawOp(drawop_t drawop, __eds__ color_t* destbuf, __eds__ col
             if (b < 0) b = 0;
 
             dest.r = r; dest.g = g; dest.b = b;
-            *destbuf = dest.val;
+            *destbuf = ScreenPixel(dest.val);
         } break;
 
         // 50% Alpha Blend
         case BLEND: {
             //TODO: Optimise
             color_s src, dest;
-            src.val = srccol;
-            dest.val = *destbuf;
+            src.val = ScreenColor(srccol);
+            dest.val = ScreenColor(*destbuf);
 
             dest.r = dest.r/2 + src.r/2;
             dest.g = dest.g/2 + src.g/2;
             dest.b = dest.b/2 + src.b/2;
 
-            *destbuf = dest.val;
+            *destbuf = ScreenPixel(dest.val);
         } break;
     }
 }
 
-void ClearImage() {
-    int i;
-    for (i = 0; i < DISPLAY_SIZE; i++)
-        screen[i] = 0x00;
+static INLINE uint byte_index(uint8 x, uint8 y) {
+#ifdef FLIP_DISPLAY
+    return (DISPLAY_WIDTH * DISPLAY_HEIGHT) - (x + (y * DISPLAY_WIDTH)) - 1;
+#else
+    return (x + ((y - band_y) * DISPLAY_WIDTH));
+#endif
 }
 
-void ClearImageEx(color_t c) {
-    int i;
-    for (i = 0; i < DISPLAY_SIZE; i++)
-        screen[i] = c;
+////////// Span Functions //////////////////////////////////////////////////////
+
+// Inner loops for runs of pixels, picked once per span based on the drawop.
+// Only the common drawops get their own loop, the rest use DrawOp() per pixel.
+
+typedef void (*fill_kernel_t)(__eds__ pixel_t* dest, uint count, color_t color);
+
+static void fill_copy(__eds__ pixel_t* dest, uint count, color_t color) {
+    pixel_t p = color;
+    while (count--) *dest++ = p;
+}
+static void fill_and(__eds__ pixel_t* dest, uint count, color_t color) {
+    pixel_t p = color;
+    while (count--) *dest++ &= p;
+}
+static void fill_or(__eds__ pixel_t* dest, uint count, color_t color) {
+    pixel_t p = color;
+    while (count--) *dest++ |= p;
+}
+static void fill_xor(__eds__ pixel_t* dest, uint count, color_t color) {
+    pixel_t p = color;
+    while (count--) *dest++ ^= p;
+}
+static void fill_drawop(__eds__ pixel_t* dest, uint count, color_t color) {
+    drawop_t drawop = global_drawop;
+    while (count--) DrawOp(drawop, dest++, &color, &color, false);
 }
 
-static INLINE uint byte_index(uint8 x, uint8 y) {
+// Pick the loop for filling with a colour
+static fill_kernel_t pick_fill(drawop_t drawop) {
+    switch (drawop) {
+        case SRCCOPY:
+        case BLACKNESS:
+        case WHITENESS:
+        case NOTSRCCOPY:    return fill_copy;
+        case SRCAND:        return fill_and;
+        case SRCPAINT:
+        case MERGEPAINT:    return fill_or;
+        case SRCINVERT:     return fill_xor;
+        default:            return fill_drawop;
+    }
+}
+
+// The colour to pass to the loop from pick_fill(), adjusted for the drawop
+// (and converted to the screen buffer's order, for all but fill_drawop)
+static color_t fill_color(drawop_t drawop, color_t color) {
+    switch (drawop) {
+        case SRCCOPY:
+        case SRCAND:
+        case SRCPAINT:
+        case SRCINVERT:     break;
+        case BLACKNESS:     color = 0x0000; break;
+        case WHITENESS:     color = 0xFFFF; break;
+        case NOTSRCCOPY:
+        case MERGEPAINT:    color = ~color; break;
+        default:            return color;
+    }
+    return ScreenPixel(color);
+}
+
+// Row copies from an image. The mask is only used by the MERGECOPY and PAT* drawops.
+typedef void (*copy_kernel_t)(__eds__ pixel_t* dest, const __eds__ color_t* src, const __eds__ color_t* mask,
+        uint count, drawop_t drawop, bool invert);
+
+static void copy_copy(__eds__ pixel_t* dest, const __eds__ color_t* src, const __eds__ color_t* mask,
+        uint count, drawop_t drawop, bool invert) {
+    while (count--) *dest++ = ScreenPixel(*src++);
+}
+static void copy_not(__eds__ pixel_t* dest, const __eds__ color_t* src, const __eds__ color_t* mask,
+        uint count, drawop_t drawop, bool invert) {
+    while (count--) *dest++ = ~ScreenPixel(*src++);
+}
+static void copy_and(__eds__ pixel_t* dest, const __eds__ color_t* src, const __eds__ color_t* mask,
+        uint count, drawop_t drawop, bool invert) {
+    while (count--) *dest++ &= ScreenPixel(*src++);
+}
+static void copy_or(__eds__ pixel_t* dest, const __eds__ color_t* src, const __eds__ color_t* mask,
+        uint count, drawop_t drawop, bool invert) {
+    while (count--) *dest++ |= ScreenPixel(*src++);
+}
+static void copy_xor(__eds__ pixel_t* dest, const __eds__ color_t* src, const __eds__ color_t* mask,
+        uint count, drawop_t drawop, bool invert) {
+    while (count--) *dest++ ^= ScreenPixel(*src++);
+}
+static void copy_merge(__eds__ pixel_t* dest, const __eds__ color_t* src, const __eds__ color_t* mask,
+        uint count, drawop_t drawop, bool invert) {
+    while (count--) {
+        if (threshold(*mask++)) *dest = ScreenPixel(*src);
+        dest++; src++;
+    }
+}
+static void copy_drawop(__eds__ pixel_t* dest, const __eds__ color_t* src, const __eds__ color_t* mask,
+        uint count, drawop_t drawop, bool invert) {
+    while (count--)
+        DrawOp(drawop, dest++, (__eds__ color_t*)src++, (__eds__ color_t*)mask++, invert);
+}
+
+static copy_kernel_t pick_copy(drawop_t drawop, bool invert) {
+    switch (drawop) {
+        case SRCCOPY:       return invert ? copy_not : copy_copy;
+        case NOTSRCCOPY:    return invert ? copy_copy : copy_not;
+        case MERGECOPY:     return invert ? copy_drawop : copy_merge;
+        case SRCAND:        return copy_and;    // Doesn't use invert (see DrawOp)
+        case SRCPAINT:      return invert ? copy_drawop : copy_or;
+        case SRCINVERT:     return invert ? copy_drawop : copy_xor;
+        default:            return copy_drawop;
+    }
+}
+
+// Draw a row of an image that has already been clipped
+static void copy_row(copy_kernel_t copy, uint8 x, uint8 y, const __eds__ color_t* src, const __eds__ color_t* mask,
+        uint w, drawop_t drawop, bool invert) {
 #ifdef FLIP_DISPLAY
-    return (DISPLAY_WIDTH * DISPLAY_HEIGHT) - (x + (y * DISPLAY_WIDTH)) - 1;
+    // Stored right to left, so go a pixel at a time
+    __eds__ pixel_t* dest = &screen[byte_index(x, y)];
+    while (w--)
+        DrawOp(drawop, dest--, (__eds__ color_t*)src++, (__eds__ color_t*)mask++, invert);
+#else
+    copy(&screen[byte_index(x, y)], src, mask, w, drawop, invert);
+#endif
+}
+
+// Clip a span to the clip rectangle and mark it as changed.
+// Returns false if there is nothing left to draw.
+static bool clip_span(int* x, int y, int* w, uint* skip) {
+    rect_t r;
+
+    *skip = 0;
+    if (y < clip.y1 || y > clip.y2)
+        return false;
+    if (*x < clip.x1) {
+        *skip = clip.x1 - *x;
+        *w -= *skip;
+        *x = clip.x1;
+    }
+    if (*x + *w > clip.x2 + 1)
+        *w = clip.x2 + 1 - *x;
+    if (*w <= 0)
+        return false;
+
+    if (!track_changes)
+        return true;
+
+    r.x1 = *x; r.x2 = *x + *w - 1;
+    r.y1 = r.y2 = y;
+    rect_set_add(&dirty, &r);
+    rect_set_add(&drawn, &r);
+    return true;
+}
+
+// Lowest address of a span (a flipped buffer stores it right to left)
+static INLINE __eds__ pixel_t* span_address(uint8 x, uint8 y, uint w) {
+#ifdef FLIP_DISPLAY
+    return &screen[byte_index(x + w - 1, y)];
+#else
+    return &screen[byte_index(x, y)];
+#endif
+}
+
+static void replay_fill(const gfx_cmd_t* cmd) {
+    FillSpan(cmd->x, cmd->y, cmd->w, cmd->color);
+}
+
+void FillSpan(int x, int y, int w, color_t color) {
+    gfx_cmd_t* cmd;
+    fill_kernel_t fill;
+    uint skip;
+
+    if (!clip_span(&x, y, &w, &skip))
+        return;
+
+    if ((cmd = RecordCommand(replay_fill, x, y, w, 1)) != NULL) {
+        cmd->x = x; cmd->y = y; cmd->w = w;
+        cmd->color = color;
+        return;
+    }
+
+    gfx_stats.pixels += w;
+    fill = pick_fill(global_drawop);
+    fill(span_address(x, y, w), w, fill_color(global_drawop, color));
+}
+
+static void replay_copy(const gfx_cmd_t* cmd) {
+    CopySpan(cmd->x, cmd->y, cmd->w, cmd->data);
+}
+
+void CopySpan(int x, int y, int w, const __eds__ color_t* src) {
+    gfx_cmd_t* cmd;
+    uint skip;
+
+    if (!clip_span(&x, y, &w, &skip))
+        return;
+    src += skip;
+
+    if ((cmd = RecordCommand(replay_copy, x, y, w, 1)) != NULL) {
+        cmd->x = x; cmd->y = y; cmd->w = w;
+        cmd->data = src;
+#ifdef GFX_RETAINED
+        cmd->u = hash_pixels(src, w);
+#endif
+        return;
+    }
+
+    gfx_stats.pixels += w;
+
+    copy_row(pick_copy(global_drawop, false), x, y, src, src, w, global_drawop, false);
+}
+
+static void replay_copy_masked(const gfx_cmd_t* cmd) {
+    CopySpanMasked(cmd->x, cmd->y, cmd->w, cmd->data, cmd->data2);
+}
+
+void CopySpanMasked(int x, int y, int w, const __eds__ color_t* src, const __eds__ color_t* mask) {
+    __eds__ pixel_t* dest;
+    drawop_t drawop = global_drawop;
+    gfx_cmd_t* cmd;
+    uint skip;
+
+    if (!clip_span(&x, y, &w, &skip))
+        return;
+    src += skip;
+    mask += skip;
+
+    if ((cmd = RecordCommand(replay_copy_masked, x, y, w, 1)) != NULL) {
+        cmd->x = x; cmd->y = y; cmd->w = w;
+        cmd->data = src;
+        cmd->data2 = mask;
+#ifdef GFX_RETAINED
+        cmd->u = hash_pixels(src, w);
+        cmd->v = hash_pixels(mask, w);
+#endif
+        return;
+    }
+
+    gfx_stats.pixels += w;
+
+    dest = &screen[byte_index(x, y)];
+    while (w--) {
+        if (threshold(*mask)) {
+            if (drawop == SRCCOPY)
+                *dest = ScreenPixel(*src);
+            else
+                DrawOp(drawop, dest, (__eds__ color_t*)src, (__eds__ color_t*)mask, false);
+        }
+#ifdef FLIP_DISPLAY
+        dest--;
+#else
+        dest++;
+#endif
+        src++;
+        mask++;
+    }
+}
+
+static void replay_runs(const gfx_cmd_t* cmd) {
+    DrawRuns(cmd->x, cmd->y, cmd->w, cmd->h, cmd->data);
+}
+
+void DrawRuns(int x, int y, int w, int h, const __eds__ color_t* runs) {
+    copy_kernel_t copy;
+    gfx_cmd_t* cmd;
+    uint16 header;
+    uint len;
+
+    if ((cmd = RecordCommand(replay_runs, x, y, w, h)) != NULL) {
+        InvalidateRect(x, y, w, h);
+        cmd->x = x; cmd->y = y; cmd->w = w; cmd->h = h;
+        cmd->data = runs;
+        return;
+    }
+
+    // Runs that might need clipping go through CopySpan()
+    if (x < clip.x1 || y < clip.y1 || x + w > clip.x2 + 1 || y + h > clip.y2 + 1) {
+        while (h) {
+            header = *runs++;
+            if (header == RUN_END_OF_ROW) {
+                y++;
+                h--;
+                continue;
+            }
+            len = RUN_LENGTH(header);
+            CopySpan(x + RUN_X(header), y, len, runs);
+            runs += len;
+        }
+        return;
+    }
+
+    InvalidateRect(x, y, w, h);
+
+    copy = pick_copy(global_drawop, false);
+    while (h) {
+        header = *runs++;
+        if (header == RUN_END_OF_ROW) {
+            y++;
+            h--;
+            continue;
+        }
+        len = RUN_LENGTH(header);
+        copy_row(copy, x + RUN_X(header), y, runs, runs, len, global_drawop, false);
+        gfx_stats.pixels += len;
+        runs += len;
+    }
+}
+
+static void replay_rle(const gfx_cmd_t* cmd) {
+    DrawImageRLE(cmd->x, cmd->y, cmd->ptr);
+}
+
+void DrawImageRLE(int x, int y, const image_t* image) {
+    const __eds__ uint16* data = image->pixels;
+    drawop_t drawop = global_drawop;
+    __eds__ pixel_t* dest;
+    fill_kernel_t fill;
+    copy_kernel_t copy;
+    gfx_cmd_t* cmd;
+    color_t color;
+    uint16 header;
+    uint count, n;
+    int ix, iy;
+    bool clipped;
+
+#ifdef FLIP_DISPLAY
+    clipped = true;     // The spans take care of the flipped layout
 #else
-    return (x + (y * DISPLAY_WIDTH));
+    clipped = x < clip.x1 || y < clip.y1 || x + image->width > clip.x2 + 1 || y + image->height > clip.y2 + 1;
+#endif
+
+    // Every run is within this, so the clipped spans won't add any more dirty rectangles
+    InvalidateRect(x, y, image->width, image->height);
+
+    if ((cmd = RecordCommand(replay_rle, x, y, image->width, image->height)) != NULL) {
+        cmd->x = x; cmd->y = y;
+        cmd->ptr = image;
+        return;
+    }
+
+    fill = pick_fill(drawop);
+    copy = pick_copy(drawop, false);
+    for (iy = y; iy < y + image->height; iy++) {
+        if (!clipped)
+            dest = &screen[byte_index(0, iy)];
+
+        for (ix = x; ix < x + image->width; ix += count) {
+            header = *data++;
+            count = header & RLE_COUNT;
+
+            switch (header & RLE_TYPE) {
+                case RLE_FILL:
+                    color = *data++;
+                    if (clipped)
+                        FillSpan(ix, iy, count, color);
+                    else if (drawop == SRCCOPY) {
+                        __eds__ pixel_t* d = dest + ix;
+                        pixel_t p = ScreenPixel(color);
+                        for (n = count; n; n--) *d++ = p;
+                    }
+                    else
+                        fill(dest + ix, count, fill_color(drawop, color));
+                    if (!clipped)
+                        gfx_stats.pixels += count;
+                    break;
+
+                case RLE_COPY:
+                    if (clipped)
+                        CopySpan(ix, iy, count, data);
+                    else if (drawop == SRCCOPY) {
+                        __eds__ pixel_t* d = dest + ix;
+                        const __eds__ color_t* s = data;
+                        for (n = count; n; n--) *d++ = ScreenPixel(*s++);
+                    }
+                    else
+                        copy(dest + ix, data, data, count, drawop, false);
+                    if (!clipped)
+                        gfx_stats.pixels += count;
+                    data += count;
+                    break;
+            }
+        }
+    }
+}
+
+void ClearImage() {
+    ClearImageEx(0x0000);
+}
+
+static void clear_rect(const rect_t* r, color_t c) {
+    uint w = r->x2 - r->x1 + 1;
+    uint y;
+
+    c = ScreenPixel(c);
+    for (y = r->y1; y <= r->y2; y++)
+        fill_copy(span_address(r->x1, y, w), w, c);
+    gfx_stats.pixels += (uint32)w * (r->y2 - r->y1 + 1);
+}
+
+void ClearImageEx(color_t c) {
+#ifdef GFX_DISPLAY_LIST
+    // Start a new display list
+    list_count = 0;
+    frame_clip = clip;
+#endif
+
+#ifdef GFX_RETAINED
+    // Only the areas that change are cleared (see repair_damage)
+    if (c != clear_color) {
+        rect_t r = FULL_SCREEN;
+        clear_color = c;
+        rect_set_add(&damage, &r);
+    }
+#else
+    uint i;
+
+    if (c != clear_color) {
+        rect_t r = FULL_SCREEN;
+#ifndef GFX_BANDED
+        clear_rect(&r, c);
+#endif
+
+        clear_color = c;
+        rect_set_add(&dirty, &r);
+        rect_set_clear(&drawn);
+        return;
+    }
+
+    // The rest of the screen is already clear (the bands are cleared as they're drawn)
+    for (i = 0; i < drawn.count; i++) {
+#ifndef GFX_BANDED
+        clear_rect(&drawn.rects[i], c);
+#endif
+        rect_set_add(&dirty, &drawn.rects[i]);
+    }
+    rect_set_clear(&drawn);
 #endif
 }
 
@@ -188,26 +1049,69 @@ static INLINE uint byte_index(uint8 x, uint8 y) {
     return x % 8;
 }*/
 
+static void replay_pixel(const gfx_cmd_t* cmd) {
+    SetPixel(cmd->x, cmd->y, cmd->color);
+}
+
 // Set a single pixel
 void SetPixel(uint8 x, uint8 y, color_t color) {
-    uint idx = byte_index(x,y);
+    gfx_cmd_t* cmd;
+    uint idx;
+
+    if (!rect_contains(&clip, x, y))
+        return;
+
+    // Drawing functions invalidate their whole area first, so this is
+    // normally just a check against the last rectangle.
+    if (track_changes && (!rect_contains(&dirty.rects[dirty.last], x, y) || !rect_contains(&drawn.rects[drawn.last], x, y)))
+        InvalidateRect(x, y, 1, 1);
+
+    if ((cmd = RecordCommand(replay_pixel, x, y, 1, 1)) != NULL) {
+        cmd->x = x; cmd->y = y;
+        cmd->color = color;
+        return;
+    }
+
+    gfx_stats.pixels++;
+    idx = byte_index(x,y);
 	//screen[idx] = color;
     DrawOp(global_drawop, &screen[idx], &color, NULL, false);
 }
 
+static void replay_toggle(const gfx_cmd_t* cmd) {
+    TogglePixel(cmd->x, cmd->y);
+}
+
 // Invert the colour of a pixel (XOR)
 void TogglePixel(uint8 x, uint8 y) {
-    uint idx = byte_index(x,y);
-	screen[idx] ^= 0xFFFF;
+    gfx_cmd_t* cmd;
+    uint idx;
+
+    if (!rect_contains(&clip, x, y))
+        return;
+    InvalidateRect(x, y, 1, 1);
+
+    if ((cmd = RecordCommand(replay_toggle, x, y, 1, 1)) != NULL) {
+        cmd->x = x; cmd->y = y;
+        return;
+    }
+
+    gfx_stats.pixels++;
+
+    idx = byte_index(x,y);
+	screen[idx] ^= (pixel_t)0xFFFF;
 }
 
 // Returns colour for the given pixel
 color_t GetPixel(uint8 x, uint8 y) {
-    //int idx = byte_index(x, y);
-    //uint8 mask = 1 << bit_index(x);
-
-    //return screen[idx] & mask ? 1 : 0;
-	return 0;
+#ifdef GFX_BANDED
+    // Only the current band is buffered
+    return 0;
+#else
+    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT)
+        return 0;
+    return ScreenColor(screen[byte_index(x, y)]);
+#endif
 }
 
 
@@ -215,66 +1119,87 @@ color_t GetPixel(uint8 x, uint8 y) {
 
 // Draw a box
 
+static void replay_box(const gfx_cmd_t* cmd) {
+    DrawBox(cmd->x, cmd->y, cmd->w, cmd->h, cmd->color, cmd->color2);
+}
+
 void DrawBox(uint8 x, uint8 y, uint8 w, uint8 h, color_t border, color_t fill) {
+    gfx_cmd_t* cmd;
     int i, j;
 
+    InvalidateRect(x, y, w, h);
+
+    if ((cmd = RecordCommand(replay_box, x, y, w, h)) != NULL) {
+        cmd->x = x; cmd->y = y; cmd->w = w; cmd->h = h;
+        cmd->color = border; cmd->color2 = fill;
+        return;
+    }
+
     // Draw box fill
 	//if (fill.val != NO_FILL) {
-        for (j = y + 1; j < y + h - 1; j++) {
-            for (i = x; i < x + w - 1; i++) {
-                SetPixel(i, j, fill);
-            }
-        }
+        for (j = y + 1; j < y + h - 1; j++)
+            FillSpan(x, j, w - 1, fill);
     //}
 
     // Draw box border
     //if (border.val != NO_LINE) {
         for (i = y; i < (y + h); i++) {
-            SetPixel(x, i, border);
-            SetPixel(x + w - 1, i, border);
-        }
-        for (i = x; i < (x + w); i++) {
-            SetPixel(i, y, border);
-            SetPixel(i, y + h - 1, border);
+            FillSpan(x, i, 1, border);
+            FillSpan(x + w - 1, i, 1, border);
         }
+        FillSpan(x, y, w, border);
+        FillSpan(x, y + h - 1, w, border);
     //}
 }
 
 // Draw a box with rounded corners (rounded by 1px)
 
+static void replay_rounded_box(const gfx_cmd_t* cmd) {
+    DrawRoundedBox(cmd->x, cmd->y, cmd->w, cmd->h, cmd->color, cmd->color2);
+}
+
 void DrawRoundedBox(uint8 x, uint8 y, uint8 w, uint8 h, color_t border, color_t fill) {
+    gfx_cmd_t* cmd;
     int i, j;
 
+    InvalidateRect(x - 1, y, w, h + 1);
+
+    if ((cmd = RecordCommand(replay_rounded_box, x - 1, y, w, h + 1)) != NULL) {
+        cmd->x = x; cmd->y = y; cmd->w = w; cmd->h = h;
+        cmd->color = border; cmd->color2 = fill;
+        return;
+    }
+
     // Draw box fill
     //if (fill != NO_FILL) {
-        for (j = y + 1; j < y + h; j++) {
-            for (i = x; i < x + w - 2; i++) {
-                SetPixel(i, j, fill);
-            }
-        }
+        for (j = y + 1; j < y + h; j++)
+            FillSpan(x, j, w - 2, fill);
     //}
 
     // Draw box border
     //if (border != NO_LINE) {
         for (i = y + 1; i < (y + h); i++) {
-            SetPixel(x - 1, i, border);
-            SetPixel(x + w - 2, i, border);
-        }
-        for (i = x; i < (x + w - 2); i++) {
-            SetPixel(i, y, border);
-            SetPixel(i, y + h, border);
+            FillSpan(x - 1, i, 1, border);
+            FillSpan(x + w - 2, i, 1, border);
         }
+        FillSpan(x, y, w - 2, border);
+        FillSpan(x, y + h, w - 2, border);
     //}
 }
 
 
 // Draw a line between two points
 
+static void replay_line(const gfx_cmd_t* cmd) {
+    DrawLine(cmd->x, cmd->y, cmd->u, cmd->v, cmd->color);
+}
+
 void DrawLine(int x0, int y0, int x1, int y1, color_t color) {
     //Bresenham's Line Algorithm
     int dx, dy;
 	int sx, sy, err;
 	int e2;
+    gfx_cmd_t* cmd;
 
     dx = abs(x1 - x0);
     dy = abs(y1 - y0);
@@ -283,6 +1208,15 @@ void DrawLine(int x0, int y0, int x1, int y1, color_t color) {
     sy = (y0 < y1) ? 1 : -1;
     err = dx - dy;
 
+    InvalidateRect((x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1, dx + 1, dy + 1);
+
+    if ((cmd = RecordCommand(replay_line, (x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1, dx + 1, dy + 1)) != NULL) {
+        cmd->x = x0; cmd->y = y0;
+        cmd->u = x1; cmd->v = y1;
+        cmd->color = color;
+        return;
+    }
+
     while (1) {
         SetPixel(x0, y0, color);
 
@@ -338,64 +1272,107 @@ void DrawLinePolar(uint8 radius, uint16 theta, uint8 cx, uint8 cy, color_t color
 }
 
 
-// Copy a source image to the screen using the specified drawing operation
-void BitBlit(image_t* src, image_t* mask, uint xdest, uint ydest, uint width, uint height, uint xsrc, uint ysrc, drawop_t drawop, bool invert) {
-    /*if (src != NULL) {
-        uint x,y,w,h;
-        uint destDelta, srcDelta;
-        __eds__ color_t *srcbuf;
-        __eds__ color_t *destbuf;
-        __eds__ color_t *maskbuf;
-
-        if (width == 0) width = src->width;
-        if (height == 0) height = src->height;
-
-        // If mask isn't defined, make it something valid
-        if (mask == NULL) mask = src;
-
-        srcbuf = &src->pixels[0];
-        destbuf = &screen[0];
-        maskbuf = &mask->pixels[0]; //TODO: Tradeoff between mask image size (1 bit) and performance (16 bit)
-
+static void replay_blit(const gfx_cmd_t* cmd) {
+    BitBlit(cmd->ptr, cmd->ptr2, cmd->x, cmd->y, cmd->w, cmd->h, cmd->u, cmd->v, cmd->drawop, cmd->color);
+}
 
-        // Calculate minimum clipping region
-        w = min(src->width, width);
-        h = min(src->height, height);
+// Copy a source image to the screen using the specified drawing operation
+void BitBlit(const image_t* src, const image_t* mask, int xdest, int ydest, uint width, uint height, uint xsrc, uint ysrc, drawop_t drawop, bool invert) {
+    const __eds__ color_t* srcbuf;
+    const __eds__ color_t* maskbuf;
+    copy_kernel_t copy;
+    gfx_cmd_t* cmd;
+    int w, h, d;
+    uint y;
+
+    if (src == NULL || src->format != IMAGE_RAW)
+        return;
+
+    if (width == 0) width = src->width;
+    if (height == 0) height = src->height;
+
+    // If mask isn't defined, make it something valid
+    if (mask == NULL) mask = src;
+    if (mask->format != IMAGE_RAW)
+        return;
+
+    // Clip the source rectangle to the images
+    if (xsrc >= src->width || ysrc >= src->height || xsrc >= mask->width || ysrc >= mask->height)
+        return;
+    w = width;
+    h = height;
+    if (w > src->width - (int)xsrc) w = src->width - xsrc;
+    if (h > src->height - (int)ysrc) h = src->height - ysrc;
+    if (w > mask->width - (int)xsrc) w = mask->width - xsrc;
+    if (h > mask->height - (int)ysrc) h = mask->height - ysrc;
+
+    // Clip the destination, once for the whole image
+    if (xdest < clip.x1) { d = clip.x1 - xdest; xsrc += d; w -= d; xdest = clip.x1; }
+    if (ydest < clip.y1) { d = clip.y1 - ydest; ysrc += d; h -= d; ydest = clip.y1; }
+    if (xdest + w > clip.x2 + 1) w = clip.x2 + 1 - xdest;
+    if (ydest + h > clip.y2 + 1) h = clip.y2 + 1 - ydest;
+    if (w <= 0 || h <= 0)
+        return;
+
+    InvalidateRect(xdest, ydest, w, h);
+
+    // Already clipped. The rop is kept as the command's drawop, and invert as its colour.
+    if ((cmd = RecordCommand(replay_blit, xdest, ydest, w, h)) != NULL) {
+        cmd->x = xdest; cmd->y = ydest; cmd->w = w; cmd->h = h;
+        cmd->u = xsrc; cmd->v = ysrc;
+        cmd->ptr = src; cmd->ptr2 = mask;
+        cmd->drawop = drawop;
+        cmd->color = invert;
+        return;
+    }
 
-        // Offset the source image
-        // Use if statement because this is less likely to be used (and can be optimised away)
-        if (xsrc != 0 || ysrc != 0) {
-                srcbuf += xsrc + (ysrc * src->width);
-        }
+    gfx_stats.pixels += (uint32)w * h;
 
-        // Offset the dest buffer
-        // No if statement because this is more likely to be used
-        destbuf += xdest + (ydest * DISPLAY_WIDTH);
+    srcbuf = &src->pixels[xsrc + ysrc * src->width];
+    maskbuf = &mask->pixels[xsrc + ysrc * mask->width];
 
-        // Precompute deltas
-        destDelta = DISPLAY_WIDTH - w;
-        srcDelta = src->width - w;
+    copy = pick_copy(drawop, invert);
+    for (y = 0; y < h; y++) {
+        copy_row(copy, xdest, ydest + y, srcbuf, maskbuf, w, drawop, invert);
+        srcbuf += src->width;
+        maskbuf += mask->width;
+    }
+}
 
-        // Copy pixels from the image directly to the screen buffer
-        for (y = 0; y < h; y++) {
-            for (x = 0; x < w; x++) {
-                DrawOp(drawop, destbuf, srcbuf, maskbuf, invert);
-                destbuf++; srcbuf++; maskbuf++;
-            }
 
-            // Skip over pixels that lie outside the clipping region
-            destbuf += destDelta;
-            srcbuf += srcDelta;
-        }
-    }*/
+// Byte j of the screen buffer as an ordinary RGB565 image
+static INLINE byte screen_byte(uint j) {
+#if defined(GFX_8BPP)
+    color_t c = ScreenColor(screen[j >> 1]);
+    return (j & 1) ? (byte)(c >> 8) : (byte)c;
+#elif defined(GFX_WIRE_ORDER)
+    // The bytes of each pixel are swapped as well as reversed
+    return bitreverse[((__eds__ byte*)screen)[j ^ 1]];
+#else
+    return ((__eds__ byte*)screen)[j];
+#endif
 }
 
-
 extern void ReadScreenBuffer(byte* buf, uint offset, uint len) {
     uint i, j;
 
-    __eds__ byte* screen_buf = (__eds__ byte*)screen;
+#ifdef GFX_BANDED
+    // Draw each band it covers
+    const uint band_size = DISPLAY_WIDTH * BAND_HEIGHT * sizeof(color_t);
+    while (len && offset < DISPLAY_SIZE * sizeof(color_t)) {
+        uint n = band_size - offset % band_size;
+        if (n > len) n = len;
+
+        render_band(offset / band_size * BAND_HEIGHT);
+        for (i=0, j=offset % band_size; i<n; i++, j++) {
+            *buf++ = screen_byte(j);
+        }
+        offset += n;
+        len -= n;
+    }
+#else
     for (i=0, j=offset; i<len; i++, j++) {
-        buf[i] = screen_buf[j];
+        buf[i] = screen_byte(j);
     }
+#endif
 }
\ No newline at end of file
@@ -51,13 +51,72 @@ typedef union {
 //#define DISPLAY_SIZE (DISPLAY_WIDTH*DISPLAY_HEIGHT*sizeof(color_t))
 #define DISPLAY_SIZE (DISPLAY_WIDTH*DISPLAY_HEIGHT)
 
+// Uncomment to draw the screen a band at a time, instead of keeping a 32KB screen buffer.
+// Drawing calls are recorded, and replayed for each band by UpdateDisplay().
+// GetPixel() and UpdateDisplayWipeIn() aren't supported.
+//#define GFX_BANDED
+
+// Uncomment to only redraw what has changed since the last frame. Drawing calls are
+// recorded, and UpdateDisplay() compares them with the last frame's to find the areas
+// to clear and draw again. Images, runs and fonts are compared by address.
+//#define GFX_RETAINED
+
+// Uncomment to keep the screen buffer in the order it goes out on the display's data bus,
+// which is wired backwards (see peripherals/ssd1351p.c), so sending it is a straight copy.
+// Colours are converted once as they're stored instead (see WireColor()).
+//#define GFX_WIRE_ORDER
+
+// Uncomment to keep a 16KB screen buffer of 8-bit (RGB 3:3:2) pixels, which the display
+// takes in its 256 colour mode, so each frame is also half as many bytes to send.
+// Colours are quantized as they're stored (see ScreenPixel()), and read back as RGB565.
+//#define GFX_8BPP
+
+#if defined(GFX_BANDED) || defined(GFX_RETAINED)
+#define GFX_DISPLAY_LIST
+#define DISPLAY_LIST_SIZE   512     // Drawing calls recorded per frame (the imu graph needs ~450)
+#endif
+
+#ifdef GFX_BANDED
+#define BAND_HEIGHT         16      // Rows drawn at a time (divides DISPLAY_HEIGHT)
+#endif
+
+// A pixel in the screen buffer
+#ifdef GFX_8BPP
+typedef uint8 pixel_t;
+#else
+typedef color_t pixel_t;
+#endif
+
 
 //////////////////////////////////
 
+// Screen area in pixels, from (x1,y1) to (x2,y2) inclusive
+typedef struct {
+    uint8 x1, y1;
+    uint8 x2, y2;
+} rect_t;
+
+// Maximum number of separate areas sent to the display by UpdateDisplay()
+#define MAX_DIRTY_RECTS 8
+
+// Image formats
+#define IMAGE_RAW   0   // width * height pixels
+#define IMAGE_RLE   1   // Run-length encoded rows with transparency (see below)
+
+// IMAGE_RLE rows are a sequence of packets, which never cross rows (made by tools/img2h.py).
+// Each packet starts with a header word, with the type in the top 2 bits
+// and the number of pixels in the rest.
+#define RLE_TYPE    0xC000
+#define RLE_COUNT   0x3FFF
+#define RLE_SKIP    0x0000  // Transparent pixels, left as they are
+#define RLE_FILL    0x4000  // Pixels of the colour in the next word
+#define RLE_COPY    0x8000  // Pixels that follow
+
 typedef struct {
-    __eds__ color_t *pixels;
+    __eds__ color_t *pixels;    // Or the encoded rows for IMAGE_RLE
     int width;
     int height;
+    uint8 format;
 } image_t;
 
 
@@ -98,19 +157,139 @@ typedef enum {
 
 extern drawop_t global_drawop;
 
+///// Display List /////
+
+// A recorded drawing call (GFX_BANDED, GFX_RETAINED). Anything it points to must
+// stay valid until the screen is cleared, as it may be drawn again.
+typedef struct gfx_cmd gfx_cmd_t;
+typedef void (*gfx_cmd_fn)(const gfx_cmd_t* cmd);
+
+struct gfx_cmd {
+    gfx_cmd_fn draw;            // Makes the call again
+    drawop_t drawop;            // global_drawop when it was recorded
+    rect_t box;                 // Area it can draw on (empty for RecordState)
+    int16 x, y, w, h;
+    int16 u, v;                 // Other arguments, depending on the call
+    color_t color, color2;
+    union {
+        struct { const void *ptr, *ptr2; };
+        struct { const __eds__ void *data, *data2; };
+    };
+};
+
+#ifdef GFX_DISPLAY_LIST
+// Drawing functions call this first, with the area they can draw on. Returns a
+// command to fill in if the call is being recorded, or NULL if it should draw.
+gfx_cmd_t* RecordCommand(gfx_cmd_fn draw, int x, int y, int w, int h);
+#else
+#define RecordCommand(draw, x, y, w, h) ((void)(draw), (gfx_cmd_t*)NULL)
+#endif
+
+// For calls that change how the ones after them draw (eg. SetClipRect)
+#define RecordState(draw) RecordCommand(draw, 0, 0, -1, -1)
+
+typedef struct {
+    uint32 frames;          // UpdateDisplay() calls
+    uint32 pixels;          // Written to the screen buffer, including clearing
+    uint32 commands;        // Drawing calls recorded
+    uint32 replayed;        // Recorded calls drawn (again for each band or changed area)
+    uint32 overflows;       // Calls dropped because the display list was full
+    uint32 bands;           // Bands drawn
+    uint max_commands;      // Most in one display list
+} gfx_stats_t;
+
+void GetGfxStats(gfx_stats_t* stats);
+
 ///// Low Level /////
 
 #include <system.h>
 
+#ifdef GFX_WIRE_ORDER
+#include "util/util.h"
+
+// Colour as stored in the screen buffer. Sending the bytes low first and bit-reversed
+// reverses all 16 bits, so this also converts back (ScreenColor()).
+static INLINE color_t WireColor(color_t c) {
+    return ((color_t)bitreverse[(uint8)c] << 8) | bitreverse[(uint8)(c >> 8)];
+}
+#else
+#define WireColor(c) (c)
+#endif
+
+#ifdef GFX_8BPP
+// The top bits of each channel, as the display takes them in 256 colour mode
+#define RGB332(c) ((uint8)((((c) >> 8) & 0xE0) | (((c) >> 6) & 0x1C) | (((c) >> 3) & 0x03)))
+
+// Colour as stored in the screen buffer
+static INLINE pixel_t ScreenPixel(color_t c) {
+#ifdef GFX_WIRE_ORDER
+    return bitreverse[RGB332(c)];
+#else
+    return RGB332(c);
+#endif
+}
+
+// And back again, repeating each channel's bits to fill out the low ones
+static INLINE color_t ScreenColor(pixel_t p) {
+    uint r, g, b;
+#ifdef GFX_WIRE_ORDER
+    p = bitreverse[p];
+#endif
+    r = p >> 5;
+    g = (p >> 2) & 0x07;
+    b = p & 0x03;
+    return ((r << 2 | r >> 1) << 11) | ((g << 3 | g) << 5) | (b << 3 | b << 1 | b >> 1);
+}
+#else
+#define ScreenPixel(c) WireColor(c)
+#define ScreenColor(p) WireColor(p)
+#endif
+
 void SetPixel(uint8 x, uint8 y, color_t color);
 void TogglePixel(uint8 x, uint8 y);
 color_t GetPixel(uint8 x, uint8 y);
 
+// Draw a horizontal run of pixels using global_drawop (clipped to the clip rectangle).
+// These pick the inner loop once, so they are much faster than SetPixel()
+// for anything wider than a couple of pixels.
+void FillSpan(int x, int y, int w, color_t color);
+void CopySpan(int x, int y, int w, const __eds__ color_t* src);
+
+// Same as CopySpan, but only where the mask is brighter than 50% grey
+void CopySpanMasked(int x, int y, int w, const __eds__ color_t* src, const __eds__ color_t* mask);
+
+// Runs of pixels (eg. the opaque parts of a glyph). Each run is a header word
+// followed by its pixels, and each row ends with RUN_END_OF_ROW.
+#define RUN_HEADER(x,len)   (((x) << 8) | (len))
+#define RUN_X(header)       ((header) >> 8)
+#define RUN_LENGTH(header)  ((header) & 0xFF)
+#define RUN_END_OF_ROW      0
+
+// Draw h rows of runs, within a w x h area at (x,y)
+void DrawRuns(int x, int y, int w, int h, const __eds__ color_t* runs);
+
 ///// Display /////
 
-// Copy the screen buffer to the display
+// Copy the parts of the screen buffer that have changed to the display
 extern void UpdateDisplay();
 
+// Send the whole screen buffer with a wipe from the left (dir > 0) or right (dir < 0).
+// Blocks until it's done. With GFX_BANDED this is just UpdateDisplay().
+extern void UpdateDisplayWipeIn(int dir);
+
+// Mark an area as changed, so the next UpdateDisplay() sends it.
+// The drawing functions do this themselves. Does nothing with GFX_RETAINED,
+// where the changes are found from the drawing calls.
+extern void InvalidateRect(int x, int y, int w, int h);
+
+// Limit all drawing to an area of the screen, until ResetClipRect()
+extern void SetClipRect(int x, int y, int w, int h);
+extern void ResetClipRect();
+
+// Send the whole screen buffer on the next UpdateDisplay()
+// (eg. when the display RAM has been lost)
+extern void InvalidateDisplay();
+
 ///// Screen Buffer /////
 
 // Clear the internal screen buffer
@@ -124,7 +303,15 @@ extern void DrawRoundedBox(uint8 x, uint8 y, uint8 w, uint8 h, color_t border, c
 extern void DrawLine(int x0, int y0, int x1, int y1, color_t color);
 extern void DrawImage(int x, int y, const image_t* image);
 //extern image_t OffsetImage(int x, int y, image_t image);
-void BitBlit(image_t* src, image_t* mask, uint xdest, uint ydest, uint width, uint height, uint xsrc, uint ysrc, drawop_t rop, bool invert);
+
+// Decode an IMAGE_RLE image straight into the screen buffer (see DrawImage)
+void DrawImageRLE(int x, int y, const image_t* image);
+
+// Draw a width x height area of src, from (xsrc,ysrc), to (xdest,ydest) on the screen.
+// A width or height of 0 means the whole image. The mask is used by the MERGECOPY
+// and PAT* drawops, and must be at least as large as the area (NULL to use src).
+// Only IMAGE_RAW images can be used.
+void BitBlit(const image_t* src, const image_t* mask, int xdest, int ydest, uint width, uint height, uint xsrc, uint ysrc, drawop_t rop, bool invert);
 
 // Polar co-ordinates
 extern void PolarToCartesian(int radius, int theta, int* xout, int* yout);
@@ -7,6 +7,7 @@
 
 ////////// Includes ////////////////////////////////////////////////////////////
 
+#include <string.h>
 #include "system.h"
 #include "gfx.h"
 #include "imfont.h"
@@ -18,6 +19,35 @@
 
 #define FONT_BASE ' '
 
+////////// Glyph Cache /////////////////////////////////////////////////////////
+
+// Glyphs are cached already tinted to a colour, as runs of opaque pixels
+// (see DrawRuns), in a fixed pool. The least recently used glyphs are
+// evicted to make room, and the pool is compacted.
+
+#define GLYPH_CACHE_WORDS   3072    // RAM budget for the runs (6KB)
+#define GLYPH_CACHE_ENTRIES 64
+#define GLYPH_CACHE_BUCKETS 32      // Hash table size (power of 2)
+
+typedef struct {
+    const imfont_t* font;   // NULL if the entry is free
+    color_t color;
+    char c;
+    uint8 next;             // Next entry in the bucket (index+1, 0 for none)
+    uint offset;            // Start of the runs in glyph_pool
+    uint size;              // Words
+    uint32 last_used;
+} glyph_entry_t;
+
+static glyph_entry_t glyph_entries[GLYPH_CACHE_ENTRIES];
+static uint8 glyph_buckets[GLYPH_CACHE_BUCKETS];    // First entry (index+1, 0 for none)
+static uint num_entries = 0;
+static color_t glyph_pool[GLYPH_CACHE_WORDS];
+static uint pool_used = 0;
+
+static uint32 glyph_clock = 0;
+static imfont_cache_stats_t glyph_stats;
+
 ////////// Globals /////////////////////////////////////////////////////////////
 
 //const imfont_t* active_imfont = &font_segoe_ui;
@@ -29,67 +59,270 @@ void SetImFont(const imfont_t* font) {
 	active_imfont = font;
 }
 
+// Scale the colour by the coverage of a glyph pixel (0-31)
+static color_t tint(uint8 coverage, color_t color) {
+    color_s c;
+
+    if (color == WHITE) {
+        c.r = coverage;
+        c.g = coverage << 1;
+        c.b = coverage;
+    }
+    else {
+        color_s cin;
+        cin.val = color;
+
+        uint16 r = coverage;
+        uint16 g = coverage << 1;
+        uint16 b = coverage;
+        c.r = (r * cin.r) >> 5;
+        c.g = (g * cin.g) >> 6;
+        c.b = (b * cin.b) >> 5;
+    }
+
+    return c.val;
+}
+
+// Coverage of a pixel in a glyph's bounding box, scaled to 0-31
+static uint8 coverage(const imfont_t* font, const imglyph_t* g, uint i) {
+    uint bit = i * font->bpp;
+    uint8 max = (1 << font->bpp) - 1;
+    uint8 v = (font->data[g->offset + (bit >> 3)] >> (8 - font->bpp - (bit & 7))) & max;
+    return (v * 31 + max/2) / max;
+}
+
+// Number of words needed to cache a glyph
+static uint glyph_size(const imfont_t* font, const imglyph_t* g) {
+    uint size = g->h;       // RUN_END_OF_ROW for each row
+    uint i, j, p = 0;
+
+    for (j=0; j<g->h; j++) {
+        bool in_run = false;
+        for (i=0; i<g->w; i++) {
+            if (coverage(font, g, p++)) {
+                if (!in_run) size++;    // Header
+                size++;
+                in_run = true;
+            }
+            else
+                in_run = false;
+        }
+    }
+    return size;
+}
+
+static void glyph_encode(color_t* dest, const imfont_t* font, const imglyph_t* g, color_t color) {
+    uint i, j, p = 0;
+    uint8 cov;
+
+    for (j=0; j<g->h; j++) {
+        color_t* header = NULL;
+        for (i=0; i<g->w; i++) {
+            if ((cov = coverage(font, g, p++))) {
+                if (header == NULL) {
+                    header = dest++;
+                    *header = RUN_HEADER(i, 0);
+                }
+                (*header)++;
+                *dest++ = tint(cov, color);
+            }
+            else
+                header = NULL;
+        }
+        *dest++ = RUN_END_OF_ROW;
+    }
+}
+
+static INLINE uint glyph_hash(char c, color_t color) {
+    return (c ^ color ^ (color >> 8)) & (GLYPH_CACHE_BUCKETS-1);
+}
+
+static void glyph_evict(uint index) {
+    glyph_entry_t* entry = &glyph_entries[index];
+    uint offset = entry->offset, size = entry->size;
+    uint8* link = &glyph_buckets[glyph_hash(entry->c, entry->color)];
+    uint i;
+
+    // Unlink it from its bucket
+    while (*link != index + 1)
+        link = &glyph_entries[*link - 1].next;
+    *link = entry->next;
+    entry->font = NULL;
+    num_entries--;
+
+    // Close the gap in the pool
+    memmove(&glyph_pool[offset], &glyph_pool[offset + size], (pool_used - offset - size) * sizeof(color_t));
+    pool_used -= size;
+    for (i=0; i<GLYPH_CACHE_ENTRIES; i++) {
+        if (glyph_entries[i].font != NULL && glyph_entries[i].offset > offset)
+            glyph_entries[i].offset -= size;
+    }
+
+    glyph_stats.evictions++;
+}
+
+static void glyph_evict_lru() {
+    uint i, lru = 0;
+    uint32 oldest = 0xFFFFFFFF;
+
+    for (i=0; i<GLYPH_CACHE_ENTRIES; i++) {
+        if (glyph_entries[i].font != NULL && glyph_entries[i].last_used < oldest) {
+            oldest = glyph_entries[i].last_used;
+            lru = i;
+        }
+    }
+    glyph_evict(lru);
+}
+
+// Find a glyph in the cache, or add it. Returns NULL if it can't be cached.
+static glyph_entry_t* glyph_lookup(char c, color_t color) {
+    const imfont_t* font = active_imfont;
+    uint bucket = glyph_hash(c, color);
+    glyph_entry_t* entry;
+    const imglyph_t* glyph;
+    uint i, size;
+
+    glyph_clock++;
+
+    for (i = glyph_buckets[bucket]; i != 0; i = entry->next) {
+        entry = &glyph_entries[i - 1];
+        if (entry->c == c && entry->color == color && entry->font == font) {
+            entry->last_used = glyph_clock;
+            glyph_stats.hits++;
+            return entry;
+        }
+    }
+    glyph_stats.misses++;
+
+    glyph = &font->glyphs[(uint8)c];
+    size = glyph_size(font, glyph);
+    if (size > GLYPH_CACHE_WORDS)
+        return NULL;
+
+    while (num_entries == GLYPH_CACHE_ENTRIES || pool_used + size > GLYPH_CACHE_WORDS)
+        glyph_evict_lru();
+
+    for (i=0; glyph_entries[i].font != NULL; i++)
+        ;
+    entry = &glyph_entries[i];
+    entry->font = font;
+    entry->color = color;
+    entry->c = c;
+    entry->offset = pool_used;
+    entry->size = size;
+    entry->last_used = glyph_clock;
+    entry->next = glyph_buckets[bucket];
+    glyph_buckets[bucket] = i + 1;
+    num_entries++;
+
+    glyph_encode(&glyph_pool[pool_used], font, glyph, color);
+    pool_used += size;
+
+    return entry;
+}
+
+void ImFontFlushCache() {
+    uint i;
+
+    for (i=0; i<GLYPH_CACHE_ENTRIES; i++)
+        glyph_entries[i].font = NULL;
+    for (i=0; i<GLYPH_CACHE_BUCKETS; i++)
+        glyph_buckets[i] = 0;
+    num_entries = 0;
+    pool_used = 0;
+}
+
+void ImFontGetCacheStats(imfont_cache_stats_t* stats) {
+    *stats = glyph_stats;
+    stats->entries = num_entries;
+    stats->words_used = pool_used;
+}
+
 ////////// Drawing /////////////////////////////////////////////////////////////
 
+// Adjustment between a pair of characters, from the font's kerning table
+static int kerning(char left, char right) {
+    const imkern_t* k = active_imfont->kerning;
+    uint i;
+
+    for (i=0; i<active_imfont->num_kerning; i++, k++) {
+        if (k->left == left && k->right == right)
+            return k->adjust;
+        if (k->left > left)
+            break;      // Sorted by the left character
+    }
+    return 0;
+}
+
 int MeasureImString(const char* str) {
-    uint w = 0;
+    int w = 0;
     while (*str) {
         char c = *str++;
-        c = (c < ' ') ? 0 : c - ' ';
-        w += active_imfont->widths[c];
+        w += active_imfont->glyphs[(c < ' ') ? 0 : c - ' '].width;
+        if (*str)
+            w += kerning(c, *str);
     }
     return w;
 }
 
+// Draw it again in the font it was recorded with (see RecordCommand)
+static void replay_imchar(const gfx_cmd_t* cmd) {
+    const imfont_t* font = active_imfont;
+
+    active_imfont = cmd->ptr;
+    DrawImChar(cmd->v, cmd->x, cmd->y, cmd->color);
+    active_imfont = font;
+}
+
 int DrawImChar(char c, uint8 x, uint8 y, color_t color) {
+    gfx_cmd_t* cmd;
+
     if (c < ' ')
         c = 0;
     else
         c -= ' ';
 
-    uint16 offset = active_imfont->offsets[c];
-    uint8 __eds__ *glyph = &active_imfont->data[offset];
-    uint8 width = active_imfont->widths[c];
-    uint8 height = active_imfont->char_height;
-
-    uint i, j;
-    for (j=0; j<height; j++) {
-        for (i=0; i<width; i++) {
-            if (*glyph) {
-                color_s c;
-                if (color == WHITE) {
-                    c.r = *glyph;
-                    c.g = *glyph << 1;
-                    c.b = *glyph;
-                }
-                else {
-                    color_s cin;
-                    cin.val = color;
-
-                    //TODO: Optimize
-                    uint16 r = *glyph;
-                    uint16 g = *glyph << 1;
-                    uint16 b = *glyph;
-                    c.r = (r * cin.r) >> 5;
-                    c.g = (g * cin.g) >> 6;
-                    c.b = (b * cin.b) >> 5;
+    const imglyph_t* g = &active_imfont->glyphs[(uint8)c];
+    if (g->h == 0)
+        return g->width;    // Nothing to draw (eg. space)
 
-                }
+    // The glyph cache is only used when it's drawn
+    if ((cmd = RecordCommand(replay_imchar, x + g->x, y + g->y, g->w, g->h)) != NULL) {
+        InvalidateRect(x + g->x, y + g->y, g->w, g->h);
+        cmd->x = x; cmd->y = y;
+        cmd->v = c + FONT_BASE;
+        cmd->color = color;
+        cmd->ptr = active_imfont;
+        return g->width;
+    }
 
-                SetPixel(x+i,y, c.val);
-            }
-            glyph++;
+    glyph_entry_t* entry = glyph_lookup(c, color);
+    if (entry != NULL) {
+        DrawRuns(x + g->x, y + g->y, g->w, g->h, &glyph_pool[entry->offset]);
+        return g->width;
+    }
+
+    // Too big for the cache, so tint each pixel
+    InvalidateRect(x + g->x, y + g->y, g->w, g->h);
+
+    uint i, j, p = 0;
+    for (j=0; j<g->h; j++) {
+        for (i=0; i<g->w; i++) {
+            uint8 cov = coverage(active_imfont, g, p++);
+            if (cov)
+                SetPixel(x + g->x + i, y + g->y + j, tint(cov, color));
         }
-        y++;
     }
 
-    return width;
+    return g->width;
 }
 
 int DrawImString(const char* str, uint8 x, uint8 y, color_t color) {
     while (*str) {
-        uint8 cw = DrawImChar(*str++, x, y, color);
-        x += cw;
+        char c = *str++;
+        x += DrawImChar(c, x, y, color);
+        if (*str)
+            x += kerning(c, *str);
     }
     return x;
-}
\ No newline at end of file
+}
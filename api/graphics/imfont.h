@@ -9,14 +9,36 @@
 #define	IMFONT_H
 
 typedef struct {
-    __eds__ uint8 *data;    // Raw image data
-    const uint16 *offsets;   // Character glyph offsets
-    const uint8 *widths;    // Character widths
+    uint16 offset;          // Start of the glyph in data
+    uint8 width;            // Advance to the next character
+    uint8 x, y;             // Bounding box of the glyph's coverage within the character cell
+    uint8 w, h;
+} imglyph_t;
+
+typedef struct {
+    char left, right;
+    int8 adjust;            // Added to the advance between the pair
+} imkern_t;
+
+typedef struct {
+    __eds__ uint8 *data;        // Packed coverage of each glyph's bounding box (MSB first)
+    const imglyph_t *glyphs;    // From ' '
+    const imkern_t *kerning;    // Sorted by left, then right character (optional)
+    uint num_kerning;
+    uint8 bpp;                  // Bits of coverage per pixel (1, 2 or 4)
 
     uint char_width;
     uint char_height;
 } imfont_t;
 
+typedef struct {
+    uint32 hits;
+    uint32 misses;
+    uint32 evictions;
+    uint entries;       // Glyphs in the cache
+    uint words_used;    // Of the cache's RAM budget
+} imfont_cache_stats_t;
+
 extern const imfont_t* active_imfont;
 
 void SetImFont(const imfont_t* font);
@@ -25,5 +47,9 @@ int MeasureImString(const char* str);
 int DrawImChar(char c, uint8 x, uint8 y, color_t color);
 int DrawImString(const char* str, uint8 x, uint8 y, color_t color);
 
+// Tinted glyphs are cached, keyed by font, character and colour
+void ImFontFlushCache();
+void ImFontGetCacheStats(imfont_cache_stats_t* stats);
+
 #endif	/* IMFONT_H */
 
@@ -9,16 +9,13 @@
 #include "api/graphics/gfx.h"
 
 void DrawImage(int x, int y, const image_t* image) {
-	//BitBlit(&image, NULL, x, y, w, h, 0, 0, SRCCOPY,0);
-
-    __eds__ color_t* c = image->pixels;
-    uint ix,iy;
-    for (iy=0; iy<image->height; iy++) {
-        for (ix=0; ix<image->width; ix++) {
-            SetPixel(ix+x,iy+y,*c++);
-        }
+    if (image->format == IMAGE_RLE) {
+        DrawImageRLE(x, y, image);
+        return;
     }
 
+    BitBlit(image, NULL, x, y, 0, 0, 0, 0, global_drawop, false);
+
    /* int idx = 0;
     int mask = 1;
 	color_t chunk = image.pixels[0];
@@ -26,6 +26,7 @@ bool InitializeOled() {
     //OledPowerOn();
     
     ssd1351_PowerOn();
+    InvalidateDisplay();
 
     //ssd1351_DisplayOn();
 
@@ -51,6 +52,7 @@ void OledDisplayOff() {
 
 void OledPowerOn() {
     ssd1351_PowerOn();
+    InvalidateDisplay();
 }
 
 void OledPowerOff() {
@@ -59,6 +61,7 @@ void OledPowerOff() {
 
 void OledClear() {
     ssd1351_ClearScreen();
+    InvalidateDisplay();
 }
 
 
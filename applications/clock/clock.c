@@ -51,7 +51,7 @@ static void Initialize() {
     AddTimetableEvent("ENCE462", "Er446", THURSDAY,  14, 0);
 }
 
-// Called periodically when isForeground==true (30Hz)
+// Called when a frame is drawn while isForeground==true (see AppInvalidate)
 static void Draw() {
     char s[50];
     int x,y,i;
@@ -62,6 +62,9 @@ static void Draw() {
 
     timestamp_t now = ClockNow();
     uint8 hour12 = ClockGet12Hour(now.hour);
+
+    // Nothing changes until the next minute
+    AppInvalidateAt(&appclock, GetSystick() + (60 - now.sec) * 1000UL);
     
     //// Analog Clock ////
 #if 0
@@ -41,7 +41,9 @@ static void Process();
 static void Draw();
 static void Event(event_type_t type, uint param);
 
-application_t appimu = {.name="IMU", .init=Initialize, .process=Process, .draw=Draw, .event=Event};
+#define SAMPLE_PERIOD 10 // ms (100Hz)
+
+application_t appimu = {.name="IMU", .init=Initialize, .process=Process, .period=SAMPLE_PERIOD, .draw=Draw, .event=Event};
 
 ////////// Variables ///////////////////////////////////////////////////////////
 
@@ -68,12 +70,12 @@ static bool capturing = false;
 
 static void StartCapture() {
     accel_SetMode(accMeasure);
-    appimu.task->state = tsRun;
+    ResumeTask(appimu.task);
     capturing = true;
 }
 
 static void StopCapture() {
-    appimu.task->state = tsStop;
+    SuspendTask(appimu.task);
     capturing = false;
     accel_SetMode(accStandby);
 }
@@ -101,7 +103,7 @@ static void Process() {
             accel_initted = true;
         }*/
 
-        Delay(10);
+        WaitNextPeriod();
 
         //TODO: Shift accelerometer logging into the IMU API
 
@@ -111,6 +113,9 @@ static void Process() {
         accel_log_index++;
         if (accel_log_index == ACCEL_LOG_SIZE)
             accel_log_index = 0;
+
+        // Drawn at most every DRAW_INTERVAL
+        AppInvalidate(&appimu);
     }
 }
 
@@ -138,7 +143,7 @@ static void Event(event_type_t type, uint param) {
     }
 }
 
-// Called periodically when isForeground==true (30Hz)
+// Called when a frame is drawn while isForeground==true (see AppInvalidate)
 static void Draw() {
 
 
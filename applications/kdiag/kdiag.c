@@ -39,11 +39,14 @@ static INLINE uint cpu_current(uint utilization) {
     return (utilization * CPU_CURRENT) / 1000;
 }
 
-// Called periodically when isForeground==true (30Hz)
+// Called when a frame is drawn while isForeground==true (see AppInvalidate)
 static void Draw() {
     uint i, x, y;
     char s[20];
 
+    // The stats are updated every CALC_CPU_TICKS
+    AppInvalidateAt(&appkdiag, GetSystick() + CALC_CPU_TICKS);
+
     // Draw CPU utilization history graph
     i = cpu_tick_history_idx;
     for (x=0; x<CPU_TICK_HISTORY_LEN; x++) {
@@ -55,8 +58,8 @@ static void Draw() {
 
         DrawLine(x,128, x,(128-value), SKYBLUE);
 
-        if (i++ == CPU_TICK_HISTORY_LEN)
-            i -= CPU_TICK_HISTORY_LEN;
+        if (++i == CPU_TICK_HISTORY_LEN)
+            i = 0;
     }
 
     x = 0; y = 16;
@@ -66,6 +69,7 @@ static void Draw() {
 
     DrawString("CPU%", 60,y, WHITE);
     DrawString("mA", 85,y, WHITE);
+    DrawString("Stk", 105,y, WHITE);
     //DrawString("%CPU", 88,y, WHITE);
     y += 8;
 
@@ -78,23 +82,44 @@ static void Draw() {
         DrawString(task->name, 8,y, color);
         
         //utoa(s, task->next_run, 10);
-        decitoa(s, task->cpu_ticks);
+        decitoa(s, task->cpu_usage);
         DrawString(s, 60,y, color);
 
-        decitoa(s, cpu_current(task->cpu_ticks));
+        decitoa(s, cpu_current(task->cpu_usage));
         DrawString(s, 85,y, color);
 
+        // Peak stack usage, in bytes
+        utoa(s, TaskStackUsage(task), 10);
+        DrawString(s, 105,y, color);
+
         //utoa(s, task->cpu_usage, 10);
         //DrawString(s, 88,y, color);
 
         y += 8;
     }
 
+    cpu_stats_t stats;
+    KernelGetStats(&stats);
+
     DrawString("Total", 8,y, WHITE);
 
-    decitoa(s, total_cpu_ticks);
+    decitoa(s, stats.cpu_usage);
     DrawString(s, 60,y, WHITE);
 
+    decitoa(s, cpu_current(stats.cpu_usage));
+    DrawString(s, 85,y, WHITE);
+    y += 8;
+
+    // Time spent in the idle task, awake (Idle mode) and asleep (Sleep mode)
+    DrawString("Idle", 8,y, GRAY);
+    decitoa(s, stats.idle_usage);
+    DrawString(s, 60,y, GRAY);
+    y += 8;
+
+    DrawString("Sleep", 8,y, GRAY);
+    decitoa(s, stats.sleep_usage);
+    DrawString(s, 60,y, GRAY);
+
     //utoa(s, 0, 10);
     //DrawString(s, 88,y, WHITE);
 
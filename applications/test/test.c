@@ -45,11 +45,8 @@ application_t apptest = {.name="Test", .init=Initialize, .draw=Draw};
 
 ////////// Variables ///////////////////////////////////////////////////////////
 extern task_t* draw_task;
-extern uint anext_task;
 
-extern uint16 task_sp;
 extern task_t* current_task;
-extern uint16 stack_base;
 
 extern bool usb_connected;
 
@@ -102,7 +99,7 @@ static void DrawTestGradient() {
     return;
 }
 
-// Called periodically when isForeground==true (30Hz)
+// Called when a frame is drawn while isForeground==true (see AppInvalidate)
 static void Draw() {
     
     //DrawTestGradient();
@@ -0,0 +1,122 @@
+/*
+ * File:   brightness.c
+ * Author: Jared
+ *
+ * Pins:
+ * AN_LIGHT     ADC         Ambient light sensor (TEMT6000)
+ *
+ * The sensor voltage is roughly proportional to the illuminance (about 0.5V
+ * at 100 lux), until it saturates at VDD in daylight. The OLED current is
+ * roughly proportional to the master contrast (n+1)/16 times the colour contrast,
+ * so dimming it indoors is the biggest power saving while the screen is on.
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include <system.h>
+#include "hardware.h"
+#include "brightness.h"
+#include "peripherals/adc.h"
+#include "drivers/ssd1351.h"
+#include "api/sensors.h"
+
+////////// Defines /////////////////////////////////////////////////////////////
+
+// Each sample is filtered in at 1/2^FILTER_SHIFT
+#define FILTER_SHIFT    2
+
+// The light has to cross a threshold by 1/HYSTERESIS of it before the level changes
+#define HYSTERESIS      4
+
+typedef struct {
+    voltage_t light;    // mV - Lowest sensor voltage for this level
+    uint8 contrast;     // Master contrast (0-15)
+    uint8 colour;       // R,G,B contrast (0-255)
+} brightness_level_t;
+
+static const brightness_level_t levels[] = {
+    {   0,  3, 0x80},   // Dark
+    {  30,  5, 0x90},   // Dim room
+    { 150,  8, 0xA0},   // Indoors
+    {1500, 11, 0xB0},   // Bright indoors
+    {2800, 15, 0xC8},   // Daylight
+};
+#define NUM_LEVELS (sizeof(levels) / sizeof(levels[0]))
+
+////////// Globals /////////////////////////////////////////////////////////////
+
+bool auto_brightness = true;
+int8 brightness_offset = 0;
+uint light_voltage = 0;
+
+////////// Locals //////////////////////////////////////////////////////////////
+
+static uint light_sum;          // light_voltage << FILTER_SHIFT
+static bool light_valid = false;
+
+static int level = -1;          // Index into levels[], -1 until the first sample
+static int8 shown_contrast = -1;
+static uint8 shown_colour = 0;
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+static uint pick_level() {
+    uint i;
+
+    // No hysteresis for the first sample
+    if (level < 0) {
+        i = NUM_LEVELS - 1;
+        while (i > 0 && light_voltage < levels[i].light)
+            i--;
+        return i;
+    }
+
+    i = level;
+    while (i < NUM_LEVELS-1 && light_voltage > levels[i+1].light + levels[i+1].light / HYSTERESIS)
+        i++;
+    while (i > 0 && light_voltage < levels[i].light - levels[i].light / HYSTERESIS)
+        i--;
+    return i;
+}
+
+static void cb_ConvertedLight(voltage_t voltage) {
+    if (light_valid) {
+        light_sum += voltage - (light_sum >> FILTER_SHIFT);
+    } else {
+        light_sum = voltage << FILTER_SHIFT;
+        light_valid = true;
+    }
+    light_voltage = light_sum >> FILTER_SHIFT;
+
+    if (vdd != 0)
+        ambient_light = (light_voltage >= vdd) ? 255 : (uint32)light_voltage * 255 / vdd;
+
+    if (!auto_brightness)
+        return;
+
+    level = pick_level();
+
+    int contrast = levels[level].contrast + brightness_offset;
+    if (contrast < 0) contrast = 0;
+    if (contrast > 15) contrast = 15;
+
+    // Only talk to the display when it changes
+    if (levels[level].colour != shown_colour) {
+        shown_colour = levels[level].colour;
+        ssd1351_SetColourBalance(shown_colour, shown_colour, shown_colour);
+    }
+    if (contrast != shown_contrast) {
+        shown_contrast = contrast;
+        ssd1351_SetContrast(contrast);
+    }
+}
+
+void ProcessBrightness() {
+    adc_SetCallback(AN_LIGHT, cb_ConvertedLight);
+    adc_StartConversion(AN_LIGHT);
+}
+
+void ResetBrightness() {
+    light_valid = false;
+    level = -1;
+}
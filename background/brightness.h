@@ -0,0 +1,30 @@
+/*
+ * File:   brightness.h
+ * Author: Jared
+ *
+ * Automatic screen brightness from the ambient light sensor
+ */
+
+#ifndef BRIGHTNESS_H
+#define	BRIGHTNESS_H
+
+////////// Properties //////////////////////////////////////////////////////////
+
+// If true, the screen brightness follows the ambient light
+extern bool auto_brightness;
+
+// Added to the master contrast (0-15) that the light level asks for
+extern int8 brightness_offset;
+
+// Filtered light sensor voltage, in millivolts
+extern uint light_voltage;
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+// Sample the light sensor, the brightness is updated when the conversion finishes
+void ProcessBrightness();
+
+// Forget the light history, so the next sample takes effect straight away
+void ResetBrightness();
+
+#endif	/* BRIGHTNESS_H */
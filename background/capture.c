@@ -0,0 +1,217 @@
+/*
+ * File:   capture.c
+ * Author: Jared
+ *
+ * Compresses frames from the screen buffer for the screen capture stream
+ * (see capture.h for the format). Rows are read and encoded one at a time as
+ * the USB packets go out, so only a row of pixels and a checksum per row are
+ * kept instead of a copy of the last frame.
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include <system.h>
+#include <string.h>
+#include "capture.h"
+#include "drivers/usb/usb.h"
+#include "api/graphics/gfx.h"
+#include "core/kernel.h"
+#include "core/os.h"
+
+////////// Defines /////////////////////////////////////////////////////////////
+
+#define ROW_SIZE        (DISPLAY_WIDTH * sizeof(color_t))
+#define MAX_COUNT       128     // Longest run, literal or row skip
+#define MIN_RUN         3       // Shorter runs are cheaper as part of a literal
+
+// A read can leave up to PACKET_SIZE-1 bytes behind, then the next row can add
+// a frame header (7), a skip, the row marker and a row of literal pixels
+#define OUT_SIZE        (PACKET_SIZE + 16 + ROW_SIZE)
+
+////////// Globals /////////////////////////////////////////////////////////////
+
+bool capture_active = false;
+
+////////// Locals //////////////////////////////////////////////////////////////
+
+static uint interval;
+static systick_t last_capture;
+static uint32 last_frames;          // gfx_stats.frames at the last capture
+static uint16 frame_number;
+static bool keyframe;
+
+static bool in_frame = false;
+static bool frame_start;
+static uint row;                    // Next row to encode
+static uint skip;                   // Unchanged rows not written yet
+
+static uint32 row_sums[DISPLAY_HEIGHT];
+static color_t pixels[DISPLAY_WIDTH];
+
+static byte out[OUT_SIZE];
+static uint out_len;
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+static void put(byte b) {
+    out[out_len++] = b;
+}
+
+static void put16(uint16 v) {
+    put((byte)v);
+    put((byte)(v >> 8));
+}
+
+static void put_skip() {
+    while (skip) {
+        uint n = (skip > MAX_COUNT) ? MAX_COUNT : skip;
+        put(n - 1);
+        skip -= n;
+    }
+}
+
+static void put_literal(color_t* px, uint n) {
+    while (n) {
+        uint count = (n > MAX_COUNT) ? MAX_COUNT : n;
+        n -= count;
+        put(count - 1);
+        while (count--)
+            put16(*px++);
+    }
+}
+
+static void put_row(color_t* px, uint n) {
+    uint i = 0;
+    uint literal = 0;       // Start of the pixels not written yet
+
+    while (i < n) {
+        uint run = 1;
+        while (i + run < n && run < MAX_COUNT && px[i + run] == px[i])
+            run++;
+
+        if (run >= MIN_RUN) {
+            put_literal(&px[literal], i - literal);
+            put(0x80 | (run - 1));
+            put16(px[i]);
+            literal = i + run;
+        }
+        i += run;
+    }
+    put_literal(&px[literal], n - literal);
+}
+
+// Fletcher checksum of the row, to tell if it changed
+static uint32 row_sum(color_t* px, uint n) {
+    uint16 a = 0, b = 0;
+    while (n--) {
+        a += *px++;
+        b += a;
+    }
+    return ((uint32)b << 16) | a;
+}
+
+static void encode_row() {
+    ReadScreenBuffer((byte*)pixels, row * ROW_SIZE, ROW_SIZE);
+
+    uint32 sum = row_sum(pixels, DISPLAY_WIDTH);
+    if (!keyframe && sum == row_sums[row]) {
+        skip++;
+    } else {
+        row_sums[row] = sum;
+        put_skip();
+        put(0x80);
+        put_row(pixels, DISPLAY_WIDTH);
+    }
+
+    if (++row == DISPLAY_HEIGHT)
+        put_skip();
+}
+
+static bool frame_due() {
+    gfx_stats_t stats;
+
+    if (keyframe)
+        return true;
+
+    // Only after the screen has been redrawn
+    GetGfxStats(&stats);
+    if (stats.frames == last_frames)
+        return false;
+
+    return (GetSystick() - last_capture) >= interval;
+}
+
+static void start_frame() {
+    gfx_stats_t stats;
+
+    GetGfxStats(&stats);
+    last_frames = stats.frames;
+    last_capture = GetSystick();
+
+    if (frame_number % KEYFRAME_INTERVAL == 0)
+        keyframe = true;
+
+    put(keyframe ? CAPTURE_KEYFRAME : 0);
+    put16(frame_number++);
+    put16((uint16)last_capture);
+    put16((uint16)(last_capture >> 16));
+
+    in_frame = true;
+    frame_start = true;
+    row = 0;
+    skip = 0;
+}
+
+void CaptureStart(uint interval_ms) {
+    interval = interval_ms ? interval_ms : CAPTURE_INTERVAL;
+    frame_number = 0;
+    keyframe = true;
+
+    // Drop the rest of any frame in progress
+    in_frame = false;
+    out_len = 0;
+
+    capture_active = true;
+}
+
+void CaptureStop() {
+    capture_active = false;
+    in_frame = false;
+    out_len = 0;
+}
+
+uint CaptureRead(byte* buf, uint len, bool* frame_start_out) {
+    uint n;
+
+    *frame_start_out = false;
+    if (!capture_active)
+        return 0;
+
+    if (!in_frame) {
+        if (!frame_due())
+            return 0;
+        start_frame();
+    }
+
+    // Fill a whole packet, unless it's the end of the frame
+    while (out_len < len && row < DISPLAY_HEIGHT) {
+        // Wait for the draw task to finish the frame it's on
+        if (!display_frame_ready)
+            return 0;
+        encode_row();
+    }
+
+    n = (out_len < len) ? out_len : len;
+    memcpy(buf, out, n);
+    out_len -= n;
+    memmove(out, out + n, out_len);
+
+    *frame_start_out = frame_start;
+    frame_start = false;
+
+    if (row == DISPLAY_HEIGHT && out_len == 0) {
+        in_frame = false;
+        keyframe = false;
+    }
+    return n;
+}
@@ -0,0 +1,48 @@
+/*
+ * File:   capture.h
+ * Author: Jared
+ *
+ * Screen capture stream.
+ *
+ * While running, frames from the screen buffer are compressed and pushed to the
+ * PC as full USB packets (CMD_DISPLAY_STREAM_*, see comms.h), without a request
+ * for each chunk. tools/screencast.py turns them back into PNGs or a video.
+ *
+ * Stream format (little endian, concatenated packet payloads):
+ *   Frame header:   uint8 flags (CAPTURE_KEYFRAME), uint16 frame number, uint32 systick
+ *   Then row records until all DISPLAY_HEIGHT rows are covered:
+ *     0x00-0x7F    n+1 rows unchanged since the last frame
+ *     0x80         Changed row, followed by pixel runs until DISPLAY_WIDTH are covered:
+ *                    0x00-0x7F   n+1 RGB565 pixels follow
+ *                    0x80-0xFF   n+1 (n = low 7 bits) of the RGB565 pixel that follows
+ *
+ * Each frame starts at the beginning of a packet, and the rest of the packet
+ * after the end of a frame is padding. A row is counted as changed when its
+ * checksum differs from the last frame's, and every row is sent in a keyframe.
+ */
+
+#ifndef CAPTURE_H
+#define	CAPTURE_H
+
+#define CAPTURE_KEYFRAME        0x01    // Frame header flag: every row is sent
+
+#define CAPTURE_INTERVAL        100     // ms - Default time between frames
+#define KEYFRAME_INTERVAL       64      // Frames between keyframes, in case the PC lost one
+
+////////// Properties //////////////////////////////////////////////////////////
+
+extern bool capture_active;
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+// Start (or restart) the stream with a keyframe. Frames are captured at most
+// every 'interval' ms (0 for the default), and only after the screen is redrawn.
+void CaptureStart(uint interval);
+void CaptureStop();
+
+// Fill buf with up to len (at most PACKET_SIZE) bytes of the stream. Less than len
+// is only returned at the end of a frame, and 0 when there's nothing to send yet.
+// frame_start is set if a new frame starts at buf[0].
+uint CaptureRead(byte* buf, uint len, bool* frame_start);
+
+#endif	/* CAPTURE_H */
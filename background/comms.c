@@ -21,6 +21,7 @@
 #include "api/clock.h"
 #include "api/calendar.h"
 #include "background/power_monitor.h"
+#include "background/capture.h"
 #include "api/graphics/gfx.h"
 #include "drivers/ssd1351.h"
 #include "core/printf.h"
@@ -28,8 +29,9 @@
 
 ////////// Defines /////////////////////////////////////////////////////////////
 
-// Run this as fast as possible, since usually it's only
-// checking if data is received and nothing else.
+// The comms task is woken as soon as a USB transfer completes, this
+// poll is so comms_stream() rechecks frame_due() when nothing arrives.
+// Stream frame timing depends on it (timeouts are usb.c's connection_timer).
 #define PROCESS_COMMS_INTERVAL 25
 
 #define SetTxErrorCode(code) (tx_buffer[1] = code)
@@ -46,8 +48,15 @@ comms_status_t comms_status = cmDisconnected;
 
 char tx_buffer[PACKET_SIZE];
 
+// Separate from tx_buffer, which a reply could overwrite while it's being sent
+static char stream_buffer[PACKET_SIZE];
+static uint8 stream_sequence = 0;
+
 static task_t* comms_task;
 
+extern uint num_tasks;
+extern task_t tasks[];
+
 
 ////////// Prototypes //////////////////////////////////////////////////////////
 
@@ -56,6 +65,7 @@ void comms_ReceivedPacket(unsigned char* packet);
 void comms_SendPacket(unsigned char* buffer);
 void comms_sleep();
 void comms_wake();
+void comms_stream();
 
 ////////// Methods /////////////////////////////////////////////////////////////
 
@@ -65,8 +75,7 @@ void InitializeComms() {
     InitializeUSB(&comms_sleep, &comms_wake);
     
     // Communications, only needs to be run when USB is connected
-    comms_task = RegisterTask("Comms", ProcessComms);
-    comms_task->state = tsRun;
+    comms_task = RegisterTask("Comms", ProcessComms, PRIORITY_HIGH, TASK_STACK_SIZE);
 
     usb_connected = false;
     comms_status = cmDisconnected;
@@ -74,7 +83,8 @@ void InitializeComms() {
 
 void comms_sleep() {
     // Called by the USB module when the USB becomes disconnected
-    comms_task->state = tsStop;
+    SuspendTask(comms_task);
+    CaptureStop();
     usb_connected = false;
     comms_status = cmDisconnected;
 
@@ -84,7 +94,7 @@ void comms_sleep() {
 
 void comms_wake() {
     // Called by the USB module when the USB becomes connected
-    comms_task->state = tsRun;
+    ResumeTask(comms_task);
     usb_connected = true;
     comms_status = cmIdle;
 
@@ -94,13 +104,38 @@ void comms_wake() {
 
 void ProcessComms() {
     while (1) {
-        USBProcess(&comms_ReceivedPacket);
+        // While streaming, leave a received packet until its reply can be sent
+        if (!capture_active || !USBTxBusy())
+            USBProcess(&comms_ReceivedPacket);
 
-        //TODO: Implement some sort of variable delay that waits for data transmission
-        Delay(1);
+        comms_stream();
+
+        // Sleep until the USB interrupt signals a transfer
+        SemWait(&usb_transfer_sem, PROCESS_COMMS_INTERVAL);
     }
 }
 
+// Send the next packet of the screen capture stream, if the IN endpoint is free
+void comms_stream() {
+    display_stream_t* tx_packet = (display_stream_t*)stream_buffer;
+    bool frame_start;
+    uint len;
+
+    if (!capture_active || USBTxBusy())
+        return;
+
+    len = CaptureRead(tx_packet->data, sizeof(tx_packet->data), &frame_start);
+    if (len == 0)
+        return;
+
+    // The end of a frame is padded out
+    memset(tx_packet->data + len, 0, sizeof(tx_packet->data) - len);
+
+    tx_packet->command = CMD_DISPLAY_STREAM_DATA;
+    tx_packet->sequence = (stream_sequence++ & 0x7F) | (frame_start ? STREAM_FRAME_START : 0);
+    USBSendPacket(stream_buffer);
+}
+
 void comms_set_led(byte led, byte value) {
     switch (led) {
         case 1:
@@ -120,6 +155,7 @@ void comms_ReceivedPacket(unsigned char* packet) {
     // it might pay to temporarily reduce the task interval.
 
     SetTxErrorCode(ERR_OK);
+    TraceBegin(TRACE_MARK_COMMS, packet[0]);
 
     switch (packet[0]) {
 
@@ -156,9 +192,54 @@ void comms_ReceivedPacket(unsigned char* packet) {
         case CMD_GET_CPU_INFO:
         {
             cpu_info_t* tx_packet = (cpu_info_t*)tx_buffer;
+            cpu_stats_t stats;
+
+            // kernel.h
+            systick_t tick = GetSystick();
+            tx_packet->systick = tick;
+            tx_packet->systick32 = tick;
+            tx_packet->fcy = FCY;
+
+            KernelGetStats(&stats);
+            tx_packet->window_cycles = stats.window_cycles;
+            tx_packet->busy_cycles = stats.busy_cycles;
+            tx_packet->idle_cycles = stats.idle_cycles;
+            tx_packet->sleep_cycles = stats.sleep_cycles;
 
-            // systick.h
-            tx_packet->systick = systick;
+            tx_packet->num_tasks = num_tasks;
+
+            break;
+        }
+
+        case CMD_GET_TASK_INFO:
+        {
+            task_info_t* rx_packet = (task_info_t*)packet;
+            task_info_t* tx_packet = (task_info_t*)tx_buffer;
+
+            uint16 index = rx_packet->index;
+            if (index >= num_tasks) {
+                SetTxErrorCode(ERR_INVALID_INDEX);
+                break;
+            }
+
+            task_t* task = &tasks[index];
+            tx_packet->index = index;
+            strncpy(tx_packet->name, task->name, TASK_NAME_LEN+1);
+            tx_packet->state = task->state;
+            tx_packet->priority = task->priority;
+
+            tx_packet->cpu_cycles = task->cpu_cycles;
+            tx_packet->cpu_usage = task->cpu_usage;
+            tx_packet->cpu_ticks = task->cpu_ticks;
+
+            tx_packet->stack_size = task->stack_size;
+            tx_packet->stack_used = TaskStackUsage(task);
+
+            tx_packet->period = task->period;
+            tx_packet->overruns = task->overruns;
+            tx_packet->jitter_min = task->jitter_min;
+            tx_packet->jitter_max = task->jitter_max;
+            tx_packet->jitter_avg = task->jitter_avg;
 
             break;
         }
@@ -197,9 +278,9 @@ void comms_ReceivedPacket(unsigned char* packet) {
         {
             bool on = packet[1];
             if (on)
-                ssd1351_DisplayOn();
+                ssd1351_DisplayOnAsync(NULL);
             else
-                ssd1351_DisplayOff();
+                ssd1351_DisplayOffAsync(NULL);
 
             break;
         }
@@ -213,6 +294,7 @@ void comms_ReceivedPacket(unsigned char* packet) {
         case CMD_DISPLAY_UNLOCK:
         {
             lock_display = false;
+            RequestRedraw();
             break;
         }
 
@@ -244,6 +326,17 @@ void comms_ReceivedPacket(unsigned char* packet) {
             break;
         }
 
+        case CMD_DISPLAY_STREAM_START:
+        {
+            display_stream_start_t* rx_packet = (display_stream_start_t*)packet;
+            CaptureStart(rx_packet->interval);
+            break;
+        }
+
+        case CMD_DISPLAY_STREAM_STOP:
+            CaptureStop();
+            break;
+
         ////////// Sensors //////////
 
         case CMD_QUERY_SENSORS:
@@ -312,6 +405,7 @@ void comms_ReceivedPacket(unsigned char* packet) {
                 rx_packet->month,
                 rx_packet->year
             );
+            RequestRedraw();
             break;
         }
 
@@ -320,6 +414,7 @@ void comms_ReceivedPacket(unsigned char* packet) {
         case CMD_CLEAR_CALENDAR:
         {
             CalendarClear();
+            RequestRedraw();
             break;
         }
 
@@ -345,6 +440,7 @@ void comms_ReceivedPacket(unsigned char* packet) {
                 break;
             }
 
+            RequestRedraw();
             break;
         }
 
@@ -384,10 +480,65 @@ void comms_ReceivedPacket(unsigned char* packet) {
         }
 
 
+        ////////// Kernel Trace //////////
+
+#ifdef KERNEL_TRACE
+        case CMD_TRACE_START:
+            TraceStart();
+            break;
+
+        case CMD_TRACE_STOP:
+            TraceStop();
+            break;
+
+        case CMD_TRACE_INFO:
+        {
+            trace_info_t* tx_packet = (trace_info_t*)tx_buffer;
+
+            // trace.h
+            tx_packet->enabled = trace_enabled;
+            tx_packet->event_size = sizeof(trace_event_t);
+            tx_packet->capacity = TRACE_BUFFER_LEN;
+            tx_packet->count = trace_count;
+            tx_packet->dropped = trace_dropped;
+
+            tx_packet->fcy = FCY;
+            tx_packet->cycles_per_systick = CYCLES_PER_SYSTICK;
+            tx_packet->num_tasks = num_tasks;
+            break;
+        }
+
+        case CMD_TRACE_READ:
+        {
+            trace_chunk_t* rx_packet = (trace_chunk_t*)packet;
+            trace_chunk_t* tx_packet = (trace_chunk_t*)tx_buffer;
+
+            uint16 index = rx_packet->index;
+            if (index >= trace_count) {
+                SetTxErrorCode(ERR_INVALID_INDEX);
+                break;
+            }
+
+            tx_packet->index = index;
+            tx_packet->count = TraceRead(index, tx_packet->events, TRACE_EVENTS_PER_PACKET);
+            break;
+        }
+#else
+        case CMD_TRACE_START:
+        case CMD_TRACE_STOP:
+        case CMD_TRACE_INFO:
+        case CMD_TRACE_READ:
+            SetTxErrorCode(ERR_NOT_IMPLEMENTED);
+            break;
+#endif
+
         default:
+            TraceEnd(TRACE_MARK_COMMS);
             return; // Don't send any response
     }
 
+    TraceEnd(TRACE_MARK_COMMS);
+
     tx_buffer[0] = packet[0]; // Set command field
     USBSendPacket(tx_buffer);
 }
\ No newline at end of file
@@ -12,6 +12,8 @@
 #include "background/power_monitor.h"
 #include "api/clock.h"
 #include "api/calendar.h" // MAX_LABEL_LEN, MAX_LOCATION_LEN
+#include "core/kernel.h" // TASK_NAME_LEN
+#include "core/trace.h"
 
 #define CMD_PING                0x01
 #define CMD_RESET               0x02
@@ -21,6 +23,7 @@
 #define CMD_GET_BATTERY_INFO    0x10    // Battery voltage, VDD, levels, status
 #define CMD_GET_CPU_INFO        0x11    // Osc freq, systick, utilization, time spent in sleep
 #define CMD_GET_NEXT_MESSAGE    0x12    // Next debug message in the buffer
+#define CMD_GET_TASK_INFO       0x13    // Name, priority, CPU time and stack usage of a kernel task
 
 // Display interface
 #define CMD_QUERY_DISPLAY       0x20    // Returns parameters of the display
@@ -29,6 +32,9 @@
 #define CMD_DISPLAY_UNLOCK      0x23
 #define CMD_DISPLAY_WRITEBUF    0x24    // Update the display buffer with some custom data
 #define CMD_DISPLAY_READBUF     0x25    // Retrieve the contents of the display buffer
+#define CMD_DISPLAY_STREAM_START 0x26   // Start pushing compressed frames (see capture.h)
+#define CMD_DISPLAY_STREAM_STOP 0x27
+#define CMD_DISPLAY_STREAM_DATA 0x28    // Sent by the watch while the stream is running
 
 // Sensors
 #define CMD_QUERY_SENSORS       0x30    // Return a list of available sensors
@@ -45,6 +51,12 @@
 #define CMD_GET_CALENDAR_INFO   0x52
 #define CMD_GET_CALENDAR_EVT    0x53
 
+// Kernel trace (only available if KERNEL_TRACE is defined, see trace.h)
+#define CMD_TRACE_START         0x60    // Clear the trace buffer and start recording
+#define CMD_TRACE_STOP          0x61    // Stop recording, so the buffer can be read
+#define CMD_TRACE_INFO          0x62    // Number of events recorded, clock rates
+#define CMD_TRACE_READ          0x63    // Retrieve a chunk of events from the buffer
+
 // Error codes
 #define ERR_OK                  0x00
 #define ERR_UNKNOWN             0x01
@@ -87,10 +99,44 @@ typedef struct __attribute__((packed, __may_alias__)) {
     byte command;
     byte error;
 
-    uint16 systick;
-    //TODO: add more fields
+    uint16 systick;         // Lower 16 bits of systick
+
+    uint32 fcy;             // Instruction clock frequency (Hz)
+    uint32 systick32;       // Full 32-bit systick
+
+    // Measured over the last CALC_CPU_TICKS window
+    uint32 window_cycles;
+    uint32 busy_cycles;     // All tasks except idle
+    uint32 idle_cycles;     // Awake in the idle task
+    uint32 sleep_cycles;    // Sleep mode
+
+    uint16 num_tasks;
 } cpu_info_t;
 
+typedef struct __attribute__((packed, __may_alias__)) {
+    byte command;
+    byte error;
+
+    uint16 index;
+    char name[TASK_NAME_LEN+1];
+    uint8 state;            // task_state_t
+    uint8 priority;
+
+    uint32 cpu_cycles;      // Cycles run over the last CALC_CPU_TICKS window
+    uint16 cpu_usage;       // Per-mille of the window
+    uint16 cpu_ticks;       // Number of times switched in over the window
+
+    uint16 stack_size;
+    uint16 stack_used;      // Peak stack usage, in bytes
+
+    // Periodic tasks (period is 0 for other tasks)
+    uint16 period;          // ms
+    uint16 overruns;
+    uint16 jitter_min;      // Release latency (us)
+    uint16 jitter_max;
+    uint16 jitter_avg;
+} task_info_t;
+
 typedef struct __attribute__((packed, __may_alias__)) {
     byte command;
     byte error;
@@ -114,6 +160,22 @@ typedef struct __attribute__((packed, __may_alias__)) {
     byte buf[DISP_CHUNK_SIZE];
 } display_chunk_t;
 
+typedef struct __attribute__((packed, __may_alias__)) {
+    byte command;
+    byte error;
+
+    uint16 interval;    // Minimum ms between frames (0 for the default)
+} display_stream_start_t;
+
+// The sequence number lets the PC notice a lost packet, and wait for the next keyframe
+#define STREAM_FRAME_START 0x80
+typedef struct __attribute__((packed, __may_alias__)) {
+    byte command;       // CMD_DISPLAY_STREAM_DATA
+    byte sequence;      // Packet count (bits 0-6), STREAM_FRAME_START if data[0] starts a frame
+
+    byte data[PACKET_SIZE-2];
+} display_stream_t;
+
 typedef struct __attribute__((packed, __may_alias__)) {
     byte command;
     byte error;
@@ -180,6 +242,32 @@ typedef struct __attribute__((packed, __may_alias__)) {
     uint16 num_events;
 } calendar_info_packet_t;
 
+#define TRACE_EVENTS_PER_PACKET 7
+
+typedef struct __attribute__((packed, __may_alias__)) {
+    byte command;
+    byte error;
+
+    uint8 enabled;
+    uint8 event_size;           // sizeof(trace_event_t)
+    uint16 capacity;            // TRACE_BUFFER_LEN
+    uint16 count;               // Number of events in the buffer
+    uint32 dropped;             // Events overwritten because the buffer was full
+
+    uint32 fcy;                 // Timestamps are in instruction cycles
+    uint16 cycles_per_systick;  // Used to convert TRACE_SLEEP events
+    uint16 num_tasks;
+} trace_info_t;
+
+typedef struct __attribute__((packed, __may_alias__)) {
+    byte command;
+    byte error;
+
+    uint16 index;               // Index of the first event (0 is the oldest)
+    uint16 count;               // Number of events in this packet
+    trace_event_t events[TRACE_EVENTS_PER_PACKET];
+} trace_chunk_t;
+
 typedef enum {
     cmDisconnected,     // USB not connected
     cmIdle,             // Not doing anything, use a low priority
@@ -10,6 +10,7 @@
 #include <system.h>
 #include "cpu.h"
 #include "hardware.h"
+#include "drivers/ssd1351.h"
 
 // Sleep mode stops clock operation and halts all code execution
 // Idle mode halts the CPU and code execution, but allows peripheral
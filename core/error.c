@@ -42,9 +42,16 @@ void CriticalError(const char* msg) {
     UpdateDisplay();
 
     // Gather some kernel diagnostics
-    DrawString("Task:", 8,58, WHITE);
-    DrawString(task->name, 45,58, WHITE);
-    UpdateDisplay();
+    if (task != NULL) {
+        DrawString("Task:", 8,58, WHITE);
+        DrawString(task->name, 45,58, WHITE);
+        UpdateDisplay();
+    }
+
+#ifdef POSIX
+    // Nobody is there to press a button
+    HostCriticalError(msg, (task != NULL) ? task->name : NULL);
+#endif
 
     while (!_PORT(BTN1) && !_PORT(BTN2) && !_PORT(BTN3) && !_PORT(BTN4));
     while (_PORT(BTN1) || _PORT(BTN2) || _PORT(BTN3) || _PORT(BTN4));
@@ -68,6 +75,16 @@ void isr _AddressError() {
 }
 
 void isr _StackError() {
+    // The task has run past its stack limit, so there isn't enough room to
+    // report the error. Switch back to the system stack used by main() first.
+#ifndef POSIX
+    asm volatile(
+        "mov #__SPLIM_init, w0\n"
+        "mov w0, SPLIM\n"
+        "mov #__SP_init, w15\n"
+        "nop"
+    );
+#endif
     CriticalError("Trap: Stack Error");
 }
 
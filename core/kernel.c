@@ -15,26 +15,42 @@
 #include "kernel.h"
 #include "hardware.h"
 #include "background/comms.h"
+#include "core/error.h"
+#include "core/trace.h"
 
 ////////// Variables ///////////////////////////////////////////////////////////
 
 task_t tasks[MAX_TASKS] __attribute__((section(".data.tasks")));
 
 uint num_tasks = 0;
-uint anext_task = MAX_UINT;
 task_t* current_task;
-uint current_task_index = 0;
 
-uint16 stack_base = 0;
-uint16 current_stack_base = 0;
-uint16 task_sp = 0;
-//uint16 kernel_sp = 0;
+// Ready queues, one FIFO per priority level.
+// Bit n of ready_bitmap is set when ready_head[n] is not empty.
+static uint16 ready_bitmap = 0;
+static task_t* ready_head[NUM_PRIORITIES];
+static task_t* ready_tail[NUM_PRIORITIES];
+
+// Tasks waiting on a Delay()/WaitUntil(), sorted by wake-up time.
+// Each task's wake_delta is the number of ticks after the task in front of it,
+// and the head's wake_delta is relative to sleep_tick.
+static task_t* sleeping_tasks = NULL;
+static systick_t sleep_tick = 0;
+
+// Set when a task with a higher priority than the current task has been woken
+static bool preempt_pending = false;
+
+// Task stacks are carved out of this pool by RegisterTask.
+// The stack grows upwards, from stack_base towards stack_limit.
+static uint16 task_stack_pool[TASK_STACK_POOL_SIZE/2] __attribute__((noload));
+static uint task_stack_used = 0;
 
 task_t* idle_task;
 extern task_t* draw_task;
-extern task_t* core_task;
 
-uint cpu_tick_counter = 0;
+static systick_t cpu_window_start = 0;
+static uint32 last_switch_cycles = 0;
+static cpu_stats_t cpu_stats;
 uint total_cpu_ticks = 0;
 
 uint cpu_tick_history_idx = 0;
@@ -44,6 +60,7 @@ uint cpu_tick_history[CPU_TICK_HISTORY_LEN];
 
 void KernelIdleTask();
 void KernelProcess();
+static void wait_release(task_t* task, bool timed_out);
 
 // Defined in kernel.s
 extern void KernelSwitchContext();
@@ -53,6 +70,9 @@ extern void KernelStartTask(task_t* sp);
 
 #define KernelSwitchToTask(task) current_task = task; task->ticks++
 
+// Highest priority with a ready task (ff1l counts from the MSB, starting at 1)
+#define HighestReadyPriority() (16 - __builtin_ff1l(ready_bitmap))
+
 ////////// Code ////////////////////////////////////////////////////////////////
 
 #if SYSTICK_PR > 0xFFFF
@@ -62,12 +82,12 @@ extern void KernelStartTask(task_t* sp);
 #endif
 
 
-volatile uint __attribute__((near)) systick = 1;
+volatile systick_t __attribute__((near)) systick = 1;
 
-// Note: since we want to stop the systick interrupt from waking the CPU
-// out of sleep mode, we'll need to add the number of ticks spent sleeping somehow?
-// or maybe turn down the timer rate while it sleeps in case an asynchronous interrupt
-// wakes the processor (eg. accelerometer interrupt)
+// Note: in tickless mode the systick interrupt is suppressed while the CPU sleeps,
+// and the number of ticks spent sleeping is added back on wake (see KernelSleep).
+// An asynchronous interrupt (eg. button or accelerometer) can wake the CPU early,
+// in which case only the ticks that actually elapsed are added.
 
 void systick_init() {
     // Configure a system tick timer with interrupt
@@ -80,7 +100,7 @@ void systick_init() {
     T1CON =  T1_OFF & T1_IDLE_CON & T1_GATE_OFF & T1_PS_1_1 & T1_SYNC_EXT_OFF & T1_SOURCE_EXT;
 
     TMR1 = 0x0000;
-    PR1 = 32;  // 32.768kHz / 32 = 1024Hz = 1 tick per 976ms
+    PR1 = SYSTICK_TMR_PERIOD;  // 32.768kHz / 32 = 1024Hz = 1 tick per 976us
 
     _T1IF = 0;
     _T1IP = 1; // Low priority so it doesn't pre-empt other interrupts
@@ -89,61 +109,391 @@ void systick_init() {
     T1CONbits.TON = 1;
 }
 
-void InitializeKernel(void) {
-    current_stack_base = stack_base;
+void cycle_timer_init() {
+    // Free-running 32-bit instruction cycle counter (Timer2/3),
+    // used to measure how long each task runs for.
+    // It stops while the CPU is in Sleep mode, but keeps running in Idle mode.
 
+    _T2MD = 0;
+    _T3MD = 0;
+
+    T2CON = 0;
+    T3CON = 0;
+    TMR3 = 0;
+    TMR2 = 0;
+    PR3 = 0xFFFF;
+    PR2 = 0xFFFF;
+
+    T2CONbits.T32 = 1;  // Timer2/3 as a single 32-bit timer, 1:1 prescale from FCY
+    T2CONbits.TON = 1;
+}
+
+void InitializeKernel(void) {
     // IMPORTANT: The idle task MUST be the first task registered,
-    //  and its state MUST be set to tsStop.
-    idle_task = RegisterTask("idle", KernelIdleTask);
-    idle_task->state = tsStop;
+    //  and it must never be put in a ready queue (state is tsStop).
+    //  It is only run when no other tasks are ready.
+    // Its stack only needs to fit the context and any ISRs that interrupt it.
+    idle_task = RegisterTask("idle", KernelIdleTask, PRIORITY_IDLE, 256);
+    SuspendTask(idle_task);
+}
+
+static void ready_push(task_t* task) {
+    uint8 pri = task->priority;
+
+    task->next = NULL;
+    if (ready_head[pri] == NULL)
+        ready_head[pri] = task;
+    else
+        ready_tail[pri]->next = task;
+    ready_tail[pri] = task;
+
+    ready_bitmap |= (1 << pri);
+}
+
+static task_t* ready_pop(uint8 pri) {
+    task_t* task = ready_head[pri];
+
+    ready_head[pri] = task->next;
+    if (ready_head[pri] == NULL)
+        ready_bitmap &= ~(1 << pri);
+
+    task->next = NULL;
+    return task;
+}
+
+static void ready_remove(task_t* task) {
+    uint8 pri = task->priority;
+    task_t* prev = NULL;
+    task_t* t = ready_head[pri];
+
+    while (t != NULL && t != task) {
+        prev = t;
+        t = t->next;
+    }
+    if (t == NULL) return;
+
+    if (prev == NULL)
+        ready_head[pri] = task->next;
+    else
+        prev->next = task->next;
+    if (ready_tail[pri] == task)
+        ready_tail[pri] = prev;
+    if (ready_head[pri] == NULL)
+        ready_bitmap &= ~(1 << pri);
+
+    task->next = NULL;
+}
+
+// Bring the sleeping queue up to date with systick,
+// moving any tasks whose deadline has passed into the ready queues.
+static void wake_sleeping_tasks() {
+    systick_t elapsed = systick - sleep_tick;
+    sleep_tick = systick;
+
+    while (sleeping_tasks != NULL) {
+        task_t* task = sleeping_tasks;
+
+        if (task->wake_delta > elapsed) {
+            task->wake_delta -= elapsed;
+            return;
+        }
+
+        elapsed -= task->wake_delta;
+        sleeping_tasks = task->next;
+
+        if (task->state == tsWait)
+            wait_release(task, true); // Timed out waiting on a kernel object
+        else
+            ready_push(task);
+    }
+}
+
+// Insert a task into the sleeping queue, sorted by next_run.
+// wake_sleeping_tasks() must have been called first, so the head is relative to systick.
+static void sleep_insert(task_t* task) {
+    systick_t delta = task->next_run - sleep_tick;
+    task_t** link = &sleeping_tasks;
+
+    // Tasks with the same deadline are woken in the order they went to sleep
+    while (*link != NULL && (*link)->wake_delta <= delta) {
+        delta -= (*link)->wake_delta;
+        link = &(*link)->next;
+    }
+
+    if (*link != NULL)
+        (*link)->wake_delta -= delta;
+
+    task->wake_delta = delta;
+    task->next = *link;
+    *link = task;
+}
+
+static void sleep_remove(task_t* task) {
+    task_t** link = &sleeping_tasks;
+
+    while (*link != NULL) {
+        if (*link == task) {
+            // Give the remaining delay to the next task so its deadline doesn't change
+            *link = task->next;
+            if (task->next != NULL)
+                task->next->wake_delta += task->wake_delta;
+            task->next = NULL;
+            return;
+        }
+        link = &(*link)->next;
+    }
+}
+
+static void wait_remove(task_t* task) {
+    task_t** link = task->wait_list;
+
+    while (*link != NULL) {
+        if (*link == task) {
+            *link = task->wait_next;
+            break;
+        }
+        link = &(*link)->wait_next;
+    }
+
+    task->wait_list = NULL;
+    task->wait_next = NULL;
+}
+
+// Make a blocked task ready to run again
+static void wait_release(task_t* task, bool timed_out) {
+    wait_remove(task);
+
+    if (task->wait_timeout && !timed_out)
+        sleep_remove(task);
+    task->wait_timeout = timed_out;
+
+    // The wait deadline is stale now (or never, for WAIT_FOREVER), and the
+    // scheduler would put the task back to sleep until it if it was preempted
+    task->next_run = systick;
+    task->state = tsRun;
+    ready_push(task);
+
+    if (task->priority > current_task->priority)
+        preempt_pending = true;
+}
+
+bool KernelWait(task_t** wait_list, uint timeout) {
+    // Block the current task until it is woken through the wait list,
+    // or the timeout (in systicks) expires. Returns false on timeout.
+    task_t* task = current_task;
+    task_t** link = wait_list;
+
+    if (timeout == 0)
+        return false;
+
+    // Waiters are woken in the order they arrived
+    while (*link != NULL)
+        link = &(*link)->wait_next;
+    *link = task;
+
+    task->wait_list = wait_list;
+    task->wait_next = NULL;
+    task->wait_timeout = (timeout != WAIT_FOREVER);
+    task->next_run = systick + timeout;
+    task->state = tsWait;
+
+    Trace(TRACE_WAIT, task - tasks, timeout);
+
+    // Returns once the task has been woken up (with interrupts enabled)
+    KernelSwitchContext();
+
+    return !task->wait_timeout;
+}
+
+void KernelWakeOne(task_t** wait_list) {
+    if (*wait_list != NULL)
+        wait_release(*wait_list, false);
+}
+
+void KernelWakeAll(task_t** wait_list) {
+    while (*wait_list != NULL)
+        wait_release(*wait_list, false);
+}
+
+void KernelPreempt() {
+    // Tasks always run at IPL 0, so a non-zero IPL means we are in an ISR.
+    // In that case the switch happens on the next systick instead.
+    if (preempt_pending && SRbits.IPL == 0) {
+        Delay(0);
+    }
+}
+
+void ResumeTask(task_t* task) {
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+
+    if (task->state == tsStop) {
+        task->state = tsRun;
+        task->next_run = systick;
+        task->release = systick; // Periodic tasks start a new set of releases
+
+        // The current task is re-queued by the scheduler when it is switched out
+        if (task != current_task)
+            ready_push(task);
+    }
+
+    RESTORE_CPU_IPL(ipl);
+}
+
+void SuspendTask(task_t* task) {
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+
+    if (task->state != tsStop) {
+        task->state = tsStop;
+
+        // Remove from whichever queue it is waiting in
+        ready_remove(task);
+        sleep_remove(task);
+        if (task->wait_list != NULL) {
+            wait_remove(task);
+            task->wait_timeout = true; // The wait returns as if it timed out
+        }
+    }
+
+    RESTORE_CPU_IPL(ipl);
 }
 
-task_t* RegisterTask(char* name, task_proc_t proc) {
+task_t* RegisterTask(char* name, task_proc_t proc, uint8 priority, uint stack_size) {
     task_t* task = &tasks[num_tasks++];
+    uint16* stack;
+    uint i;
 
     // Assign some stack space to this task
-    current_stack_base += TASK_STACK_SIZE;
-    task->sp = current_stack_base;
-    task->stack_base = current_stack_base;
-    task->stack_size = TASK_STACK_SIZE;
-    
-	uint i=0;
-	for (i=0; i<TASK_NAME_LEN && *name; i++)
-		task->name[i] = *name++;
+    stack_size = (stack_size + 1) & ~1; // Word aligned
+    if (task_stack_used + stack_size > TASK_STACK_POOL_SIZE)
+        CriticalError("Out of stack space");
+
+    stack = &task_stack_pool[task_stack_used / 2];
+    task_stack_used += stack_size;
+
+    task->sp = (uint16)(size_t)stack;
+    task->stack_base = stack;
+    task->stack_size = stack_size;
+
+    // Trap (see _StackError) before the stack runs into the next task's stack,
+    // leaving enough room for the trap to push its return address.
+    task->stack_limit = task->sp + stack_size - TASK_STACK_GUARD;
+
+    // Paint the stack so we can tell how much of it gets used
+    for (i=0; i<stack_size/2; i++)
+        stack[i] = TASK_STACK_PAINT;
+
+    for (i=0; i<TASK_NAME_LEN && *name; i++)
+        task->name[i] = *name++;
     task->name[TASK_NAME_LEN] = '\0';
 
     task->proc = proc;
     task->state = tsRun;
+    task->priority = priority;
 
     task->ticks = 0;
     task->next_run = 0;
+    task->next = NULL;
+    task->wait_list = NULL;
+    task->wait_next = NULL;
+    task->wait_timeout = false;
     task->cpu_ticks = 0;
     task->cpu_usage = 0;
+    task->cycles = 0;
+    task->cpu_cycles = 0;
+    task->period = 0;
 
     //task->cpu_history_idx = 0;
 
     KernelInitTaskStack(task, task->proc);
 
+    ready_push(task);
+
+    return task;
+}
+
+task_t* RegisterPeriodicTask(char* name, task_proc_t proc, uint8 priority, uint stack_size, uint period) {
+    task_t* task = RegisterTask(name, proc, priority, stack_size);
+    SetTaskPeriod(task, period);
     return task;
 }
 
-void fix_rollover(uint last_tick) {
+void SetTaskPeriod(task_t* task, uint period) {
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    task->period = period;
+    task->release = systick;
+    task->overruns = 0;
+    task->jitter_min = MAX_UINT;
+    task->jitter_max = 0;
+    task->jitter_avg = 0;
+    RESTORE_CPU_IPL(ipl);
+}
+
+void KernelGetStats(cpu_stats_t* stats) {
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    *stats = cpu_stats;
+    RESTORE_CPU_IPL(ipl);
+}
+
+static void update_cpu_stats() {
+    // Called at the end of each CALC_CPU_TICKS window.
+    // Any time that wasn't measured by the cycle timer was spent in Sleep mode.
+    systick_t window_ticks = systick - cpu_window_start;
+    uint32 window = window_ticks * CYCLES_PER_SYSTICK;
+    uint32 permille = window / 1000;
+    uint32 busy = 0;
     uint i;
+
+    cpu_window_start = systick;
+
     for (i=0; i<num_tasks; i++) {
         task_t* task = &tasks[i];
-        if (task->next_run > last_tick)
-            task->next_run -= last_tick;
-        else if (task->next_run > 0)
-            task->next_run = 0;
-        // else rollover will have corrected it
+
+        task->cpu_cycles = task->cycles;
+        task->cpu_usage = task->cycles / permille;
+        task->cpu_ticks = task->ticks;
+        if (i) busy += task->cycles; // Skip the idle task
+
+        task->cycles = 0;
+        task->ticks = 0;
     }
+
+    cpu_stats.window_cycles = window;
+    cpu_stats.busy_cycles = busy;
+    cpu_stats.idle_cycles = idle_task->cpu_cycles;
+    cpu_stats.sleep_cycles = (busy + idle_task->cpu_cycles < window) ? window - busy - idle_task->cpu_cycles : 0;
+
+    cpu_stats.cpu_usage = busy / permille;
+    cpu_stats.idle_usage = cpu_stats.idle_cycles / permille;
+    cpu_stats.sleep_usage = cpu_stats.sleep_cycles / permille;
+
+    // Add current CPU utilization to the history buffer
+    total_cpu_ticks = cpu_stats.cpu_usage;
+    cpu_tick_history[cpu_tick_history_idx] = total_cpu_ticks;
+    if (++cpu_tick_history_idx == CPU_TICK_HISTORY_LEN)
+        cpu_tick_history_idx = 0;
+}
+
+uint TaskStackUsage(task_t* task) {
+    // The stack grows upwards, so find the highest word that has been written to
+    uint16* stack = task->stack_base;
+    uint i = task->stack_size / 2;
+
+    while (i > 0 && stack[i-1] == TASK_STACK_PAINT)
+        i--;
+
+    return i * 2;
 }
 
 void KernelStart() {
     systick_init();
+    cycle_timer_init();
+    cpu_window_start = systick;
 
     // Initialize the kernel
-    current_task_index = 0;
     current_task = idle_task;
     KernelStartTask(idle_task);
 
@@ -151,18 +501,111 @@ void KernelStart() {
     Reset(); // Safety trap
 }
 
+uint KernelNextWakeup() {
+    // The next deadline is always at the head of the sleeping queue
+    if (ready_bitmap)
+        return 0;
+
+    if (sleeping_tasks == NULL)
+        return MAX_UINT;
+
+    systick_t elapsed = systick - sleep_tick;
+    if (sleeping_tasks->wake_delta <= elapsed)
+        return 0;
+
+    systick_t ticks = sleeping_tasks->wake_delta - elapsed;
+    return (ticks > MAX_UINT) ? MAX_UINT : ticks;
+}
+
+static inline void KernelPowerSave() {
+    if (usb_connected) {
+        // Use Idle mode if connected to USB, because Sleep mode will kill the connection.
+        Idle();
+    } else {
+        Sleep();
+        //Idle();
+    }
+}
+
+#ifdef TICKLESS_IDLE
+static void KernelSleep() {
+    // Sleep until the next task deadline without waking up on every systick.
+    // The CPU priority is raised so the systick ISR (and any other interrupt)
+    // can't run until systick has been caught up. Masked interrupts still
+    // wake the CPU from Sleep/Idle, and are serviced once the priority is restored.
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+
+    uint ticks = KernelNextWakeup();
+    bool deep_sleep = !usb_connected; // KernelPowerSave() will use Sleep mode
+
+    // Not worth reprogramming the timer, a systick is already pending, or the
+    // last sleep was cut short and its period hasn't reached the tick boundary yet
+    if (ticks < TICKLESS_MIN_TICKS || _T1IF || PR1 != SYSTICK_TMR_PERIOD) {
+        RESTORE_CPU_IPL(ipl);
+        KernelPowerSave();
+        return;
+    }
+    if (ticks > TICKLESS_MAX_TICKS)
+        ticks = TICKLESS_MAX_TICKS;
+
+    // Stretch the current systick period out to the deadline, keeping the counts
+    // that have already elapsed in this tick. Timer1 is never stopped or written,
+    // because SOSC counts that arrive while it's stopped would be lost.
+    PR1 = ticks * SYSTICK_TMR_COUNTS - 1;
+    if (_T1IF) {
+        // The tick ended just before PR1 was written, so let the ISR count it
+        PR1 = SYSTICK_TMR_PERIOD;
+        RESTORE_CPU_IPL(ipl);
+        return;
+    }
+
+    ClrWdt();
+    KernelPowerSave();
+
+    uint counts = TMR1;
+    uint elapsed = 0;
+
+    if (!_T1IF) {
+        // Woken early by another interrupt (CN, ADC, USB...)
+        elapsed = counts / SYSTICK_TMR_COUNTS;
+
+        // End the stretched period at the next tick boundary, where the ISR
+        // counts the tick and goes back to one interrupt per systick. If that's
+        // the very next count, it could happen before PR1 is written, so skip on
+        // to the following boundary and count this tick here.
+        if (counts % SYSTICK_TMR_COUNTS == SYSTICK_TMR_PERIOD)
+            elapsed++;
+        PR1 = (elapsed + 1) * SYSTICK_TMR_COUNTS - 1;
+    }
+
+    // Checked again in case the deadline was reached while PR1 was being moved
+    if (_T1IF) {
+        // Slept all the way to the deadline, and Timer1 has started the next tick
+        _T1IF = 0;
+        elapsed = ticks;
+        PR1 = SYSTICK_TMR_PERIOD;
+    }
+
+    systick += elapsed * SYSTICK_PERIOD;
+
+    // The cycle counter was stopped, so the trace needs to know how long for
+    if (deep_sleep)
+        Trace(TRACE_SLEEP, 0, elapsed);
+
+    RESTORE_CPU_IPL(ipl);
+}
+#else
+#define KernelSleep() KernelPowerSave()
+#endif
+
 void KernelIdleTask() {
     // This task runs whenever nothing else needs to run.
 
     while (1) {
-        // Go to sleep for a bit... (will wake up on systick)
-        if (usb_connected) {
-            // Use Idle mode if connected to USB, because Sleep mode will kill the connection.
-            Idle();
-        } else {
-            Sleep();
-            //Idle();
-        }
+        // Go to sleep until the next task needs to run
+        // (or every systick if TICKLESS_IDLE is not defined)
+        KernelSleep();
 
         // Average current (screen off):
         //  Sleep: 2.85mA
@@ -178,80 +621,126 @@ void KernelIdleTask() {
 void KernelSwitchTask() {
     // NOTE: Called directly from the kernel core (see kernel_asm.s)
     // The kernel will automatically push the current task's registers
-    // onto the stack, then store the stack pointer to 'task_sp'.
+    // onto the stack, then store the stack pointer in 'current_task->sp'.
 
     ClrWdt();
 
-    static uint last_tick;
-    uint i;
+    // Charge the time since the last switch to the task being switched out
+    uint32 now = ReadCycleCounter();
+    current_task->cycles += now - last_switch_cycles;
+    last_switch_cycles = now;
 
-    // Rollover occurred (should occur roughly every 65 seconds)
-    if (last_tick > systick) {
-        fix_rollover(last_tick);
+    if (TickDiff(systick, cpu_window_start) >= CALC_CPU_TICKS) {
+        update_cpu_stats();
     }
-    last_tick = systick;
-
-    if (cpu_tick_counter == CALC_CPU_TICKS) {
-        cpu_tick_counter = 0;
-        total_cpu_ticks = 0;
-        for (i=0; i<num_tasks; i++) {
-            task_t* task = &tasks[i];
-            //task->cpu_usage = task->cpu_ticks * 1000 / CALC_CPU_TICKS;
-            task->cpu_ticks = task->ticks;
-            if (i) total_cpu_ticks += task->ticks; // Skip the idle task
-            task->ticks = 0;
-        }
 
-        // Add current CPU utilization to the history buffer
-        cpu_tick_history[cpu_tick_history_idx] = total_cpu_ticks;
-        if (cpu_tick_history_idx++ == CPU_TICK_HISTORY_LEN)
-            cpu_tick_history_idx = 0;
+    // Wake up any tasks whose delay has expired
+    wake_sleeping_tasks();
+
+    // Put the task we just switched out of back in its queue
+    // (unless it has been stopped or it is the idle task)
+    if (current_task != idle_task) {
+        if (current_task->state == tsRun) {
+            if (TickBefore(systick, current_task->next_run))
+                sleep_insert(current_task);
+            else
+                ready_push(current_task);
+        } else if (current_task->state == tsWait && current_task->wait_timeout) {
+            // Blocked with a timeout, so it also needs to be woken by the sleeping queue
+            sleep_insert(current_task);
+        }
     }
-    cpu_tick_counter++;
-
-    // Find the next task that needs to be run
-    uint start_index = current_task_index;
-    do {
-        current_task_index++;
-
-        if (current_task_index == num_tasks)
-            current_task_index = 0;
+    preempt_pending = false;
 
-        task_t* task = &tasks[current_task_index];
+    // Run the highest priority ready task.
+    // Tasks of the same priority are taken in turn from the front of the queue.
+    if (ready_bitmap) {
+        task_t* task = ready_pop(HighestReadyPriority());
 
-        if (task->state == tsRun) {
-            if (systick >= task->next_run) {
-                task->next_run = systick;// + 50;
-
-                _LAT(LED2) = 1;
-                KernelSwitchToTask(task);
-                return;
-            }
-        }
-
-    } while (current_task_index != start_index);
+        Trace(TRACE_SWITCH, task - tasks, current_task - tasks);
+        _LAT(LED2) = 1;
+        KernelSwitchToTask(task);
+        return;
+    }
 
     // If no tasks need to be run, go to the idle task (puts the MCU into sleep mode)
+    Trace(TRACE_SWITCH, idle_task - tasks, current_task - tasks);
     _LAT(LED2) = 0;
     KernelSwitchToTask(idle_task);
 
     // Upon returning, the kernel will switch the stack to the pointer
-    // in 'task_sp', then pop the task's registers back, and continue
+    // in 'current_task->sp', then pop the task's registers back, and continue
     // where the task was left off.
 }
 
 void Delay(uint millis) {
     // Delay for the specified amount of time, allowing other tasks to execute.
     // If t=0, it just forces a context switch
-    current_task->next_run = systick + millis;
+    Trace(TRACE_DELAY, current_task - tasks, millis);
+    current_task->next_run = GetSystick() + millis;
     KernelSwitchContext();
 }
 
-void WaitUntil(uint tick) {
+void WaitUntil(systick_t tick) {
     // Wait until systick reaches the specified value.
     // Useful for functions that take a long or variable amount of time to execute,
     // but are required to execute periodically (eg. 10Hz)
-    // If tick < current systick, the task will execute in the next available slot.
+    // If tick has already passed, the task will execute in the next available slot.
     current_task->next_run = tick;
     KernelSwitchContext();
-}
\ No newline at end of file
+}
+
+static uint release_latency(systick_t release) {
+    // Time since the release, to the resolution of Timer1 (~30us).
+    // TMR1 is the time into the current systick, except after a tickless sleep was
+    // cut short, when PR1 ends the period at the current tick's boundary instead.
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    uint counts = TMR1 - (PR1 - SYSTICK_TMR_PERIOD);
+    systick_t tick = systick;
+    if (_T1IF) {
+        // Systick is about to be incremented
+        tick++;
+        counts = TMR1;
+    }
+    RESTORE_CPU_IPL(ipl);
+
+    if (tick - release > 60)
+        return MAX_UINT; // Don't overflow the conversion
+
+    uint32 us = ((tick - release) * SYSTICK_TMR_COUNTS + counts) * 15625UL / 512; // * 1000000/32768
+    return (us > MAX_UINT) ? MAX_UINT : us;
+}
+
+bool WaitNextPeriod() {
+    task_t* task = current_task;
+    bool on_time = true;
+    systick_t now = GetSystick();
+
+    // Not a periodic task, so there's no release to wait for
+    if (task->period == 0) {
+        Delay(0);
+        return true;
+    }
+
+    task->release += task->period;
+
+    if (TickBefore(task->release, now)) {
+        // The task took longer than its period. Skip the releases
+        // that have already passed, keeping the original phase.
+        systick_t missed = (now - task->release) / task->period;
+        task->release += (missed + 1) * task->period;
+        task->overruns++;
+        on_time = false;
+    }
+
+    WaitUntil(task->release);
+
+    // Measure how late the task was started after its release
+    uint jitter = release_latency(task->release);
+    if (jitter < task->jitter_min) task->jitter_min = jitter;
+    if (jitter > task->jitter_max) task->jitter_max = jitter;
+    task->jitter_avg = task->jitter_avg - (task->jitter_avg >> 3) + (jitter >> 3);
+
+    return on_time;
+}
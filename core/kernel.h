@@ -15,18 +15,46 @@
 #define SYSTICK_PERIOD 1        //ms  (Note: It is recommended you keep it at 1ms or timings will be wrong)
 #define SYSTICK_PRESCALER 8     // 1, 8, 64, 256
 
+// Timer1 is clocked from the 32.768kHz SOSC, so it keeps counting in sleep mode
+#define SYSTICK_TMR_PERIOD 32                       // PR1 value for a single systick
+#define SYSTICK_TMR_COUNTS (SYSTICK_TMR_PERIOD+1)   // Timer1 counts per systick
+
+// Tickless idle: instead of waking up on every systick, the idle task
+// programs Timer1 to expire at the next task deadline and catches systick up on wake.
+#define TICKLESS_IDLE
+#define TICKLESS_MIN_TICKS 2                        // Don't bother suppressing ticks for shorter sleeps
+#define TICKLESS_MAX_TICKS (0xFFFF / SYSTICK_TMR_COUNTS - 1) // Longest sleep Timer1 can measure (plus a tick to end on)
+
 #define TASK_NAME_LEN 6         // Maximum chars allocated for a task's name
 
-// IMPORTANT: If you increase the stack size, make sure you also increase the allocated space in kernel_asm.s
-#define TASK_STACK_SIZE 512     // Size of the stack for each task
+#define TASK_STACK_POOL_SIZE 3072 // Total stack space shared between all tasks
+#define TASK_STACK_SIZE 512     // Default size of the stack for each task
+#define TASK_STACK_GUARD 16     // Bytes reserved at the top of each stack for the stack error trap
+#define TASK_STACK_PAINT 0x5AA5 // Unused stack is filled with this, to find the peak usage
 #define MAX_TASKS 8            // Maximum number of tasks allocated
 
-#define CALC_CPU_TICKS 1000      // Number of CPU ticks before CPU utilization is re-calculated.
+// Task priorities. Higher priorities always run first,
+// tasks of equal priority are run round-robin.
+#define NUM_PRIORITIES 16       // Must fit in the ready bitmap (uint16)
+#define PRIORITY_IDLE 0         // Reserved for the idle task
+#define PRIORITY_LOW 2
+#define PRIORITY_NORMAL 4
+#define PRIORITY_HIGH 8
+#define PRIORITY_KERNEL 12      // Kernel tasks that service interrupts
+
+#define CALC_CPU_TICKS 1000      // Number of systicks before CPU utilization is re-calculated.
 
 #define CPU_TICK_HISTORY_LEN 128
 
+// Record kernel events into a ring buffer that can be downloaded over USB (see trace.h)
+//#define KERNEL_TRACE
+
 ////////// Typedefs ////////////////////////////////////////////////////////////
 
+// Kernel time base, in systicks (ms). Free-running, wraps every ~49 days,
+// so always compare times with the Tick* macros below rather than < or >.
+typedef uint32 systick_t;
+
 // IMPORTANT: The task_proc must NEVER return!
 //   Returning will cause bad things to happen, such as popping things off
 //   the end of the stack and returning to unknown addresses.
@@ -35,33 +63,69 @@ typedef void (*task_proc_t)(void);
 typedef enum { 
     tsStop,     // Task is not running
     tsIdle,     // Task is using a peripheral (do not put CPU into sleep mode)
-    tsRun       // Task is actively running
+    tsRun,      // Task is actively running
+    tsWait      // Task is blocked on a kernel object (see sync.h)
 } task_state_t;
 
-typedef struct {
+typedef struct task_t {
     uint16 sp;          // Stored task stack pointer for context switch (MUST BE FIRST MEMBER IN STRUCT)
+    uint16 stack_limit; // Loaded into SPLIM when switching to the task (MUST BE SECOND MEMBER IN STRUCT)
 
-    uint16 stack_base;  // Task stack base address
+    uint16* stack_base; // Task stack base address
     uint16 stack_size;  // Task stack size
     
     char name[TASK_NAME_LEN+1];
 
     task_proc_t proc;
     task_state_t state;
+    uint8 priority;
 
-    uint next_run;
+    systick_t next_run;
+    systick_t wake_delta; // Ticks after the previous task in the sleeping queue
+    struct task_t* next; // Next task in the ready queue or sleeping queue
 
-    uint ticks;
+    struct task_t** wait_list; // Wait list the task is blocked on (tsWait)
+    struct task_t* wait_next;  // Next task in the wait list
+    bool wait_timeout;         // Wait has a timeout (set to true if it expired)
+
+    uint ticks;         // Number of times the task was switched in (current window)
     uint last_run;
-    uint cpu_usage;
-    uint cpu_ticks;
+    uint cpu_usage;     // Per-mille of the last window spent running this task
+    uint cpu_ticks;     // Number of times the task was switched in (last window)
+
+    uint32 cycles;      // Instruction cycles spent running (current window)
+    uint32 cpu_cycles;  // Instruction cycles spent running (last window)
+
+    // Periodic tasks (see WaitNextPeriod)
+    uint period;        // Release period in systicks (0 if not periodic)
+    systick_t release;  // Current release time
+    uint overruns;      // Number of times a release was missed
+    uint jitter_min;    // Release latency (us)
+    uint jitter_max;
+    uint jitter_avg;    // Running average
 } task_t;
 
+// CPU utilization over the last CALC_CPU_TICKS window
+typedef struct {
+    uint32 window_cycles;   // Length of the window
+    uint32 busy_cycles;     // Running tasks (everything except idle)
+    uint32 idle_cycles;     // Awake in the idle task (eg. Idle mode while USB is connected)
+    uint32 sleep_cycles;    // In Sleep mode (CPU clock stopped)
+
+    // Per-mille of the window
+    uint cpu_usage;
+    uint idle_usage;
+    uint sleep_usage;
+} cpu_stats_t;
+
 
 ////////// Constants ///////////////////////////////////////////////////////////
 
 
 // Calculations
+#define FCY (POSC/2)            // Instruction clock, counted by the cycle timer (Timer2/3)
+#define SOSC 32768UL            // Timer1 clock
+#define CYCLES_PER_SYSTICK (FCY * SYSTICK_TMR_COUNTS / SOSC)
 #define SYSTICK_PR (POSC/2 / SYSTICK_PRESCALER * SYSTICK_PERIOD / 1000)
 #define SYSTICK_PS_VAL(val) T1_PS_1_##val   // lookup the relevant T1_PS_1_x define
 #define SYSTICK_PS(val) SYSTICK_PS_VAL(val) // required for the macro to work
@@ -72,16 +136,48 @@ typedef struct {
 extern void InitializeKernel();
 extern void KernelStart();
 
-extern task_t* RegisterTask(char* name, task_proc_t proc);
+// stack_size is in bytes (use TASK_STACK_SIZE if unsure)
+extern task_t* RegisterTask(char* name, task_proc_t proc, uint8 priority, uint stack_size);
+
+// Register a task that runs at a fixed rate. The task proc should call
+// WaitNextPeriod() at the end of each iteration (instead of Delay()).
+extern task_t* RegisterPeriodicTask(char* name, task_proc_t proc, uint8 priority, uint stack_size, uint period);
+
+// Make an existing task periodic, with the first release now
+extern void SetTaskPeriod(task_t* task, uint period);
+
+// Wait until the current task's next release. Release times are absolute,
+// so they don't drift by the time the task took to run.
+// Returns false if the task overran (releases were missed and skipped).
+// Only for periodic tasks (a non-zero period). Otherwise it just yields.
+extern bool WaitNextPeriod();
+
+// Peak number of bytes the task has used of its stack
+extern uint TaskStackUsage(task_t* task);
+
+// Copy the CPU utilization for the last window
+extern void KernelGetStats(cpu_stats_t* stats);
+
+// Start/stop scheduling a task (safe to call from an ISR)
+extern void ResumeTask(task_t* task);
+extern void SuspendTask(task_t* task);
 
 extern void Delay(uint millis);
-extern void WaitUntil(uint tick);
+extern void WaitUntil(systick_t tick);
+
+// Number of systicks until the next task needs to run (0 if a task is ready now)
+extern uint KernelNextWakeup();
 
 #define WaitFor(condition) while (!(condition)) { Delay(0); }
 
-// Load the current stack pointer into the stack_base variable,
-// which will then be used as the base stack pointer for application tasks.
-#define KernelSetSP() asm("mov W15, _stack_base\nmov W15, _current_stack_base")
+#define WAIT_FOREVER MAX_UINT
+
+// Wait lists, used to implement blocking kernel objects (see sync.c)
+// IMPORTANT: These must be called with interrupts disabled (CPU IPL 7)
+extern bool KernelWait(task_t** wait_list, uint timeout);
+extern void KernelWakeOne(task_t** wait_list);
+extern void KernelWakeAll(task_t** wait_list);
+extern void KernelPreempt(); // Switch tasks if a higher priority task was woken
 
 #if SYSTICK_PERIOD == 1
     #define IncSystick() systick++
@@ -89,10 +185,16 @@ extern void WaitUntil(uint tick);
     #define IncSystick() systick += SYSTICK_PERIOD
 #endif
 
+// Wrap-safe systick comparisons (valid as long as a and b are within ~24 days of each other)
+#define TickDiff(a,b)       ((int32)((systick_t)(a) - (systick_t)(b)))
+#define TickAfter(a,b)      (TickDiff(a,b) > 0)     // a is later than b
+#define TickBefore(a,b)     (TickDiff(a,b) < 0)     // a is earlier than b
+#define TickExpired(deadline) (TickDiff(GetSystick(), deadline) >= 0)
+
 
 ////////// Properties //////////////////////////////////////////////////////////
 
-extern volatile uint systick;
+extern volatile systick_t systick;
 
 extern uint total_cpu_ticks;
 
@@ -100,5 +202,26 @@ extern uint cpu_tick_history_idx;
 extern uint cpu_tick_history[CPU_TICK_HISTORY_LEN];
 
 
+////////// Inline Methods //////////////////////////////////////////////////////
+
+// Read systick from a task. The systick ISR may update it between
+// reading the low and high words, so re-read until the high word is stable.
+static INLINE systick_t GetSystick() {
+    volatile uint16* tick = (volatile uint16*)&systick;
+    uint16 hi, lo;
+    do {
+        hi = tick[1];
+        lo = tick[0];
+    } while (hi != tick[1]);
+    return ((systick_t)hi << 16) | lo;
+}
+
+// Free-running instruction cycle counter (Timer2/3). Stops in Sleep mode.
+static INLINE uint32 ReadCycleCounter() {
+    // Reading TMR2 latches the upper word into TMR3HLD
+    uint16 lo = TMR2;
+    return ((uint32)TMR3HLD << 16) | lo;
+}
+
 #endif	/* SCHEDULER_H */
 
@@ -31,9 +31,19 @@
 __T1Interrupt:
     bclr IFS0, #3
 
-    ; Increment kernel systick
+    ; Back to one interrupt per systick, in case the idle task stretched
+    ; the period (PR1 = SYSTICK_TMR_PERIOD, see KernelSleep in kernel.c)
+    push w0
+    mov #32, w0
+    mov w0, PR1
+    pop w0
+
+    ; Increment kernel systick (32-bit)
     ;clrwdt
     inc _systick
+    bra nz, systick_done
+    inc _systick+2
+systick_done:
 
     ;btg LATE, #6  ; LED2
 
@@ -64,8 +74,11 @@ _KernelSwitchContext:
 
     call _KernelSwitchTask
 
-    ; Restore the stack pointer for the (new) current task
+    ; Restore the stack pointer and stack limit for the (new) current task
+    ; (SPLIM must be written at least one instruction before the stack is used)
     mov _current_task, w0
+    mov [w0+2], w1 ; task->stack_limit
+    mov w1, SPLIM
     mov [w0], SP
 
 _RestoreTaskContext:
@@ -139,11 +152,15 @@ _KernelStartTask: ;(task_t* task: W0)
 
     ; To start a task, we set the current stack pointer to the task's stack pointer,
     ; then call the code exiting the ISR.
+    mov [w0+2], w1 ; task->stack_limit
+    mov w1, SPLIM
     mov [w0], SP
     goto _RestoreTaskContext
 
 
 ;--- Stack Definition ---
 
+; This stack is only used by main() before the kernel starts.
+; Task stacks are allocated from task_stack_pool in kernel.c (see TASK_STACK_POOL_SIZE)
 .section app_stack, stack
-.space (4096)
+.space (1024)
@@ -11,6 +11,9 @@
 #include <stdio.h>
 #include "system.h"
 #include "core/kernel.h"
+#include "core/trace.h"
+#include "core/timers.h"
+#include "core/sync.h"
 #include "api/graphics/gfx.h"
 #include "os.h"
 #include "api/app.h"
@@ -19,6 +22,7 @@
 #include "drivers/ssd1351.h"
 #include "background/comms.h"
 #include "background/power_monitor.h"
+#include "background/brightness.h"
 #include "drivers/MMA7455.h"
 #include "util/util.h"
 #include "peripherals/gpio.h"
@@ -39,7 +43,6 @@ enum { btnReleased=false, btnPressed=true };
 
 bool displayOn = true;
 
-task_t* core_task;
 task_t* draw_task;
 
 uint draw_ticks;
@@ -50,18 +53,38 @@ volatile bool lock_display = false;
 volatile bool display_frame_ready = false;
 volatile int wipe_frame = 0;
 
+// Frames are only sent once the display has been initialized by ScreenOn(),
+// and the first is sent in full before fading in (see DrawLoop)
+static volatile bool display_ready = false;
+static volatile bool fade_in_pending = false;
+
+// The draw task sleeps until something asks for a new frame
+#define REDRAW_REQUESTED 0x0001
+static event_flags_t redraw_flags;
+static soft_timer_t redraw_timer;  // Redraw requested for a later time (see RequestRedrawAt)
+
+// Battery bar as it was last drawn, so the power monitor only redraws when it changes
+static struct {
+    uint level;
+    power_status_t power;
+    battery_status_t battery;
+    bool usb;
+} drawn_bar;
+
 // Note: button indicies start at 1
-static uint btn_debounce_tick[5];
-bool btn_state[5];
-bool btn_debouncing[5];
+static soft_timer_t btn_debounce_timer[5];
+static bool btn_raw[5];     // Last state reported by the pin change interrupt
+bool btn_state[5];          // Debounced state
+
+static soft_timer_t screen_off_timer;
+static soft_timer_t power_timer;
+static soft_timer_t brightness_timer;
 
-uint sleep_time;
 bool auto_screen_off = true;
 uint auto_screen_off_interval = 10000; //systicks
 
 ////////// Prototypes //////////////////////////////////////////////////////////
 
-void ProcessCore();
 void DrawFrame();
 void DrawLoop();
 void DisplayBootScreen();
@@ -72,17 +95,24 @@ void OnBTN2Change(bool btn_pressed);
 void OnBTN3Change(bool btn_pressed);
 void OnBTN4Change(bool btn_pressed);
 
+static void reset_auto_screen_off();
+static void OnButtonDebounced(uint btn);
+static void OnScreenOffTimer(uint param);
+static void OnPowerTimer(uint param);
+static void OnBrightnessTimer(uint param);
+static void OnRedrawTimer(uint param);
+static void OnDisplayReady();
+
 ////////// Methods /////////////////////////////////////////////////////////////
 
 void InitializeOS() {
     ClrWdt();
 
-    // High priority tasks that must be run all the time
-    core_task = RegisterTask("Core", ProcessCore);
-    core_task->state = tsRun;
-
-    // Drawing, only needs to be run when screen is on
-    draw_task = RegisterTask("Draw", DrawLoop);
+    // Drawing, only needs to be run when screen is on, and only when something has changed.
+    // Low priority so a long render can't hold up input or comms.
+    draw_task = RegisterTask("Draw", DrawLoop, PRIORITY_LOW, TASK_STACK_SIZE);
+    EventInit(&redraw_flags);
+    TimerInit(&redraw_timer, OnRedrawTimer, 0);
 
     // Initialize button interrupts
     _CNIEn(BTN1_CN) = 1;
@@ -96,76 +126,117 @@ void InitializeOS() {
 
     uint i;
     for (i=1; i<=4; i++) {
-        btn_debounce_tick[i] = 0;
+        TimerInit(&btn_debounce_timer[i], OnButtonDebounced, i);
+        btn_raw[i] = 0;
         btn_state[i] = 0;
     }
+
+    // Background housekeeping, run from the timer task instead of polling
+    TimerInit(&screen_off_timer, OnScreenOffTimer, 0);
+    TimerInit(&power_timer, OnPowerTimer, 0);
+    TimerInit(&brightness_timer, OnBrightnessTimer, 0);
+    TimerStart(&power_timer, 0, CORE_PROCESS_INTERVAL);
+    reset_auto_screen_off();
 }
 
 static void reset_auto_screen_off() {
-    sleep_time = systick + auto_screen_off_interval;
+    TimerStart(&screen_off_timer, auto_screen_off_interval, 0);
+}
+
+static void OnScreenOffTimer(uint param) {
+    // Turn off screen automatically after some amount of time
+    if (!displayOn)
+        return;
+
+    if (auto_screen_off)
+        ScreenOff();
+    else
+        reset_auto_screen_off(); // Check again later
+}
+
+static void OnPowerTimer(uint param) {
+    ProcessPowerMonitor();
+
+    if (battery_level != drawn_bar.level || power_status != drawn_bar.power ||
+            battery_status != drawn_bar.battery || usb_connected != drawn_bar.usb)
+        RequestRedraw();
+}
+
+static void OnBrightnessTimer(uint param) {
+    ProcessBrightness();
+}
+
+static void OnRedrawTimer(uint param) {
+    RequestRedraw();
+}
+
+void RequestRedraw() {
+    EventSet(&redraw_flags, REDRAW_REQUESTED);
+}
+
+void RequestRedrawAt(systick_t time) {
+    int32 delay = TickDiff(time, GetSystick());
+
+    if (delay <= 0) {
+        RequestRedraw();
+        return;
+    }
+
+    // Keep an earlier request
+    if (TimerActive(&redraw_timer) && !TickBefore(time, redraw_timer.expiry))
+        return;
+
+    // Longer than a timer can wait, so redraw early and let the app ask again
+    if (delay > MAX_UINT)
+        delay = MAX_UINT;
+
+    TimerStart(&redraw_timer, (uint)delay, 0);
 }
 
 void ScreenOff() {
-    AppGlobalEvent(evtScreenOff, NULL);
+    AppGlobalEvent(evtScreenOff, 0);
 
     accel_SetMode(accStandby);
 
-    // Disable drawing
-    draw_task->state = tsStop;
+    // Disable drawing, a frame that is part way through being sent finishes while it fades out
+    display_ready = false;
+    fade_in_pending = false;
 
     /*if (foreground_app != NULL) {
         foreground_app->task->state = tsStop;
     }*/
 
-    ssd1351_DisplayOff();
-    ssd1351_PowerOff();
+    ssd1351_PowerOffAsync(NULL);
     _LAT(LED1) = 0;
     _LAT(LED2) = 0;
 
     displayOn = false;
+
+    TimerStop(&screen_off_timer);
+    TimerStop(&brightness_timer);
+    TimerStart(&power_timer, CORE_STANDBY_INTERVAL, CORE_STANDBY_INTERVAL);
 }
 
 void ScreenOn() {
-    // Draw a frame before fading in
-    DrawFrame();
-    //_LAT(OL_POWER) = 1;
-    UpdateDisplay();
+    // Reset the display in the background, the draw task sends it a frame when it's ready
+    display_ready = false;
+    ssd1351_PowerOnAsync(OnDisplayReady);
 
-    ssd1351_PowerOn();
-    ssd1351_DisplayOn();
-
-    draw_task->state = tsRun;
-
-    AppGlobalEvent(evtScreenOn, NULL);
+    AppGlobalEvent(evtScreenOn, 0);
 
     displayOn = true;
     reset_auto_screen_off();
-}
-
-
-void ProcessCore() {
-    while (1) {
-        ProcessPowerMonitor();
-
-        // Reset debouncing when timeout period expires,
-        // to prevent lock-up when a roll-over occurrs.
-        uint i;
-        for (i=1; i<=4; i++) {
-            if (btn_debouncing[i] && systick >= btn_debounce_tick[i]) {
-                btn_debouncing[i] = false;
-            }
-        }
+    TimerStart(&power_timer, 0, CORE_PROCESS_INTERVAL);
 
-        // Turn off screen automatically after some amount of time
-        if (auto_screen_off && displayOn && systick > sleep_time) {
-            ScreenOff();
-        }
+    // Light from before the screen went off is out of date, so start again before it fades in
+    ResetBrightness();
+    TimerStart(&brightness_timer, 0, BRIGHTNESS_INTERVAL);
+}
 
-        if (displayOn)
-            Delay(CORE_PROCESS_INTERVAL);
-        else
-            Delay(CORE_STANDBY_INTERVAL);
-    }
+static void OnDisplayReady() {
+    fade_in_pending = true;
+    display_ready = true;
+    RequestRedraw();
 }
 
 static void NextApp() {
@@ -189,22 +260,16 @@ static void PrevApp() {
     }
 }
 
-static inline void OnBTNChange(bool btn_pressed, uint btn) {
-    // Assumes btn 1..4
-
-    // De-bouncing
-    bool *state = &btn_state[btn];
-    uint *tick = &btn_debounce_tick[btn];
-    bool *debouncing = &btn_debouncing[btn];
+static void OnButtonDebounced(uint btn) {
+    // Runs on the timer task, started by the first edge, and again at the end of
+    // the debounce interval in case the button changed state while it was bouncing.
+    bool btn_pressed = btn_raw[btn];
+    if (btn_state[btn] == btn_pressed)
+        return;
 
-    if (*debouncing && systick < *tick) {
-        return; // Event occurred within debounce interval
-    }
-
-    // Change state
-    *state = btn_pressed;
-    *tick = systick + DEBOUNCE_INTERVAL;
-    *debouncing = true;
+    // Change state, and ignore any further edges until the debounce interval is up
+    btn_state[btn] = btn_pressed;
+    TimerStart(&btn_debounce_timer[btn], DEBOUNCE_INTERVAL, 0);
 
     //printf("btn %d : %d\n", btn, btn_pressed);
 
@@ -235,6 +300,23 @@ static inline void OnBTNChange(bool btn_pressed, uint btn) {
     } else {
         AppForegroundEvent(evtBtnRelease, btn);
     }
+
+    // The app may have changed what it shows
+    if (displayOn)
+        RequestRedraw();
+}
+static inline void OnBTNChange(bool btn_pressed, uint btn) {
+    // Assumes btn 1..4
+    uint ipl;
+    btn_raw[btn] = btn_pressed;
+
+    // The state is only changed from the timer task, so an edge can't race the end
+    // of the debounce interval. Edges within the interval are picked up when it
+    // expires, and the check is atomic so one that was just started isn't cut short.
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    if (!TimerActive(&btn_debounce_timer[btn]))
+        TimerStart(&btn_debounce_timer[btn], 0, 0);
+    RESTORE_CPU_IPL(ipl);
 }
 void OnBTN1Change(bool btn_pressed) {
     OnBTNChange(btn_pressed, 1);
@@ -286,7 +368,8 @@ void DrawFrame() {
     //DrawImage(0,0,wallpaper);
     ClearImage();
 
-    // Draw foreground app
+    // Draw foreground app, which asks again if it wants a later frame
+    TimerStop(&redraw_timer);
     if (foreground_app != NULL)
         foreground_app->draw();
 
@@ -311,6 +394,11 @@ void DrawFrame() {
     //DrawBox(0,0, DISPLAY_WIDTH,4, BLACK,BLACK);
     DrawBox(0,0, w,3, c,c);
 
+    drawn_bar.level = battery_level;
+    drawn_bar.power = power_status;
+    drawn_bar.battery = battery_status;
+    drawn_bar.usb = usb_connected;
+
     // Draw the battery icon
     if (power_status == pwBattery) {
         char s[8];
@@ -334,22 +422,33 @@ void DrawFrame() {
 //    DrawString(s, 4,5, DARKGREEN);
 }
 
-// Called periodically
+// Draws a frame whenever one is requested (see RequestRedraw)
 void DrawLoop() {
     static uint scroll = 1;
     
     while (1) {
-        uint t1, t2;
-        uint next_tick = systick + DRAW_INTERVAL;
+        systick_t t1, t2;
+        uint interval;
+
+        // Times out if the task was suspended while waiting
+        if (!EventWait(&redraw_flags, REDRAW_REQUESTED, false, WAIT_FOREVER))
+            continue;
 
-        t1 = systick;
+        // Screen off, ScreenOn() asks again once the display is ready
+        if (!display_ready)
+            continue;
+
+        t1 = GetSystick();
 
         if (!lock_display) {
+            TraceBegin(TRACE_MARK_DRAW, 0);
             display_frame_ready = false;
 
             DrawFrame();
-        
-            display_frame_ready = true;
+
+            // The display RAM wasn't kept while it was powered off
+            if (fade_in_pending)
+                InvalidateDisplay();
 
             if (wipe_frame == 0) {
                 //_LAT(LED1) = 1;
@@ -360,14 +459,26 @@ void DrawLoop() {
                 UpdateDisplayWipeIn(wipe_frame);
                 wipe_frame = 0;
             }
+
+            // Only once it's sent, since reading a banded screen buffer renders into it
+            display_frame_ready = true;
+            TraceEnd(TRACE_MARK_DRAW);
+        }
+
+        // Ignored if the screen has been turned off again since
+        if (fade_in_pending) {
+            fade_in_pending = false;
+            ssd1351_DisplayOnAsync(NULL);
         }
 
-        t2 = systick;
-        draw_ticks = (t2 >= t1) ? (t2 - t1) : 0;
+        t2 = GetSystick();
+        draw_ticks = t2 - t1;
 
-        Delay(DRAW_INTERVAL);
-        //WaitUntil(next_tick);
-        //Delay(0);
+        // Limit the frame rate, requests in the meantime are drawn in the next frame
+        interval = DRAW_INTERVAL;
+        if (foreground_app != NULL && foreground_app->frame_interval)
+            interval = foreground_app->frame_interval;
+        WaitUntil(t1 + interval);
     }
 }
 
@@ -12,12 +12,13 @@
 
 #include "api/app.h"
 
-#define DRAW_INTERVAL 100
+#define DRAW_INTERVAL 100 // Default minimum time between frames (ms)
 //#define PROCESS_CORE_INTERVAL 250
 #define APP_INTERVAL (1000/100)
 
-#define CORE_PROCESS_INTERVAL 50    // Update rate when screen is on
-#define CORE_STANDBY_INTERVAL 250   // Update rate when screen is off (standby)
+#define CORE_PROCESS_INTERVAL 50    // Power monitor update rate when screen is on
+#define CORE_STANDBY_INTERVAL 250   // Power monitor update rate when screen is off (standby)
+#define BRIGHTNESS_INTERVAL 500     // Ambient light sample rate when screen is on
 
 extern volatile bool lock_display;              // Prevent the OS from drawing to the image buffer
 extern volatile bool display_frame_ready;       // True if the display has a fully drawn frame
@@ -30,6 +31,13 @@ void InitializeOS();
 // Set the specified app to be the foreground process
 void SetForegroundApp(application_t* app);
 
+// Wake the draw task to draw a new frame (safe to call from an ISR)
+void RequestRedraw();
+
+// Draw a new frame at the given systick, unless one is already due sooner.
+// Cancelled by the next frame, so the app needs to ask again from its draw().
+void RequestRedrawAt(systick_t time);
+
 void ScreenOff();
 void ScreenOn();
 void DisplayBootScreen();
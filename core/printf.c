@@ -93,7 +93,8 @@ void msg_putc(char c) {
     }
 }
 
-// printf() override
+#ifndef POSIX
+// printf() override (the host build prints to stdout instead)
 int __attribute__((__weak__, __section__(".libc")))
 write(int handle, void * buffer, unsigned int len)
 {
@@ -107,4 +108,5 @@ write(int handle, void * buffer, unsigned int len)
             break;
     }
     return (len);  // number of characters written
-}
\ No newline at end of file
+}
+#endif
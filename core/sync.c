@@ -0,0 +1,184 @@
+/*
+ * File:   sync.c
+ * Author: Jared
+ *
+ * Blocking synchronization primitives (see sync.h)
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include "system.h"
+#include "core/kernel.h"
+#include "core/sync.h"
+
+////////// Code ////////////////////////////////////////////////////////////////
+
+// Each wait function re-checks its condition after being woken,
+// since another task may have taken the resource first.
+// The remaining timeout is worked out from the original deadline.
+// Note that if KernelWait() blocks, it returns with interrupts enabled.
+
+static uint remaining_time(systick_t deadline, uint timeout) {
+    if (timeout == WAIT_FOREVER)
+        return WAIT_FOREVER;
+
+    int32 remaining = TickDiff(deadline, systick);
+    return (remaining > 0) ? (uint)remaining : 0;
+}
+
+////////// Semaphores //////////
+
+void SemInit(semaphore_t* sem, uint count) {
+    sem->count = count;
+    sem->waiting = NULL;
+}
+
+bool SemWait(semaphore_t* sem, uint timeout) {
+    uint ipl;
+    systick_t deadline = GetSystick() + timeout;
+
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    while (sem->count == 0) {
+        if (!KernelWait(&sem->waiting, remaining_time(deadline, timeout))) {
+            RESTORE_CPU_IPL(ipl);
+            return false;
+        }
+
+        SET_CPU_IPL(7);
+    }
+    sem->count--;
+    RESTORE_CPU_IPL(ipl);
+
+    return true;
+}
+
+void SemPost(semaphore_t* sem) {
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+
+    if (sem->count < MAX_UINT)
+        sem->count++;
+    KernelWakeOne(&sem->waiting);
+
+    RESTORE_CPU_IPL(ipl);
+    KernelPreempt();
+}
+
+////////// Event Flags //////////
+
+void EventInit(event_flags_t* evt) {
+    evt->flags = 0;
+    evt->waiting = NULL;
+}
+
+static INLINE bool event_ready(event_flags_t* evt, uint16 mask, bool wait_all) {
+    return wait_all ? ((evt->flags & mask) == mask) : ((evt->flags & mask) != 0);
+}
+
+uint16 EventWait(event_flags_t* evt, uint16 mask, bool wait_all, uint timeout) {
+    uint ipl;
+    uint16 flags;
+    systick_t deadline = GetSystick() + timeout;
+
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    while (!event_ready(evt, mask, wait_all)) {
+        if (!KernelWait(&evt->waiting, remaining_time(deadline, timeout))) {
+            RESTORE_CPU_IPL(ipl);
+            return 0;
+        }
+
+        SET_CPU_IPL(7);
+    }
+    flags = evt->flags & mask;
+    evt->flags &= ~flags;
+    RESTORE_CPU_IPL(ipl);
+
+    return flags;
+}
+
+void EventSet(event_flags_t* evt, uint16 flags) {
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+
+    // Waiters may be waiting on different flags, so let them all check
+    evt->flags |= flags;
+    KernelWakeAll(&evt->waiting);
+
+    RESTORE_CPU_IPL(ipl);
+    KernelPreempt();
+}
+
+void EventClear(event_flags_t* evt, uint16 flags) {
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    evt->flags &= ~flags;
+    RESTORE_CPU_IPL(ipl);
+}
+
+////////// Mailboxes //////////
+
+void MailboxInit(mailbox_t* mb, void* buffer, uint8 msg_size, uint8 capacity) {
+    mb->buffer = buffer;
+    mb->msg_size = msg_size;
+    mb->capacity = capacity;
+    mb->head = 0;
+    mb->count = 0;
+    mb->receivers = NULL;
+    mb->senders = NULL;
+}
+
+bool MailboxPost(mailbox_t* mb, const void* msg, uint timeout) {
+    uint ipl;
+    systick_t deadline = GetSystick() + timeout;
+
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    while (mb->count == mb->capacity) {
+        if (!KernelWait(&mb->senders, remaining_time(deadline, timeout))) {
+            RESTORE_CPU_IPL(ipl);
+            return false;
+        }
+
+        SET_CPU_IPL(7);
+    }
+
+    uint8 idx = mb->head + mb->count;
+    if (idx >= mb->capacity)
+        idx -= mb->capacity;
+    memcpy(&mb->buffer[idx * mb->msg_size], msg, mb->msg_size);
+    mb->count++;
+
+    KernelWakeOne(&mb->receivers);
+
+    RESTORE_CPU_IPL(ipl);
+    KernelPreempt();
+
+    return true;
+}
+
+bool MailboxReceive(mailbox_t* mb, void* msg, uint timeout) {
+    uint ipl;
+    systick_t deadline = GetSystick() + timeout;
+
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    while (mb->count == 0) {
+        if (!KernelWait(&mb->receivers, remaining_time(deadline, timeout))) {
+            RESTORE_CPU_IPL(ipl);
+            return false;
+        }
+
+        SET_CPU_IPL(7);
+    }
+
+    memcpy(msg, &mb->buffer[mb->head * mb->msg_size], mb->msg_size);
+    if (++mb->head == mb->capacity)
+        mb->head = 0;
+    mb->count--;
+
+    KernelWakeOne(&mb->senders);
+
+    RESTORE_CPU_IPL(ipl);
+    KernelPreempt();
+
+    return true;
+}
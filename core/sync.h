@@ -0,0 +1,65 @@
+/* 
+ * File:   sync.h
+ * Author: Jared
+ *
+ * Blocking synchronization primitives.
+ *
+ * A task waiting on one of these objects is taken off the ready queues
+ * until another task or an ISR signals it, so it uses no CPU while it waits.
+ * All of the signalling functions (SemPost, EventSet, MailboxPost with a
+ * timeout of 0) are safe to call from an ISR.
+ *
+ * Timeouts are in systicks (ms). A timeout of 0 never blocks,
+ * and WAIT_FOREVER blocks until the object is signalled.
+ */
+
+#ifndef SYNC_H
+#define	SYNC_H
+
+#include "core/kernel.h"
+
+////////// Typedefs ////////////////////////////////////////////////////////////
+
+// Counting semaphore
+typedef struct {
+    uint count;
+    task_t* waiting;
+} semaphore_t;
+
+// Group of up to 16 event flags
+typedef struct {
+    uint16 flags;
+    task_t* waiting;
+} event_flags_t;
+
+// Queue of fixed-size messages, stored in a user supplied buffer
+typedef struct {
+    uint8* buffer;      // msg_size * capacity bytes
+    uint8 msg_size;
+    uint8 capacity;
+    uint8 head;         // Index of the oldest message
+    uint8 count;        // Number of messages in the mailbox
+
+    task_t* receivers;  // Tasks waiting for a message
+    task_t* senders;    // Tasks waiting for space
+} mailbox_t;
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+extern void SemInit(semaphore_t* sem, uint count);
+extern bool SemWait(semaphore_t* sem, uint timeout);
+extern void SemPost(semaphore_t* sem);
+
+// Wait for any of the flags in mask to be set (or all of them if wait_all is true).
+// The flags that were waited on are cleared, and returned (0 on timeout).
+extern void EventInit(event_flags_t* evt);
+extern uint16 EventWait(event_flags_t* evt, uint16 mask, bool wait_all, uint timeout);
+extern void EventSet(event_flags_t* evt, uint16 flags);
+extern void EventClear(event_flags_t* evt, uint16 flags);
+
+extern void MailboxInit(mailbox_t* mb, void* buffer, uint8 msg_size, uint8 capacity);
+extern bool MailboxPost(mailbox_t* mb, const void* msg, uint timeout);
+extern bool MailboxReceive(mailbox_t* mb, void* msg, uint timeout);
+
+#endif	/* SYNC_H */
+
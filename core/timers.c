@@ -0,0 +1,139 @@
+/*
+ * File:   timers.c
+ * Author: Jared
+ *
+ * Software timers (see timers.h)
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include "system.h"
+#include "core/kernel.h"
+#include "core/sync.h"
+#include "core/timers.h"
+
+////////// Variables ///////////////////////////////////////////////////////////
+
+// Active timers, sorted by expiry time
+static soft_timer_t* active_timers = NULL;
+
+// Posted when a new timer is added to the front of the list,
+// so the timer task can shorten its sleep.
+static semaphore_t timer_sem;
+static task_t* timer_task;
+
+////////// Prototypes //////////////////////////////////////////////////////////
+
+void ProcessTimers();
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+void InitializeTimers() {
+    SemInit(&timer_sem, 0);
+
+    timer_task = RegisterTask("Timer", ProcessTimers, PRIORITY_KERNEL, TASK_STACK_SIZE);
+}
+
+void TimerInit(soft_timer_t* timer, timer_proc_t proc, uint param) {
+    timer->proc = proc;
+    timer->param = param;
+    timer->period = 0;
+    timer->active = false;
+    timer->next = NULL;
+}
+
+// Must be called at IPL 7
+static void timer_remove(soft_timer_t* timer) {
+    soft_timer_t** link = &active_timers;
+    while (*link != NULL) {
+        if (*link == timer) {
+            *link = timer->next;
+            break;
+        }
+        link = &(*link)->next;
+    }
+    timer->active = false;
+}
+
+// Must be called at IPL 7. Returns true if the timer is now the first to expire.
+static bool timer_insert(soft_timer_t* timer) {
+    soft_timer_t** link = &active_timers;
+
+    // Timers with the same expiry fire in the order they were started
+    while (*link != NULL && !TickBefore(timer->expiry, (*link)->expiry))
+        link = &(*link)->next;
+
+    timer->next = *link;
+    *link = timer;
+    timer->active = true;
+
+    return (link == &active_timers);
+}
+
+void TimerStart(soft_timer_t* timer, uint delay, uint period) {
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+
+    if (timer->active)
+        timer_remove(timer);
+
+    timer->expiry = systick + delay;
+    timer->period = period;
+
+    bool first = timer_insert(timer);
+    RESTORE_CPU_IPL(ipl);
+
+    // Wake up the timer task to re-calculate how long it should sleep for
+    if (first)
+        SemPost(&timer_sem);
+}
+
+void TimerStop(soft_timer_t* timer) {
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    if (timer->active)
+        timer_remove(timer);
+    RESTORE_CPU_IPL(ipl);
+}
+
+void ProcessTimers() {
+    while (1) {
+        uint ipl;
+        uint timeout = WAIT_FOREVER;
+
+        SET_AND_SAVE_CPU_IPL(ipl, 7);
+        while (active_timers != NULL) {
+            soft_timer_t* timer = active_timers;
+            systick_t now = systick;
+
+            if (TickBefore(now, timer->expiry)) {
+                // Sleep until the first timer expires
+                systick_t ticks = timer->expiry - now;
+                timeout = (ticks >= WAIT_FOREVER) ? WAIT_FOREVER - 1 : ticks;
+                break;
+            }
+
+            // Expired, so take it off the list (periodic timers are put back in)
+            active_timers = timer->next;
+            timer->active = false;
+            if (timer->period) {
+                timer->expiry += timer->period;
+                if (TickBefore(timer->expiry, now))
+                    timer->expiry = now + timer->period; // Fell behind, don't try to catch up
+                timer_insert(timer);
+            }
+
+            timer_proc_t proc = timer->proc;
+            uint param = timer->param;
+
+            // The callback may start/stop timers, so interrupts need to be on
+            RESTORE_CPU_IPL(ipl);
+            proc(param);
+            SET_AND_SAVE_CPU_IPL(ipl, 7);
+        }
+        RESTORE_CPU_IPL(ipl);
+
+        SemWait(&timer_sem, timeout);
+    }
+}
+
@@ -0,0 +1,46 @@
+/*
+ * File:   timers.h
+ * Author: Jared
+ *
+ * Software timers.
+ *
+ * One-shot and periodic callbacks, kept in a list sorted by expiry time.
+ * A single kernel task sleeps until the first timer expires, so nothing
+ * needs to poll for deadlines (and the CPU stays asleep until one arrives).
+ *
+ * Callbacks run from the timer task, so they may block or take a while,
+ * but that will hold up any other timers that expire in the meantime.
+ */
+
+#ifndef TIMERS_H
+#define	TIMERS_H
+
+#include "core/kernel.h"
+
+typedef void (*timer_proc_t)(uint param);
+
+typedef struct soft_timer_t {
+    systick_t expiry;           // Time the timer fires
+    uint period;                // Reload interval in systicks (0 for one-shot)
+    timer_proc_t proc;
+    uint param;
+
+    bool active;
+    struct soft_timer_t* next;  // Next timer in the active list
+} soft_timer_t;
+
+void InitializeTimers();
+
+void TimerInit(soft_timer_t* timer, timer_proc_t proc, uint param);
+
+// Fire the timer after 'delay' systicks, then every 'period' systicks (0 for one-shot).
+// Restarts the timer if it is already running. Safe to call from an ISR.
+void TimerStart(soft_timer_t* timer, uint delay, uint period);
+
+// Safe to call from an ISR
+void TimerStop(soft_timer_t* timer);
+
+#define TimerActive(timer) ((timer)->active)
+
+#endif	/* TIMERS_H */
+
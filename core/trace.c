@@ -0,0 +1,90 @@
+/*
+ * File:   trace.c
+ * Author: Jared
+ *
+ * Kernel event trace (see trace.h)
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include "system.h"
+#include "core/kernel.h"
+#include "core/trace.h"
+
+#ifdef KERNEL_TRACE
+
+////////// Variables ///////////////////////////////////////////////////////////
+
+// Ring of events. When it fills up the oldest events are overwritten,
+// so after stopping the trace it holds the most recent TRACE_BUFFER_LEN events.
+static trace_event_t trace_buffer[TRACE_BUFFER_LEN];
+static uint trace_head = 0; // Next slot to write
+
+bool trace_enabled = false;
+uint trace_count = 0;
+uint32 trace_dropped = 0;
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+void TraceEvent(uint8 type, uint8 id, uint16 arg) {
+    uint ipl;
+
+    if (!trace_enabled)
+        return;
+
+    // ISRs can nest, so the whole event is written with interrupts disabled.
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    trace_event_t* event = &trace_buffer[trace_head];
+    event->time = ReadCycleCounter();
+    event->type = type;
+    event->id = id;
+    event->arg = arg;
+
+    if (++trace_head == TRACE_BUFFER_LEN)
+        trace_head = 0;
+
+    if (trace_count < TRACE_BUFFER_LEN)
+        trace_count++;
+    else
+        trace_dropped++;
+    RESTORE_CPU_IPL(ipl);
+}
+
+void TraceStart() {
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    trace_head = 0;
+    trace_count = 0;
+    trace_dropped = 0;
+    trace_enabled = true;
+    RESTORE_CPU_IPL(ipl);
+}
+
+void TraceStop() {
+    trace_enabled = false;
+}
+
+uint TraceRead(uint index, trace_event_t* events, uint count) {
+    uint ipl;
+    uint i;
+
+    if (index >= trace_count)
+        return 0;
+    if (count > trace_count - index)
+        count = trace_count - index;
+
+    // The oldest event is at trace_head once the buffer has wrapped
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    uint idx = trace_head + (TRACE_BUFFER_LEN - trace_count) + index;
+    for (i=0; i<count; i++) {
+        if (idx >= TRACE_BUFFER_LEN)
+            idx -= TRACE_BUFFER_LEN;
+        events[i] = trace_buffer[idx++];
+    }
+    RESTORE_CPU_IPL(ipl);
+
+    return count;
+}
+
+#endif
+
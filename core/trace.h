@@ -0,0 +1,82 @@
+/*
+ * File:   trace.h
+ * Author: Jared
+ *
+ * Kernel event trace.
+ *
+ * Records context switches, ISRs, delays and user markers into a ring buffer,
+ * timestamped with the cycle counter. The buffer can be downloaded over USB
+ * (CMD_TRACE_*, see comms.h) and converted to a Chrome trace with tools/trace2json.py
+ *
+ * Enable by defining KERNEL_TRACE in kernel.h. When it isn't defined,
+ * all of the Trace*() macros compile to nothing and the buffer isn't allocated.
+ */
+
+#ifndef TRACE_H
+#define	TRACE_H
+
+#include "core/kernel.h"
+
+#define TRACE_BUFFER_LEN 128    // Number of events kept (8 bytes each)
+
+// Event types
+#define TRACE_SWITCH        0x01    // id=task switched in, arg=task switched out
+#define TRACE_ISR_ENTER     0x02    // id=TRACE_ISR_x
+#define TRACE_ISR_EXIT      0x03    // id=TRACE_ISR_x
+#define TRACE_DELAY         0x04    // id=task, arg=millis
+#define TRACE_WAIT          0x05    // id=task, arg=timeout (blocked on a kernel object)
+#define TRACE_SLEEP         0x06    // arg=systicks spent in Sleep mode (cycle counter was stopped)
+#define TRACE_MARK          0x10    // id=user marker, arg=user value
+#define TRACE_BEGIN         0x11    // id=user marker, starts a span
+#define TRACE_END           0x12    // id=user marker, ends a span
+
+// Interrupt sources
+#define TRACE_ISR_CN        0x01
+#define TRACE_ISR_ADC       0x02
+
+// User marker ids
+#define TRACE_MARK_COMMS    0x01    // Handling a USB command (arg=command)
+#define TRACE_MARK_DRAW     0x02    // Drawing a frame
+#define TRACE_MARK_USB      0x03    // USB transfer completed (from the USB ISR)
+#define TRACE_MARK_USER     0x40    // Applications can use ids from here up
+
+typedef struct __attribute__((packed)) {
+    uint32 time;    // Cycle counter (see ReadCycleCounter)
+    uint8 type;
+    uint8 id;
+    uint16 arg;
+} trace_event_t;
+
+#ifdef KERNEL_TRACE
+
+// Add an event to the trace buffer. Safe to call from an ISR.
+extern void TraceEvent(uint8 type, uint8 id, uint16 arg);
+
+// Clear the buffer and start/stop recording
+extern void TraceStart();
+extern void TraceStop();
+
+// Copy up to 'count' events, starting at 'index' (0 is the oldest event).
+// Returns the number of events copied.
+extern uint TraceRead(uint index, trace_event_t* events, uint count);
+
+extern bool trace_enabled;
+extern uint trace_count;        // Number of events in the buffer
+extern uint32 trace_dropped;    // Events overwritten since the trace was started
+
+#define Trace(type, id, arg)    TraceEvent(type, id, arg)
+
+#else
+
+#define Trace(type, id, arg)    ((void)0)
+
+#endif
+
+#define TraceISREnter(isr)      Trace(TRACE_ISR_ENTER, isr, 0)
+#define TraceISRExit(isr)       Trace(TRACE_ISR_EXIT, isr, 0)
+#define TraceMark(id, value)    Trace(TRACE_MARK, id, value)
+#define TraceBegin(id, value)   Trace(TRACE_BEGIN, id, value)
+#define TraceEnd(id)            Trace(TRACE_END, id, 0)
+
+#endif	/* TRACE_H */
+
@@ -0,0 +1,93 @@
+/*
+ * File:   workqueue.c
+ * Author: Jared
+ *
+ * Deferred interrupt work (see workqueue.h)
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include "system.h"
+#include "core/kernel.h"
+#include "core/sync.h"
+#include "core/workqueue.h"
+
+////////// Variables ///////////////////////////////////////////////////////////
+
+// Ring of work items. ISRs reserve a slot by advancing work_head,
+// then publish it by writing proc last. The work task is the only consumer,
+// so it can take items from work_tail without disabling interrupts.
+static work_item_t work_queue[WORK_QUEUE_SIZE];
+static uint work_head = 0;
+static uint work_tail = 0;
+
+static semaphore_t work_sem;
+static task_t* work_task;
+
+uint work_overflows = 0;
+
+////////// Prototypes //////////////////////////////////////////////////////////
+
+void ProcessWork();
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+void InitializeWorkQueue() {
+    uint i;
+    for (i=0; i<WORK_QUEUE_SIZE; i++)
+        work_queue[i].proc = NULL;
+
+    SemInit(&work_sem, 0);
+
+    // Must run before anything else, since it is standing in for the ISRs
+    work_task = RegisterTask("Work", ProcessWork, PRIORITY_KERNEL, TASK_STACK_SIZE);
+}
+
+bool QueueWork(work_proc_t proc, uint param) {
+    uint ipl;
+    uint idx;
+
+    // Reserve a slot. ISRs can nest, so this is the only part that
+    // needs interrupts disabled (for a handful of instructions).
+    // The queue is full if the next slot hasn't been consumed yet.
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+    idx = work_head;
+    if (work_queue[idx].proc != NULL) {
+        work_overflows++;
+        RESTORE_CPU_IPL(ipl);
+        return false;
+    }
+    if (++work_head == WORK_QUEUE_SIZE)
+        work_head = 0;
+    RESTORE_CPU_IPL(ipl);
+
+    // Publish the item
+    work_item_t* item = &work_queue[idx];
+    item->param = param;
+    item->proc = proc;
+
+    SemPost(&work_sem);
+    return true;
+}
+
+void ProcessWork() {
+    while (1) {
+        SemWait(&work_sem, WAIT_FOREVER);
+
+        // Run everything that has been published so far. If an item is still
+        // being written by an ISR, its SemPost will wake us up again.
+        work_item_t* item = &work_queue[work_tail];
+        while (item->proc != NULL) {
+            work_proc_t proc = item->proc;
+            uint param = item->param;
+
+            item->proc = NULL; // Slot can now be reused
+            if (++work_tail == WORK_QUEUE_SIZE)
+                work_tail = 0;
+
+            proc(param);
+
+            item = &work_queue[work_tail];
+        }
+    }
+}
@@ -0,0 +1,34 @@
+/* 
+ * File:   workqueue.h
+ * Author: Jared
+ *
+ * Deferred interrupt work.
+ *
+ * ISRs should do as little as possible, so anything that takes a while
+ * (eg. turning the screen on, reading the accelerometer over I2C)
+ * is posted to the work queue instead, and run from a high priority task.
+ */
+
+#ifndef WORKQUEUE_H
+#define	WORKQUEUE_H
+
+#define WORK_QUEUE_SIZE 16      // Maximum number of pending work items
+
+typedef void (*work_proc_t)(uint param);
+
+typedef struct {
+    volatile work_proc_t proc;  // NULL until the item has been fully written
+    uint param;
+} work_item_t;
+
+void InitializeWorkQueue();
+
+// Run proc(param) from the work task. Safe to call from an ISR.
+// Returns false if the queue is full (the work is dropped).
+bool QueueWork(work_proc_t proc, uint param);
+
+// Number of work items dropped because the queue was full
+extern uint work_overflows;
+
+#endif	/* WORKQUEUE_H */
+
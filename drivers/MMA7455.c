@@ -13,6 +13,7 @@
 #include "system.h"
 #include "peripherals/i2c.h"
 #include "core/kernel.h"
+#include "core/workqueue.h"
 #include "hardware.h"
 #include "MMA7455.h"
 #include "util/vector.h"
@@ -212,16 +213,14 @@ void accel_RegisterCallback(accel_mode_t mode, proc_t cb) {
 
 ////////// Interrupts //////////////////////////////////////////////////////////
 
-// Pin change interrupt for INT1
-// INT1 signifies different events depending on mode.
-// In mmaMeasure mode, INT1 is the DRDY status bit, signifying data is ready to be read
-
-void accel_isr() {
+// Handles an accelerometer interrupt for the given mode.
+// Run from the work task, since reading the accelerometer over I2C is too slow for an ISR
+static void accel_process(uint mode) {
 
     //TODO: Do we need to modify the INTREG bits (swap INT1/INT2 pin status) depending on mode??
     // The hardware is configured to use only one interrupt
 
-    switch (accel_mode) {
+    switch ((accel_mode_t)mode) {
 
         // Data ready, read next sample (stored in 'current')
         case accMeasure: {
@@ -250,7 +249,14 @@ void accel_isr() {
     }
 
     // Execute callback
-    proc_t cb = accel_callbacks[(uint8)accel_mode];
+    proc_t cb = accel_callbacks[(uint8)mode];
     if (cb != NULL) cb();
 }
 
+// Pin change interrupt for INT1
+// INT1 signifies different events depending on mode.
+// In mmaMeasure mode, INT1 is the DRDY status bit, signifying data is ready to be read
+void accel_isr() {
+    QueueWork(accel_process, accel_mode);
+}
+
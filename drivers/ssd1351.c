@@ -12,6 +12,8 @@
 #include "ssd1351.h"
 #include "peripherals/ssd1351p.h"
 #include "api/graphics/gfx.h"
+#include "core/timers.h"
+#include "core/sync.h"
 
 ////////// Defines /////////////////////////////////////////////////////////////
 
@@ -89,7 +91,48 @@
 // Generated by tools/oledlut.py
 #include "oledlut.h"
 
+#ifdef GFX_8BPP
+#define COLOURDEPTH_CFG 0x34
+#else
 #define COLOURDEPTH_CFG 0x74 //0x74: 65K color, 0xB4: 262K color, 0x34: 256 color
+#endif
+
+// Non-blocking power sequence timings (systicks/ms)
+#define RESET_TIME      2   // Reset pulse, and again before the first command (DS: 2us, 1ms)
+#define FADE_STEP_TIME  8   // Per master contrast step
+
+////////// Variables ///////////////////////////////////////////////////////////
+
+// The power sequences send commands from the timer task, which mustn't land in the
+// middle of a pixel transfer from the draw task. Also serializes the state machine.
+static semaphore_t bus_lock = {.count = 1};
+#define bus_acquire()   SemWait(&bus_lock, WAIT_FOREVER)
+#define bus_try()       SemWait(&bus_lock, 0)
+#define bus_release()   SemPost(&bus_lock)
+
+typedef enum {
+    psIdle,
+    psReset,        // Reset held low
+    psResetWait,    // Reset released, waiting to send the configuration
+    psFadeIn,
+    psFadeOut,
+} power_state_t;
+
+static void OnPowerStep(uint param);
+static void OnSettingsRetry(uint param);
+
+static soft_timer_t power_timer = {.proc = OnPowerStep};
+static soft_timer_t settings_timer = {.proc = OnSettingsRetry};
+static bool contrast_pending = false;   // Changed, but not sent yet because the bus was busy
+static bool colour_pending = false;
+static power_state_t power_state = psIdle;
+static ssd1351_callback_t power_done;
+static bool fade_power_off;     // Hold the display in reset after fading out
+
+static bool initialized = false;    // Configured since the last reset
+static uint8 contrast = 0x0E;       // Master contrast once faded in
+static uint8 level = 0x0F;          // Master contrast last sent
+static uint8 colour[3] = {0xC8, 0xC8, 0xC8};    // R,G,B contrast
 
 ////////// Methods /////////////////////////////////////////////////////////////
 
@@ -120,25 +163,10 @@ bool ssd1351_Test() {
     return (value == 0b1111) ? true : false;
 }
 
-void ssd1351_PowerOn() {
-    // Power on initialization sequence
-
+// Register configuration after a reset
+static void configure() {
     //NOTE: ssd1351_command(x) is equivalent to ssd1351_sendv(x, 0)
 
-    //ssd1351_command(CMD_DISPLAY_ON);
-    //return;
-   // ssd1351_write(0xAA);
-    //return;
-    UINT32 i;
-    
-    //_LAT(OL_RESET) = 1;
-    //for (i=0; i<10000; i++) { ClrWdt(); }
-    _LAT(OL_RESET) = 0;
-    for (i=0; i<100000; i++) { ClrWdt(); }
-    _LAT(OL_RESET) = 1;
-    for (i=0; i<100000; i++) { ClrWdt(); }
-
-
     // Unlock locked commands
     ssd1351_sendv(CMD_SET_COMMAND_LOCK,         1, 0x12);
     ssd1351_sendv(CMD_SET_COMMAND_LOCK,         1, 0xB1);
@@ -161,10 +189,11 @@ void ssd1351_PowerOn() {
     //ssd1351_sendv(CMD_SET_VSL,                  3, 0xA2, 0xB5, 0x55);       // Internal VSL
 
     // Contrast/gamma display settings
-    ssd1351_sendv(CMD_SET_CONTRAST,             3, 0xC8, 0xC8, 0xC8);   // R,G,B contrast values
+    ssd1351_sendv(CMD_SET_CONTRAST,             3, colour[0], colour[1], colour[2]);   // R,G,B contrast values
     //ssd1351_sendv(CMD_SET_CONTRAST,             3, 0x80, 0xFF, 0xB0);   // R,G,B contrast values
     ssd1351_sendv(CMD_MASTER_CONTRAST,          1, 0x0F);            // Full master contrast
     //ssd1351_sendbuf(CMD_GRAYSCALE_LUT,          (uint8*)gamma_lut, sizeof(gamma_lut));
+    level = 0x0F;
 
     ssd1351_sendv(CMD_SET_PHASE_LENGTH,         1, 0x32);
     ssd1351_sendv(CMD_ENHANCE_DRIVING_SCHEME,   3, 0xA4, 0x00, 0x00);
@@ -174,6 +203,37 @@ void ssd1351_PowerOn() {
     ssd1351_sendv(CMD_SET_VCOMH,                1, 0x05);
 
     ssd1351_command(CMD_SET_DISPLAY_MODE | DISPLAY_MODE_RESET);
+
+    initialized = true;
+}
+
+static void set_level(uint8 c) {
+    level = c;
+    ssd1351_sendv(CMD_MASTER_CONTRAST, 1, c);
+}
+
+// Cancels a non-blocking sequence, without calling its callback. Must hold bus_lock.
+static void power_cancel() {
+    TimerStop(&power_timer);
+    power_state = psIdle;
+}
+
+void ssd1351_PowerOn() {
+    // Power on initialization sequence
+    UINT32 i;
+
+    bus_acquire();
+    power_cancel();
+
+    //_LAT(OL_RESET) = 1;
+    //for (i=0; i<10000; i++) { ClrWdt(); }
+    _LAT(OL_RESET) = 0;
+    for (i=0; i<100000; i++) { ClrWdt(); }
+    _LAT(OL_RESET) = 1;
+    for (i=0; i<100000; i++) { ClrWdt(); }
+
+    configure();
+    bus_release();
     
     // Clear Screen
     ssd1351_ClearScreen();
@@ -183,6 +243,9 @@ void ssd1351_PowerOn() {
 }
 
 void ssd1351_DisplayOn() {
+    bus_acquire();
+    power_cancel();
+
     // Turn on VCC
     _LAT(OL_POWER) = 1;
 
@@ -194,10 +257,11 @@ void ssd1351_DisplayOn() {
     ssd1351_command(CMD_DISPLAY_ON);
 
     UINT i,j;
-    for (i=0; i<0x0F; i++) {
-        ssd1351_sendv(CMD_MASTER_CONTRAST, 1, i);
+    for (i=0; i<=contrast; i++) {
+        set_level(i);
         for (j=0; j<40000; j++);
     }
+    bus_release();
 }
 
 void ssd1351_PowerOff() {
@@ -206,25 +270,193 @@ void ssd1351_PowerOff() {
 
     _LAT(OL_RESET) = 0;
     _LAT(OL_POWER) = 0;
+    initialized = false;
 }
 
 void ssd1351_DisplayOff() {
+    bus_acquire();
+    power_cancel();
+
     UINT i,j;
     for (i=0; i<0x0F; i++) {
-        ssd1351_sendv(CMD_MASTER_CONTRAST, 1, 0x0F - i);
+        set_level(0x0F - i);
         for (j=0; j<40000; j++);
     }
 
     ssd1351_command(CMD_DISPLAY_OFF);
     _LAT(OL_POWER) = 0; //TODO: Measure power savings from adding this
+    bus_release();
+}
+
+////////// Non-blocking Power Sequences //////
+
+// Starts a sequence with its first step after 'delay'. Must hold bus_lock.
+static void power_start(power_state_t state, uint delay, ssd1351_callback_t done) {
+    power_state = state;
+    power_done = done;
+    TimerStart(&power_timer, delay, 0);
+}
+
+void ssd1351_PowerOnAsync(ssd1351_callback_t done) {
+    bus_acquire();
+    _LAT(OL_RESET) = 0;
+    _LAT(OL_POWER) = 0;
+    initialized = false;
+    power_start(psReset, RESET_TIME, done);
+    bus_release();
+}
+
+void ssd1351_PowerOffAsync(ssd1351_callback_t done) {
+    bus_acquire();
+    initialized = false;
+    fade_power_off = true;
+    power_start(psFadeOut, 0, done);
+    bus_release();
+}
+
+void ssd1351_DisplayOnAsync(ssd1351_callback_t done) {
+    bus_acquire();
+    if (!initialized) {
+        // Powered off, or still being reset
+        bus_release();
+        return;
+    }
+
+    // Turn on VCC, and the pixels at the lowest contrast (unless already part way)
+    if (!_LAT(OL_POWER)) {
+        _LAT(OL_POWER) = 1;
+        set_level(0);
+        ssd1351_command(CMD_DISPLAY_ON);
+    }
+    power_start(psFadeIn, FADE_STEP_TIME, done);
+    bus_release();
+}
+
+void ssd1351_DisplayOffAsync(ssd1351_callback_t done) {
+    bus_acquire();
+    if (!initialized) {
+        // Already dark
+        bus_release();
+        return;
+    }
+
+    fade_power_off = false;
+    power_start(psFadeOut, 0, done);
+    bus_release();
+}
+
+// Runs each step of a sequence from the timer task
+static void OnPowerStep(uint param) {
+    ssd1351_callback_t done;
+    uint ipl;
+
+    // Don't hold up the other timers behind a pixel transfer, try again next tick.
+    // Unless the sequence was restarted while the bus was busy.
+    if (!bus_try()) {
+        SET_AND_SAVE_CPU_IPL(ipl, 7);
+        if (!TimerActive(&power_timer))
+            TimerStart(&power_timer, 1, 0);
+        RESTORE_CPU_IPL(ipl);
+        return;
+    }
+
+    // Restarted while this step was waiting for the bus
+    if (TimerActive(&power_timer)) {
+        bus_release();
+        return;
+    }
+
+    switch (power_state) {
+        case psReset:
+            _LAT(OL_RESET) = 1;
+            power_state = psResetWait;
+            TimerStart(&power_timer, RESET_TIME, 0);
+            bus_release();
+            return;
+
+        case psResetWait:
+            configure();
+            break;
+
+        case psFadeIn:
+            if (level != contrast) {
+                set_level((level < contrast) ? level + 1 : level - 1);
+                TimerStart(&power_timer, FADE_STEP_TIME, 0);
+                bus_release();
+                return;
+            }
+            break;
+
+        case psFadeOut:
+            if (level > 0 && _LAT(OL_POWER)) {
+                set_level(level - 1);
+                TimerStart(&power_timer, FADE_STEP_TIME, 0);
+                bus_release();
+                return;
+            }
+            ssd1351_command(CMD_DISPLAY_OFF);
+            _LAT(OL_POWER) = 0;
+            if (fade_power_off)
+                _LAT(OL_RESET) = 0;
+            break;
+
+        default:
+            bus_release();
+            return;
+    }
+
+    done = power_done;
+    power_state = psIdle;
+    bus_release();
+
+    if (done != NULL)
+        done();
+}
+
+////////// Settings //////
+
+// Sends the settings that have changed. Must hold bus_lock.
+static void send_settings() {
+    if (contrast_pending) {
+        contrast_pending = false;
+
+        // A fade picks up the new value as it goes
+        if (power_state != psFadeIn && power_state != psFadeOut)
+            set_level(contrast);
+    }
+    if (colour_pending) {
+        colour_pending = false;
+        ssd1351_sendv(CMD_SET_CONTRAST, 3, colour[0], colour[1], colour[2]);
+    }
+}
+
+// Sends the settings if the bus is free, otherwise from the timer task once it is.
+// These are called from the work queue, which mustn't wait for a pixel transfer.
+static void update_settings() {
+    if (!bus_try()) {
+        TimerStart(&settings_timer, 1, 0);
+        return;
+    }
+    send_settings();
+    bus_release();
+}
+
+static void OnSettingsRetry(uint param) {
+    update_settings();
 }
 
-void ssd1351_SetContrast(uint8 contrast) {
-    ssd1351_sendv(CMD_MASTER_CONTRAST, 1, contrast & 0x0F);
+void ssd1351_SetContrast(uint8 c) {
+    contrast = c & 0x0F;
+    contrast_pending = true;
+    update_settings();
 }
 
 void ssd1351_SetColourBalance(uint8 r, uint8 g, uint8 b) {
-    ssd1351_sendv(CMD_SET_CONTRAST, 3, r, g, b);
+    colour[0] = r;
+    colour[1] = g;
+    colour[2] = b;
+    colour_pending = true;
+    update_settings();
 }
 
 void ssd1351_ClearScreen() {
@@ -232,32 +464,69 @@ void ssd1351_ClearScreen() {
     ssd1351_FillScreen(BLACK);
 }
 
-void ssd1351_SetCursor(uint x, uint y) {
-    ssd1351_command(CMD_WRITE_RAM);
-    ssd1351_sendv(CMD_SET_COLUMN_ADDR, 2,x, DISPLAY_WIDTH-1);
-    ssd1351_sendv(CMD_SET_ROW_ADDR, 2,y, DISPLAY_HEIGHT-1);
+void ssd1351_SetWindow(uint x1, uint y1, uint x2, uint y2) {
+    ssd1351_sendv(CMD_SET_COLUMN_ADDR, 2, x1, x2);
+    ssd1351_sendv(CMD_SET_ROW_ADDR, 2, y1, y2);
     ssd1351_command(CMD_WRITE_RAM);
 }
 
+void ssd1351_SetCursor(uint x, uint y) {
+    ssd1351_SetWindow(x, y, DISPLAY_WIDTH-1, DISPLAY_HEIGHT-1);
+}
+
+// Send a pixel of a colour, in the display's colour mode
+static void write_pixel(color_t c) {
+#ifdef GFX_8BPP
+    ssd1351_data(RGB332(c));
+#else
+    ssd1351_data((byte)(c >> 8));
+    ssd1351_data((byte)c);
+#endif
+}
+
 void ssd1351_FillScreen(color_t c) {
+    bus_acquire();
     ssd1351_SetCursor(0,0);
 
     uint i;
-    for (i=0; i<(DISPLAY_WIDTH*DISPLAY_HEIGHT); i++) {
-        ssd1351_data((c & 0xFF00) >> 8);
-        ssd1351_data(c & 0x00FF);
-    }
+    for (i=0; i<(DISPLAY_WIDTH*DISPLAY_HEIGHT); i++)
+        write_pixel(c);
+    bus_release();
 }
 
 void ssd1351_SetPixel(uint x, uint y, color_t c) {
     ssd1351_SetCursor(x,y);
-    ssd1351_data((c & 0xFF00) >> 8);
-    ssd1351_data(c & 0x00FF);
+    write_pixel(c);
 }
 
-void ssd1351_UpdateScreen(__eds__ color_t* buf, uint size) {
+void ssd1351_UpdateScreen(__eds__ pixel_t* buf, uint size) {
+    bus_acquire();
     ssd1351_SetCursor(0,0);
     ssd1351_writeimgbuf(buf, size);
+    bus_release();
+}
+
+void ssd1351_UpdateWindow(__eds__ pixel_t* buf, uint x1, uint y1, uint x2, uint y2) {
+    ssd1351_UpdateWindowRows(buf, 0, x1, y1, x2, y2);
+}
+
+// Same as ssd1351_UpdateWindow(), from a buffer that only holds the rows from buf_y
+void ssd1351_UpdateWindowRows(__eds__ pixel_t* buf, uint buf_y, uint x1, uint y1, uint x2, uint y2) {
+    uint w = x2 - x1 + 1;
+    uint y;
+
+    bus_acquire();
+    ssd1351_SetWindow(x1, y1, x2, y2);
+
+    if (w == DISPLAY_WIDTH) {
+        // Full rows are contiguous in the buffer
+        ssd1351_writeimgbuf(&buf[(y1 - buf_y) * DISPLAY_WIDTH], (y2 - y1 + 1) * DISPLAY_WIDTH);
+    } else {
+        // The display wraps to the next row at the end of the window
+        for (y=y1; y<=y2; y++)
+            ssd1351_writeimgbuf(&buf[(y - buf_y) * DISPLAY_WIDTH + x1], w);
+    }
+    bus_release();
 }
 
 void ssd1351_HorizontalScroll(int8 dir) {
@@ -280,12 +549,12 @@ void ssd1351_SetColumnAddressing() {
     ssd1351_send(CMD_COLORDEPTH, COLOURDEPTH_CFG | 1);
 }
 
-void ssd1351_WipeIn(__eds__ color_t* buf, int dir) {
+void ssd1351_WipeIn(__eds__ pixel_t* buf, int dir) {
     static uint x = 0;
     uint y;
     color_t c;
 
-
+    bus_acquire();
     ssd1351_SetColumnAddressing();
 
 #define LINE_WIDTH 2
@@ -295,8 +564,7 @@ void ssd1351_WipeIn(__eds__ color_t* buf, int dir) {
         c = SKYBLUE;
         ssd1351_SetCursor((dir > 0) ? x : (DISPLAY_WIDTH-x-1), 0);
         for (y=0; y<DISPLAY_HEIGHT; y++) {
-            ssd1351_data((byte)(c>>8));
-            ssd1351_data((byte)(c));
+            write_pixel(c);
         }
     }
 
@@ -307,8 +575,7 @@ void ssd1351_WipeIn(__eds__ color_t* buf, int dir) {
             c = SKYBLUE;
             ssd1351_SetCursor((dir > 0) ? (x+LINE_WIDTH) : (DISPLAY_WIDTH-x-LINE_WIDTH-1), 0);
             for (y=0; y<DISPLAY_HEIGHT; y++) {
-                ssd1351_data((byte)(c>>8));
-                ssd1351_data((byte)(c));
+                write_pixel(c);
             }
         }
 
@@ -317,13 +584,14 @@ void ssd1351_WipeIn(__eds__ color_t* buf, int dir) {
         ssd1351_SetCursor((dir > 0) ? x : (DISPLAY_WIDTH-x-1), 0);
         for (y=0; y<DISPLAY_HEIGHT; y++) {
             c = (dir > 0) ? buf[x+y*DISPLAY_WIDTH] : buf[(DISPLAY_WIDTH-x-1)+y*DISPLAY_WIDTH];
-            ssd1351_data((byte)(c>>8));
-            ssd1351_data((byte)(c));
+            c = ScreenColor(c);
+            write_pixel(c);
         }
         
         //Delay(1);
     }
     ssd1351_SetRowAddressing();
+    bus_release();
     
     if (x == DISPLAY_WIDTH)
         x = 0;
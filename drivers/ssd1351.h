@@ -29,21 +29,48 @@ extern void ssd1351_DisplayOn();
 // Turn off the display pixels (sleep mode)
 extern void ssd1351_DisplayOff();
 
-// Controls screen brightness (0-15)
+// The above block while the display is reset or faded. These don't, each step is
+// run from the timer task, which calls 'done' (if not NULL) at the end.
+// Starting one cancels the sequence in progress, without calling its callback.
+typedef void (*ssd1351_callback_t)();
+
+// Reset & initialize, leaving the display off. The display RAM isn't cleared.
+extern void ssd1351_PowerOnAsync(ssd1351_callback_t done);
+
+// Fade out & hold the OLED in reset
+extern void ssd1351_PowerOffAsync(ssd1351_callback_t done);
+
+// Fade in/out from the current contrast. Ignored while not initialized.
+extern void ssd1351_DisplayOnAsync(ssd1351_callback_t done);
+extern void ssd1351_DisplayOffAsync(ssd1351_callback_t done);
+
+// Controls screen brightness (0-15), which is also where fading in stops.
+// Doesn't wait for the bus: during a pixel transfer it's sent from the timer task afterwards.
 extern void ssd1351_SetContrast(uint8 contrast);
 
-// Controls the colour balance (0-255)
+// Controls the colour balance (0-255), kept across power cycles. Doesn't wait for the bus either.
 extern void ssd1351_SetColourBalance(uint8 r, uint8 g, uint8 b);
 
 // Clear the screen pixels
 extern void ssd1351_ClearScreen();
 
 // Draw pixels to the screen
-void ssd1351_UpdateScreen(__eds__ uint16 *buf, uint size);
+void ssd1351_UpdateScreen(__eds__ pixel_t *buf, uint size);
+
+// Draw a rectangle of a full screen pixel buffer to the same place on the screen
+void ssd1351_UpdateWindow(__eds__ pixel_t *buf, uint x1, uint y1, uint x2, uint y2);
+void ssd1351_UpdateWindowRows(__eds__ pixel_t *buf, uint buf_y, uint x1, uint y1, uint x2, uint y2);
+
+// Draw a full screen pixel buffer a column at a time behind a moving line,
+// from the left (dir > 0) or right (dir < 0)
+void ssd1351_WipeIn(__eds__ pixel_t *buf, int dir);
 
 // Set the current cursor position
 void ssd1351_SetCursor(uint x, uint y) ;
 
+// Limit pixel writes to a window (inclusive), starting at the top left
+void ssd1351_SetWindow(uint x1, uint y1, uint x2, uint y2);
+
 // Fill the screen with a colour
 void ssd1351_FillScreen(color_t c) ;
 
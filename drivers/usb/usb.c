@@ -15,6 +15,8 @@
 #include "./USB/usb.h"
 #include "./USB/usb_function_hid.h"
 #include "core/kernel.h"
+#include "core/trace.h"
+#include "core/timers.h"
 
 ////////// Defines /////////////////////////////////////////////////////////////
 
@@ -37,7 +39,13 @@ USB_HANDLE USBInHandle = 0; //USB handle.  Must be initialized to 0 at startup.
 static proc_t on_usb_sleep = NULL;
 static proc_t on_usb_wake = NULL;
 static bool connected = false;
-static uint connection_timeout = 0;
+static soft_timer_t connection_timer;
+
+semaphore_t usb_transfer_sem;
+
+////////// Prototypes //////////////////////////////////////////////////////////
+
+static void usb_timeout(uint param);
 
 ////////// Methods /////////////////////////////////////////////////////////////
 
@@ -60,6 +68,9 @@ void InitializeUSB(proc_t usb_sleep_cb, proc_t usb_wake_cb) {
     on_usb_wake = usb_wake_cb;
     connected = false;
 
+    SemInit(&usb_transfer_sem, 0);
+    TimerInit(&connection_timer, usb_timeout, 0);
+
     // Attach USB interrupts
 #if defined(USB_INTERRUPT)
     USBDeviceAttach();
@@ -67,7 +78,8 @@ void InitializeUSB(proc_t usb_sleep_cb, proc_t usb_wake_cb) {
 }
 
 static void usb_reset_timeout() {
-    connection_timeout = systick + CONNECTION_TIMEOUT;
+    // Called from the USB interrupt
+    TimerStart(&connection_timer, CONNECTION_TIMEOUT, 0);
 }
 static void usb_connect() {
     if (!connected) {
@@ -84,21 +96,12 @@ static void usb_disconnect() {
             on_usb_sleep();
     }
 }
-static void usb_check_timeout() {
-    // Prevent systick roll-over issues
-    if (connection_timeout < CONNECTION_TIMEOUT + 1) {
-        usb_reset_timeout();
-        return;
-    }
-
-    if (systick > connection_timeout) {
-        usb_disconnect();
-    }
+static void usb_timeout(uint param) {
+    // No USB activity for CONNECTION_TIMEOUT (run from the timer task)
+    usb_disconnect();
 }
 
 void USBProcess(usb_rx_packet_cb receive_callback) {
-    usb_check_timeout();
-
     if ((USBDeviceState < CONFIGURED_STATE) || (USBSuspendControl == 1)) {
         return;
     }
@@ -124,6 +127,11 @@ BOOL USBBusy() {
     return HIDRxHandleBusy(USBOutHandle) || HIDTxHandleBusy(USBInHandle);
 }
 
+BOOL USBTxBusy() {
+    if ((USBDeviceState < CONFIGURED_STATE) || (USBSuspendControl == 1)) return true;
+    return HIDTxHandleBusy(USBInHandle);
+}
+
 
 ////////// USB Callbacks ///////////////////////////////////////////////////////
 
@@ -271,7 +279,9 @@ BOOL USER_USB_CALLBACK_EVENT_HANDLER(int event, void *pdata, WORD size) {
 
     switch (event) {
         case EVENT_TRANSFER:
-            //Add application specific callback task or callback function here if desired.
+            // Wake up the comms task to handle the transfer
+            TraceMark(TRACE_MARK_USB, 0);
+            SemPost(&usb_transfer_sem);
             break;
         case EVENT_SOF:
             USBCB_SOF_Handler();
@@ -8,6 +8,8 @@
 #ifndef USB_H
 #define	USB_H
 
+#include "core/sync.h"
+
 #define PACKET_SIZE 64
 
 extern void InitializeUSB();
@@ -20,9 +22,13 @@ extern unsigned char usb_tx_buffer[PACKET_SIZE];
 
 typedef void (*usb_rx_packet_cb)(unsigned char* packet);
 
+// Signalled from the USB interrupt whenever a transfer completes
+extern semaphore_t usb_transfer_sem;
+
 void USBProcess(usb_rx_packet_cb receive_callback);
 void USBSendPacket(unsigned char* packet);
 BOOL USBBusy();
+BOOL USBTxBusy();   // The last packet sent hasn't gone out yet
 
 #endif	/* USB_H */
 
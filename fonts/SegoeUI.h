@@ -1,1442 +1,297 @@
 uint8 __eds__ segoe_ui_bytes[] __attribute__((space(prog))) = {
-    // ' '
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // '!'
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x18,0x02,
-    0x00,0x14,0x02,
-    0x00,0x00,0x00,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // '"'
-    0x01,0x18,0x02,0x18,0x03,
-    0x01,0x18,0x02,0x18,0x03,
-    0x01,0x18,0x02,0x18,0x03,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // '#'
-    0x00,0x00,0x06,0x12,0x01,0x15,0x00,
-    0x00,0x00,0x0f,0x0e,0x06,0x12,0x00,
-    0x0a,0x1f,0x1f,0x1f,0x1f,0x1f,0x1b,
-    0x00,0x00,0x14,0x02,0x13,0x03,0x00,
-    0x00,0x01,0x15,0x00,0x14,0x02,0x00,
-    0x19,0x1f,0x1f,0x1f,0x1f,0x1f,0x0e,
-    0x00,0x0f,0x0e,0x0a,0x13,0x00,0x00,
-    0x00,0x14,0x09,0x0f,0x0e,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '$'
-    0x00,0x0a,0x1f,0x1f,0x1b,0x02,
-    0x01,0x1c,0x0a,0x0c,0x0b,0x02,
-    0x06,0x1a,0x08,0x0c,0x00,0x00,
-    0x01,0x1d,0x13,0x0c,0x00,0x00,
-    0x00,0x01,0x1d,0x1e,0x03,0x00,
-    0x00,0x00,0x06,0x15,0x1e,0x03,
-    0x00,0x00,0x06,0x0c,0x14,0x0e,
-    0x06,0x0c,0x06,0x0d,0x18,0x09,
-    0x00,0x19,0x1f,0x1f,0x13,0x00,
-    0x00,0x00,0x06,0x0c,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '%'
-    0x00,0x0f,0x1f,0x1f,0x0e,0x00,0x00,0x14,0x0e,0x00,
-    0x01,0x18,0x02,0x01,0x18,0x02,0x06,0x16,0x00,0x00,
-    0x01,0x18,0x02,0x01,0x18,0x02,0x18,0x03,0x00,0x00,
-    0x00,0x0f,0x1f,0x1f,0x0e,0x0f,0x0e,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x18,0x02,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x14,0x09,0x0f,0x1f,0x1f,0x0e,
-    0x00,0x00,0x00,0x06,0x16,0x01,0x18,0x02,0x01,0x18,
-    0x00,0x00,0x00,0x18,0x03,0x01,0x18,0x02,0x01,0x18,
-    0x00,0x00,0x0f,0x13,0x00,0x00,0x0f,0x1f,0x1f,0x0e,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '&'
-    0x00,0x00,0x0f,0x1f,0x1f,0x18,0x00,0x00,0x00,0x00,
-    0x00,0x06,0x1d,0x03,0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x00,0x06,0x1a,0x02,0x00,0x18,0x09,0x06,0x1a,0x02,
-    0x00,0x00,0x14,0x1f,0x1f,0x09,0x00,0x06,0x1a,0x02,
-    0x00,0x0a,0x1f,0x0b,0x1d,0x18,0x00,0x0a,0x18,0x00,
-    0x06,0x1d,0x03,0x00,0x00,0x14,0x13,0x14,0x0e,0x00,
-    0x0a,0x1b,0x02,0x00,0x00,0x00,0x19,0x18,0x00,0x00,
-    0x01,0x1d,0x0e,0x00,0x00,0x0a,0x1f,0x1e,0x03,0x00,
-    0x00,0x06,0x1e,0x1f,0x1f,0x1b,0x02,0x0f,0x1f,0x1b,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '''
-    0x01,0x18,0x02,
-    0x01,0x18,0x02,
-    0x01,0x18,0x02,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // '('
-    0x00,0x00,0x0f,0x18,
-    0x00,0x06,0x1a,0x02,
-    0x00,0x0f,0x13,0x00,
-    0x00,0x18,0x09,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x00,0x18,0x09,0x00,
-    0x00,0x0f,0x13,0x00,
-    0x00,0x06,0x1a,0x02,
-    0x00,0x00,0x0f,0x18,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // ')'
-    0x14,0x13,0x00,0x00,
-    0x00,0x18,0x09,0x00,
-    0x00,0x0a,0x18,0x00,
-    0x00,0x06,0x1a,0x02,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x00,0x18,0x09,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x06,0x1a,0x02,
-    0x00,0x0a,0x18,0x00,
-    0x00,0x18,0x09,0x00,
-    0x14,0x18,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // '*'
-    0x00,0x00,0x14,0x02,0x00,
-    0x0f,0x18,0x14,0x16,0x13,
-    0x00,0x0a,0x1f,0x0e,0x00,
-    0x01,0x18,0x02,0x18,0x03,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // '+'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x00,
-    0x06,0x1e,0x1f,0x1f,0x1f,0x1f,0x0e,0x00,
-    0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // ','
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x0a,0x1b,0x02,
-    0x14,0x0e,0x00,
-    0x1c,0x03,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // '-'
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x06,0x1e,0x1f,0x1e,0x03,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // '.'
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // '/'
-    0x00,0x00,0x00,0x0a,0x18,
-    0x00,0x00,0x00,0x18,0x09,
-    0x00,0x00,0x06,0x16,0x00,
-    0x00,0x00,0x0f,0x0e,0x00,
-    0x00,0x01,0x1c,0x03,0x00,
-    0x00,0x0a,0x13,0x00,0x00,
-    0x00,0x18,0x09,0x00,0x00,
-    0x06,0x16,0x00,0x00,0x00,
-    0x0f,0x0e,0x00,0x00,0x00,
-    0x18,0x02,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // '0'
-    0x00,0x0a,0x1f,0x1f,0x13,0x00,
-    0x01,0x1c,0x03,0x01,0x1c,0x09,
-    0x0a,0x18,0x00,0x00,0x0f,0x13,
-    0x0f,0x13,0x00,0x00,0x0a,0x18,
-    0x0f,0x13,0x00,0x00,0x0a,0x18,
-    0x0f,0x13,0x00,0x00,0x0a,0x18,
-    0x0a,0x18,0x00,0x00,0x0f,0x13,
-    0x06,0x1d,0x03,0x01,0x1c,0x09,
-    0x00,0x0a,0x1f,0x1f,0x0e,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '1'
-    0x00,0x00,0x0a,0x1e,0x03,0x00,
-    0x00,0x19,0x19,0x1c,0x03,0x00,
-    0x00,0x00,0x01,0x1c,0x03,0x00,
-    0x00,0x00,0x01,0x1c,0x03,0x00,
-    0x00,0x00,0x01,0x1c,0x03,0x00,
-    0x00,0x00,0x01,0x1c,0x03,0x00,
-    0x00,0x00,0x01,0x1c,0x03,0x00,
-    0x00,0x00,0x01,0x1c,0x03,0x00,
-    0x00,0x00,0x01,0x1c,0x03,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '2'
-    0x00,0x14,0x1f,0x1f,0x13,0x00,
-    0x06,0x0c,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x18,0x09,
-    0x00,0x00,0x00,0x01,0x1c,0x03,
-    0x00,0x00,0x00,0x14,0x13,0x00,
-    0x00,0x00,0x19,0x13,0x00,0x00,
-    0x00,0x18,0x09,0x00,0x00,0x00,
-    0x0a,0x18,0x00,0x00,0x00,0x00,
-    0x0f,0x1f,0x1f,0x1f,0x1f,0x13,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '3'
-    0x00,0x19,0x1f,0x1f,0x0e,0x00,
-    0x01,0x0b,0x00,0x06,0x1d,0x03,
-    0x00,0x00,0x00,0x01,0x1c,0x03,
-    0x00,0x00,0x00,0x0a,0x18,0x00,
-    0x00,0x0f,0x1f,0x18,0x00,0x00,
-    0x00,0x00,0x00,0x0a,0x1f,0x09,
-    0x00,0x00,0x00,0x00,0x14,0x0e,
-    0x08,0x03,0x00,0x01,0x1c,0x09,
-    0x06,0x1e,0x1f,0x1f,0x0e,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '4'
-    0x00,0x00,0x00,0x0f,0x1b,0x02,
-    0x00,0x00,0x01,0x1d,0x1b,0x02,
-    0x00,0x00,0x0f,0x13,0x1a,0x02,
-    0x00,0x06,0x16,0x06,0x1a,0x02,
-    0x00,0x18,0x09,0x06,0x1a,0x02,
-    0x0f,0x13,0x00,0x06,0x1a,0x02,
-    0x1d,0x1f,0x1f,0x1f,0x1f,0x1b,
-    0x00,0x00,0x00,0x06,0x1a,0x02,
-    0x00,0x00,0x00,0x06,0x1a,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '5'
-    0x00,0x0f,0x1f,0x1f,0x1e,0x03,
-    0x00,0x14,0x0e,0x00,0x00,0x00,
-    0x00,0x14,0x09,0x00,0x00,0x00,
-    0x00,0x19,0x1f,0x1f,0x13,0x00,
-    0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x14,0x13,
-    0x00,0x00,0x00,0x00,0x14,0x0e,
-    0x00,0x00,0x00,0x06,0x1e,0x09,
-    0x01,0x1d,0x1f,0x1f,0x0e,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '6'
-    0x00,0x00,0x14,0x1f,0x1f,0x09,
-    0x00,0x14,0x13,0x00,0x00,0x00,
-    0x01,0x18,0x02,0x00,0x00,0x00,
-    0x0a,0x19,0x1d,0x1f,0x1b,0x02,
-    0x0a,0x1f,0x09,0x00,0x14,0x13,
-    0x0a,0x18,0x00,0x00,0x0a,0x18,
-    0x0a,0x18,0x00,0x00,0x0a,0x18,
-    0x01,0x1c,0x09,0x00,0x19,0x0e,
-    0x00,0x06,0x1e,0x1f,0x18,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '7'
-    0x0f,0x1f,0x1f,0x1f,0x1f,0x1e,
-    0x00,0x00,0x00,0x00,0x0f,0x13,
-    0x00,0x00,0x00,0x01,0x1c,0x03,
-    0x00,0x00,0x00,0x0a,0x13,0x00,
-    0x00,0x00,0x00,0x18,0x09,0x00,
-    0x00,0x00,0x06,0x16,0x00,0x00,
-    0x00,0x00,0x0f,0x0e,0x00,0x00,
-    0x00,0x00,0x18,0x09,0x00,0x00,
-    0x00,0x01,0x1c,0x03,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '8'
-    0x00,0x0a,0x1f,0x1f,0x13,0x00,
-    0x01,0x1c,0x09,0x01,0x1c,0x09,
-    0x06,0x1a,0x02,0x00,0x14,0x0e,
-    0x00,0x18,0x09,0x01,0x1c,0x03,
-    0x00,0x06,0x1e,0x1f,0x0e,0x00,
-    0x06,0x1a,0x02,0x00,0x14,0x0e,
-    0x0f,0x13,0x00,0x00,0x0a,0x18,
-    0x0a,0x1b,0x02,0x00,0x14,0x13,
-    0x00,0x0f,0x1f,0x1f,0x18,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '9'
-    0x00,0x0a,0x1f,0x1f,0x13,0x00,
-    0x06,0x1d,0x03,0x01,0x1c,0x09,
-    0x0f,0x13,0x00,0x00,0x0f,0x13,
-    0x0f,0x13,0x00,0x00,0x0f,0x13,
-    0x0a,0x1e,0x03,0x00,0x19,0x13,
-    0x00,0x0f,0x1f,0x1f,0x17,0x13,
-    0x00,0x00,0x00,0x00,0x14,0x0e,
-    0x00,0x00,0x00,0x0a,0x1b,0x02,
-    0x01,0x1d,0x1f,0x1e,0x03,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // ':'
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x0a,0x1b,0x02,
-    0x0a,0x1b,0x02,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x0a,0x1b,0x02,
-    0x0a,0x1b,0x02,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // ';'
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x0a,0x1b,0x02,
-    0x0a,0x1b,0x02,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x0a,0x1b,0x02,
-    0x14,0x0e,0x00,
-    0x1c,0x03,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // '<'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x14,0x09,0x00,
-    0x00,0x00,0x00,0x0a,0x1f,0x0e,0x00,0x00,
-    0x00,0x06,0x1e,0x18,0x00,0x00,0x00,0x00,
-    0x00,0x14,0x1f,0x09,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x19,0x1e,0x03,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x01,0x1c,0x09,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '='
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x06,0x1e,0x1f,0x1f,0x1f,0x1f,0x0e,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x06,0x1e,0x1f,0x1f,0x1f,0x1f,0x0e,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '>'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x18,0x03,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x01,0x1d,0x18,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x0a,0x1f,0x0e,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x19,0x1e,0x03,0x00,
-    0x00,0x00,0x19,0x1f,0x09,0x00,0x00,0x00,
-    0x00,0x18,0x09,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '?'
-    0x01,0x1d,0x1f,0x1e,0x03,
-    0x09,0x09,0x00,0x14,0x13,
-    0x00,0x00,0x00,0x0f,0x13,
-    0x00,0x00,0x0a,0x1b,0x02,
-    0x00,0x06,0x1a,0x02,0x00,
-    0x00,0x0a,0x18,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x06,0x1d,0x03,0x00,
-    0x00,0x06,0x1d,0x03,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // '@'
-    0x00,0x00,0x00,0x0f,0x1f,0x1f,0x1f,0x1b,0x02,0x00,0x00,
-    0x00,0x00,0x19,0x18,0x00,0x00,0x00,0x0a,0x1e,0x03,0x00,
-    0x00,0x0f,0x13,0x00,0x19,0x1f,0x1b,0x13,0x0a,0x18,0x00,
-    0x00,0x18,0x03,0x0f,0x13,0x00,0x14,0x0e,0x00,0x18,0x03,
-    0x01,0x18,0x02,0x14,0x09,0x00,0x0f,0x0e,0x00,0x14,0x09,
-    0x01,0x15,0x00,0x18,0x03,0x00,0x0f,0x09,0x00,0x18,0x03,
-    0x01,0x1c,0x03,0x14,0x09,0x01,0x1d,0x0e,0x06,0x16,0x00,
-    0x00,0x14,0x13,0x06,0x1e,0x1e,0x0a,0x1e,0x1e,0x03,0x00,
-    0x00,0x01,0x1d,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x14,0x1f,0x1f,0x1f,0x1e,0x03,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'A'
-    0x00,0x00,0x00,0x14,0x18,0x00,0x00,0x00,
-    0x00,0x00,0x06,0x1a,0x19,0x09,0x00,0x00,
-    0x00,0x00,0x0f,0x13,0x0f,0x13,0x00,0x00,
-    0x00,0x00,0x18,0x09,0x06,0x1a,0x02,0x00,
-    0x00,0x06,0x1a,0x02,0x00,0x18,0x09,0x00,
-    0x00,0x0f,0x13,0x00,0x00,0x0f,0x18,0x00,
-    0x01,0x1d,0x1f,0x1f,0x1f,0x1f,0x1e,0x03,
-    0x0a,0x1b,0x02,0x00,0x00,0x00,0x19,0x0e,
-    0x14,0x13,0x00,0x00,0x00,0x00,0x0f,0x18,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'B'
-    0x01,0x1d,0x1f,0x1f,0x1f,0x0e,0x00,
-    0x01,0x1c,0x09,0x00,0x06,0x1d,0x03,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x0a,0x18,0x00,
-    0x01,0x1d,0x1f,0x1f,0x1e,0x03,0x00,
-    0x01,0x1c,0x09,0x00,0x06,0x1e,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x19,0x0e,
-    0x01,0x1c,0x09,0x00,0x06,0x1e,0x09,
-    0x01,0x1d,0x1f,0x1f,0x1f,0x09,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'C'
-    0x00,0x00,0x00,0x19,0x1f,0x1f,0x1b,0x02,
-    0x00,0x06,0x1e,0x0e,0x00,0x00,0x06,0x0c,
-    0x00,0x19,0x0e,0x00,0x00,0x00,0x00,0x00,
-    0x06,0x1d,0x03,0x00,0x00,0x00,0x00,0x00,
-    0x06,0x1a,0x02,0x00,0x00,0x00,0x00,0x00,
-    0x06,0x1d,0x03,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x19,0x0e,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x0a,0x1f,0x0e,0x00,0x00,0x06,0x0c,
-    0x00,0x00,0x06,0x1e,0x1f,0x1f,0x1b,0x02,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'D'
-    0x01,0x1d,0x1f,0x1f,0x1f,0x13,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x01,0x1d,0x18,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x06,0x1d,0x03,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x19,0x0e,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x19,0x0e,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x18,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x06,0x1d,0x03,
-    0x01,0x1c,0x09,0x00,0x01,0x1d,0x0e,0x00,
-    0x01,0x1d,0x1f,0x1f,0x1f,0x09,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'E'
-    0x01,0x1d,0x1f,0x1f,0x1f,0x0e,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1d,0x1f,0x1f,0x1e,0x03,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1d,0x1f,0x1f,0x1f,0x13,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'F'
-    0x01,0x1d,0x1f,0x1f,0x1f,0x13,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1d,0x1f,0x1f,0x1f,0x0e,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'G'
-    0x00,0x00,0x06,0x1e,0x1f,0x1f,0x1b,0x02,
-    0x00,0x06,0x1e,0x09,0x00,0x00,0x13,0x03,
-    0x00,0x19,0x0e,0x00,0x00,0x00,0x00,0x00,
-    0x06,0x1d,0x03,0x00,0x00,0x00,0x00,0x00,
-    0x06,0x1a,0x02,0x00,0x0f,0x1f,0x1f,0x09,
-    0x06,0x1d,0x03,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x01,0x1c,0x09,
-    0x00,0x0f,0x1e,0x03,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x0a,0x1f,0x1f,0x1f,0x13,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'H'
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1d,0x1f,0x1f,0x1f,0x1f,0x1f,0x1f,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'I'
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // 'J'
-    0x00,0x01,0x1c,0x09,
-    0x00,0x01,0x1c,0x09,
-    0x00,0x01,0x1c,0x09,
-    0x00,0x01,0x1c,0x09,
-    0x00,0x01,0x1c,0x09,
-    0x00,0x01,0x1c,0x09,
-    0x00,0x01,0x1c,0x09,
-    0x00,0x0a,0x1b,0x02,
-    0x1d,0x1f,0x09,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // 'K'
-    0x01,0x1c,0x09,0x00,0x00,0x19,0x18,
-    0x01,0x1c,0x09,0x00,0x14,0x13,0x00,
-    0x01,0x1c,0x09,0x0f,0x18,0x00,0x00,
-    0x01,0x1c,0x12,0x1b,0x02,0x00,0x00,
-    0x01,0x1d,0x1f,0x0e,0x00,0x00,0x00,
-    0x01,0x1c,0x0e,0x1e,0x09,0x00,0x00,
-    0x01,0x1c,0x09,0x0a,0x1e,0x03,0x00,
-    0x01,0x1c,0x09,0x00,0x0f,0x1b,0x02,
-    0x01,0x1c,0x09,0x00,0x00,0x14,0x1b,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'L'
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1d,0x1f,0x1f,0x1f,0x13,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'M'
-    0x01,0x1d,0x18,0x00,0x00,0x00,0x00,0x00,0x0f,0x1f,0x09,
-    0x01,0x1c,0x1b,0x09,0x00,0x00,0x00,0x01,0x1d,0x1f,0x09,
-    0x01,0x1c,0x17,0x13,0x00,0x00,0x00,0x0a,0x19,0x1c,0x09,
-    0x01,0x1c,0x0b,0x1c,0x03,0x00,0x00,0x18,0x0b,0x1c,0x09,
-    0x01,0x1c,0x09,0x14,0x0e,0x00,0x06,0x1a,0x03,0x1c,0x09,
-    0x01,0x1c,0x09,0x06,0x1a,0x02,0x14,0x0e,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x18,0x0e,0x1a,0x02,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x0a,0x1f,0x13,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x18,0x03,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'N'
-    0x01,0x1d,0x18,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x1b,0x0e,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x0e,0x1a,0x02,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x14,0x13,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x01,0x1c,0x09,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x0a,0x18,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x19,0x0f,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x06,0x1e,0x1f,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x0f,0x1f,0x09,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'O'
-    0x00,0x00,0x0a,0x1f,0x1f,0x1f,0x13,0x00,0x00,
-    0x00,0x0a,0x1f,0x09,0x00,0x00,0x19,0x13,0x00,
-    0x00,0x19,0x0e,0x00,0x00,0x00,0x06,0x1d,0x03,
-    0x06,0x1d,0x03,0x00,0x00,0x00,0x00,0x18,0x09,
-    0x06,0x1a,0x02,0x00,0x00,0x00,0x00,0x19,0x0e,
-    0x06,0x1d,0x03,0x00,0x00,0x00,0x00,0x18,0x09,
-    0x00,0x19,0x0e,0x00,0x00,0x00,0x06,0x1d,0x03,
-    0x00,0x0a,0x1e,0x03,0x00,0x01,0x1d,0x13,0x00,
-    0x00,0x00,0x0a,0x1f,0x1f,0x1f,0x0e,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'P'
-    0x01,0x1d,0x1f,0x1f,0x1f,0x09,0x00,
-    0x01,0x1c,0x09,0x00,0x0f,0x1b,0x02,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x0f,0x1b,0x02,
-    0x01,0x1d,0x1f,0x1f,0x1e,0x03,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'Q'
-    0x00,0x00,0x0f,0x1f,0x1f,0x1f,0x18,0x00,0x00,
-    0x00,0x0f,0x1e,0x03,0x00,0x00,0x14,0x18,0x00,
-    0x06,0x1d,0x03,0x00,0x00,0x00,0x00,0x18,0x09,
-    0x0a,0x18,0x00,0x00,0x00,0x00,0x00,0x14,0x13,
-    0x0f,0x18,0x00,0x00,0x00,0x00,0x00,0x0f,0x13,
-    0x0a,0x18,0x00,0x00,0x00,0x00,0x00,0x0f,0x13,
-    0x06,0x1d,0x03,0x00,0x00,0x00,0x00,0x18,0x09,
-    0x00,0x14,0x1b,0x02,0x00,0x00,0x19,0x18,0x00,
-    0x00,0x00,0x0f,0x1f,0x1f,0x1f,0x1f,0x09,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x1e,0x1f,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'R'
-    0x01,0x1d,0x1f,0x1f,0x1f,0x0e,0x00,
-    0x01,0x1c,0x09,0x00,0x0a,0x1e,0x03,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x0a,0x1b,0x02,
-    0x01,0x1d,0x1f,0x1f,0x18,0x00,0x00,
-    0x01,0x1c,0x09,0x06,0x1d,0x03,0x00,
-    0x01,0x1c,0x09,0x00,0x0f,0x13,0x00,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x0f,0x1b,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'S'
-    0x00,0x0a,0x1f,0x1f,0x1e,0x03,
-    0x06,0x1d,0x03,0x00,0x06,0x0c,
-    0x0a,0x1b,0x02,0x00,0x00,0x00,
-    0x01,0x1d,0x13,0x00,0x00,0x00,
-    0x00,0x00,0x19,0x1f,0x0e,0x00,
-    0x00,0x00,0x00,0x06,0x1e,0x0e,
-    0x00,0x00,0x00,0x00,0x0f,0x18,
-    0x09,0x09,0x00,0x00,0x19,0x13,
-    0x01,0x1d,0x1f,0x1f,0x18,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'T'
-    0x14,0x1f,0x1f,0x1f,0x1f,0x1f,0x13,
-    0x00,0x00,0x01,0x1c,0x09,0x00,0x00,
-    0x00,0x00,0x01,0x1c,0x09,0x00,0x00,
-    0x00,0x00,0x01,0x1c,0x09,0x00,0x00,
-    0x00,0x00,0x01,0x1c,0x09,0x00,0x00,
-    0x00,0x00,0x01,0x1c,0x09,0x00,0x00,
-    0x00,0x00,0x01,0x1c,0x09,0x00,0x00,
-    0x00,0x00,0x01,0x1c,0x09,0x00,0x00,
-    0x00,0x00,0x01,0x1c,0x09,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'U'
-    0x01,0x1c,0x09,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x01,0x1c,0x09,
-    0x00,0x18,0x09,0x00,0x00,0x06,0x1d,0x03,
-    0x00,0x14,0x1b,0x02,0x00,0x14,0x18,0x00,
-    0x00,0x00,0x19,0x1f,0x1f,0x1b,0x02,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'V'
-    0x14,0x13,0x00,0x00,0x00,0x0a,0x18,
-    0x0a,0x18,0x00,0x00,0x00,0x14,0x0e,
-    0x06,0x1d,0x03,0x00,0x01,0x1c,0x03,
-    0x00,0x19,0x0e,0x00,0x0a,0x18,0x00,
-    0x00,0x0f,0x13,0x00,0x14,0x0e,0x00,
-    0x00,0x06,0x1a,0x02,0x18,0x09,0x00,
-    0x00,0x00,0x18,0x0e,0x1a,0x02,0x00,
-    0x00,0x00,0x0f,0x1f,0x13,0x00,0x00,
-    0x00,0x00,0x06,0x1e,0x09,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'W'
-    0x14,0x0e,0x00,0x00,0x01,0x1c,0x09,0x00,0x00,0x0a,0x18,
-    0x0a,0x18,0x00,0x00,0x06,0x1e,0x13,0x00,0x00,0x0f,0x13,
-    0x06,0x1a,0x02,0x00,0x0f,0x13,0x16,0x00,0x00,0x18,0x09,
-    0x00,0x18,0x09,0x00,0x18,0x0b,0x1c,0x03,0x01,0x1c,0x03,
-    0x00,0x14,0x0e,0x01,0x18,0x02,0x14,0x09,0x0a,0x18,0x00,
-    0x00,0x0a,0x18,0x0a,0x18,0x00,0x0f,0x13,0x0f,0x13,0x00,
-    0x00,0x06,0x1a,0x11,0x0e,0x00,0x06,0x17,0x18,0x09,0x00,
-    0x00,0x00,0x19,0x1f,0x09,0x00,0x01,0x1d,0x1e,0x03,0x00,
-    0x00,0x00,0x0f,0x1b,0x02,0x00,0x00,0x14,0x18,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'X'
-    0x0a,0x1b,0x02,0x00,0x00,0x14,0x13,
-    0x00,0x14,0x0e,0x00,0x06,0x1a,0x02,
-    0x00,0x06,0x1a,0x02,0x14,0x0e,0x00,
-    0x00,0x00,0x0f,0x1b,0x18,0x00,0x00,
-    0x00,0x00,0x01,0x1c,0x09,0x00,0x00,
-    0x00,0x00,0x14,0x16,0x1b,0x02,0x00,
-    0x00,0x0a,0x1b,0x02,0x19,0x0e,0x00,
-    0x00,0x18,0x09,0x00,0x06,0x1d,0x03,
-    0x14,0x18,0x00,0x00,0x00,0x14,0x18,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'Y'
-    0x14,0x13,0x00,0x00,0x00,0x0a,0x18,
-    0x06,0x1d,0x03,0x00,0x00,0x18,0x09,
-    0x00,0x14,0x13,0x00,0x0a,0x18,0x00,
-    0x00,0x06,0x1a,0x02,0x19,0x0e,0x00,
-    0x00,0x00,0x14,0x13,0x1a,0x02,0x00,
-    0x00,0x00,0x0a,0x1f,0x0e,0x00,0x00,
-    0x00,0x00,0x01,0x1c,0x09,0x00,0x00,
-    0x00,0x00,0x01,0x1c,0x09,0x00,0x00,
-    0x00,0x00,0x01,0x1c,0x09,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'Z'
-    0x0f,0x1f,0x1f,0x1f,0x1f,0x1f,0x18,
-    0x00,0x00,0x00,0x00,0x0a,0x1e,0x03,
-    0x00,0x00,0x00,0x01,0x1d,0x0e,0x00,
-    0x00,0x00,0x00,0x0f,0x18,0x00,0x00,
-    0x00,0x00,0x06,0x1e,0x09,0x00,0x00,
-    0x00,0x00,0x19,0x13,0x00,0x00,0x00,
-    0x00,0x0f,0x1b,0x02,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x14,0x1f,0x1f,0x1f,0x1f,0x1f,0x18,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '['
-    0x01,0x1d,0x1f,0x09,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1d,0x1f,0x09,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // '\'
-    0x1c,0x03,0x00,0x00,0x00,
-    0x14,0x0e,0x00,0x00,0x00,
-    0x06,0x16,0x00,0x00,0x00,
-    0x00,0x18,0x09,0x00,0x00,
-    0x00,0x0a,0x13,0x00,0x00,
-    0x00,0x01,0x18,0x02,0x00,
-    0x00,0x00,0x14,0x0e,0x00,
-    0x00,0x00,0x06,0x16,0x00,
-    0x00,0x00,0x00,0x18,0x09,
-    0x00,0x00,0x00,0x0a,0x13,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // ']'
-    0x0a,0x1f,0x1e,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x0a,0x1f,0x1e,0x03,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // '^'
-    0x00,0x00,0x00,0x0f,0x13,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x18,0x1a,0x03,0x00,0x00,
-    0x00,0x00,0x0a,0x13,0x0a,0x13,0x00,0x00,
-    0x00,0x00,0x18,0x03,0x00,0x18,0x03,0x00,
-    0x00,0x0f,0x13,0x00,0x00,0x0a,0x18,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '_'
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x1d,0x1f,0x1f,0x1f,0x1e,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // '`'
-    0x0a,0x1b,0x02,
-    0x00,0x0a,0x18,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // 'a'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x14,0x1f,0x1f,0x18,0x00,
-    0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x00,0x0a,0x1f,0x1f,0x1f,0x09,
-    0x06,0x1d,0x03,0x00,0x18,0x09,
-    0x0a,0x1b,0x02,0x06,0x1e,0x09,
-    0x00,0x19,0x1f,0x1c,0x19,0x09,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'b'
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x0e,0x1e,0x1f,0x13,0x00,
-    0x01,0x1d,0x1b,0x02,0x06,0x1e,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x14,0x0e,
-    0x01,0x1c,0x09,0x00,0x00,0x19,0x0e,
-    0x01,0x1d,0x13,0x00,0x06,0x1d,0x03,
-    0x01,0x1c,0x17,0x1f,0x1f,0x0e,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'c'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x19,0x1f,0x1f,0x0e,
-    0x00,0x19,0x13,0x00,0x00,0x00,
-    0x06,0x1d,0x03,0x00,0x00,0x00,
-    0x06,0x1d,0x03,0x00,0x00,0x00,
-    0x00,0x19,0x13,0x00,0x00,0x00,
-    0x00,0x01,0x1d,0x1f,0x1f,0x0e,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'd'
-    0x00,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x00,0x06,0x1e,0x1f,0x14,0x1c,0x09,
-    0x01,0x1d,0x0e,0x00,0x0f,0x1f,0x09,
-    0x06,0x1a,0x02,0x00,0x01,0x1c,0x09,
-    0x06,0x1a,0x02,0x00,0x01,0x1c,0x09,
-    0x01,0x1d,0x0e,0x00,0x0f,0x1f,0x09,
-    0x00,0x0a,0x1f,0x1f,0x14,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'e'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x06,0x1e,0x1f,0x1e,0x03,
-    0x01,0x1c,0x09,0x00,0x0a,0x13,
-    0x06,0x1e,0x1f,0x1f,0x1f,0x18,
-    0x06,0x1d,0x03,0x00,0x00,0x00,
-    0x01,0x1d,0x13,0x00,0x00,0x00,
-    0x00,0x06,0x1e,0x1f,0x1f,0x18,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'f'
-    0x00,0x0a,0x1f,0x1b,
-    0x01,0x1d,0x0e,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x1d,0x1f,0x1f,0x13,
-    0x01,0x1c,0x09,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // 'g'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x06,0x1e,0x1f,0x14,0x1c,0x09,
-    0x01,0x1d,0x0e,0x00,0x0f,0x1f,0x09,
-    0x06,0x1a,0x02,0x00,0x01,0x1c,0x09,
-    0x06,0x1a,0x02,0x00,0x01,0x1c,0x09,
-    0x01,0x1d,0x0e,0x00,0x0f,0x1f,0x09,
-    0x00,0x0a,0x1f,0x1f,0x14,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x06,0x1d,0x03,
-    0x00,0x00,0x00,0x00,0x14,0x1b,0x02,
-    0x00,0x19,0x1f,0x1f,0x1e,0x03,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'h'
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x0e,0x1e,0x1f,0x13,0x00,
-    0x01,0x1d,0x1b,0x02,0x0a,0x1e,0x03,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'i'
-    0x06,0x1e,0x09,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // 'j'
-    0x06,0x1e,0x09,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x03,
-    0x0a,0x1b,0x02,
-    0x1f,0x09,0x00,
-    0x00,0x00,0x00,
-
-    // 'k'
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x01,0x1d,0x18,
-    0x01,0x1c,0x0a,0x19,0x0e,0x00,
-    0x01,0x1c,0x1b,0x13,0x00,0x00,
-    0x01,0x1d,0x1b,0x18,0x00,0x00,
-    0x01,0x1c,0x09,0x14,0x13,0x00,
-    0x01,0x1c,0x09,0x00,0x19,0x1b,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'l'
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x01,0x1c,0x09,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // 'm'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x0e,0x1e,0x1f,0x0e,0x0f,0x1f,0x1f,0x13,0x00,
-    0x01,0x1d,0x1b,0x02,0x0a,0x1f,0x13,0x00,0x0a,0x1e,0x03,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'n'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x12,0x1f,0x1f,0x13,0x00,
-    0x01,0x1d,0x18,0x00,0x0a,0x1e,0x03,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'o'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x06,0x1e,0x1f,0x1f,0x0e,0x00,
-    0x01,0x1d,0x0e,0x00,0x06,0x1e,0x09,
-    0x06,0x1d,0x03,0x00,0x00,0x14,0x0e,
-    0x06,0x1d,0x03,0x00,0x00,0x14,0x0e,
-    0x01,0x1d,0x0e,0x00,0x06,0x1d,0x03,
-    0x00,0x06,0x1e,0x1f,0x1f,0x09,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'p'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x0e,0x1e,0x1f,0x13,0x00,
-    0x01,0x1d,0x1b,0x02,0x06,0x1e,0x09,
-    0x01,0x1c,0x09,0x00,0x00,0x14,0x0e,
-    0x01,0x1c,0x09,0x00,0x00,0x19,0x0e,
-    0x01,0x1d,0x13,0x00,0x06,0x1d,0x03,
-    0x01,0x1c,0x17,0x1f,0x1f,0x0e,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'q'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x06,0x1e,0x1f,0x14,0x1c,0x09,
-    0x01,0x1d,0x0e,0x00,0x0f,0x1f,0x09,
-    0x06,0x1a,0x02,0x00,0x01,0x1c,0x09,
-    0x06,0x1a,0x02,0x00,0x01,0x1c,0x09,
-    0x01,0x1d,0x0e,0x00,0x0f,0x1f,0x09,
-    0x00,0x0a,0x1f,0x1f,0x14,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x01,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'r'
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x17,0x1e,
-    0x01,0x1d,0x13,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // 's'
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x19,0x1f,0x1f,0x0e,
-    0x0a,0x18,0x00,0x00,0x00,
-    0x06,0x1e,0x13,0x00,0x00,
-    0x00,0x00,0x0f,0x1f,0x0e,
-    0x00,0x00,0x00,0x0f,0x13,
-    0x0a,0x1f,0x1f,0x1e,0x03,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // 't'
-    0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x1d,0x1f,0x1f,0x18,
-    0x01,0x1c,0x09,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x00,0x14,0x1f,0x18,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // 'u'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x01,0x1c,0x09,0x00,0x01,0x1c,0x09,
-    0x00,0x19,0x0e,0x00,0x0a,0x1f,0x09,
-    0x00,0x0a,0x1f,0x1f,0x19,0x1c,0x09,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'v'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x19,0x0e,0x00,0x00,0x0a,0x1b,
-    0x0a,0x18,0x00,0x00,0x14,0x0e,
-    0x01,0x1c,0x03,0x01,0x18,0x02,
-    0x00,0x0f,0x13,0x0f,0x13,0x00,
-    0x00,0x06,0x1a,0x19,0x03,0x00,
-    0x00,0x00,0x19,0x18,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'w'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x14,0x0e,0x00,0x01,0x1c,0x09,0x00,0x06,0x16,
-    0x0a,0x18,0x00,0x0a,0x1b,0x13,0x00,0x0f,0x13,
-    0x06,0x1a,0x02,0x14,0x0e,0x1a,0x02,0x18,0x09,
-    0x00,0x18,0x0b,0x18,0x02,0x18,0x0a,0x1a,0x02,
-    0x00,0x0f,0x1b,0x13,0x00,0x0f,0x16,0x13,0x00,
-    0x00,0x06,0x1e,0x09,0x00,0x06,0x1e,0x09,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'x'
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x19,0x13,0x00,0x0a,0x1b,
-    0x01,0x1c,0x05,0x1c,0x03,
-    0x00,0x0a,0x1f,0x0e,0x00,
-    0x00,0x0a,0x1f,0x0e,0x00,
-    0x01,0x1c,0x05,0x1c,0x03,
-    0x19,0x13,0x00,0x0f,0x1b,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // 'y'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x19,0x0e,0x00,0x00,0x0a,0x1b,
-    0x0a,0x18,0x00,0x00,0x14,0x0e,
-    0x01,0x1c,0x03,0x01,0x18,0x02,
-    0x00,0x0f,0x13,0x0f,0x13,0x00,
-    0x00,0x06,0x1a,0x19,0x09,0x00,
-    0x00,0x00,0x14,0x18,0x00,0x00,
-    0x00,0x00,0x14,0x0e,0x00,0x00,
-    0x00,0x06,0x1a,0x02,0x00,0x00,
-    0x19,0x1f,0x09,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'z'
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x0f,0x1f,0x1f,0x1f,0x18,
-    0x00,0x00,0x01,0x1c,0x03,
-    0x00,0x00,0x14,0x0e,0x00,
-    0x00,0x0a,0x18,0x00,0x00,
-    0x01,0x1c,0x03,0x00,0x00,
-    0x14,0x1f,0x1f,0x1f,0x1b,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // '{'
-    0x00,0x0f,0x1e,0x03,
-    0x01,0x1c,0x09,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x06,0x1d,0x03,0x00,
-    0x1c,0x03,0x00,0x00,
-    0x06,0x1d,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x03,0x00,
-    0x01,0x1c,0x09,0x00,
-    0x00,0x0f,0x1e,0x03,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // '|'
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x01,0x1c,0x03,
-    0x00,0x00,0x00,
-
-    // '}'
-    0x00,0x19,0x13,0x00,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x00,0x18,0x09,
-    0x00,0x00,0x01,0x1c,
-    0x00,0x00,0x18,0x09,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x01,0x1c,0x03,
-    0x00,0x19,0x13,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // '~'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x0a,0x1f,0x1e,0x03,0x06,0x16,0x00,
-    0x00,0x18,0x03,0x06,0x1e,0x1f,0x0e,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-};
-
-const uint16 segoe_ui_offsets[] = {
-    0, 39, 78, 143, 234, 312, 442, 572, 611, 663, 715, 780, 884, 923, 988, 1027, 1092, 1170, 1248, 1326, 1404, 1482, 1560, 1638, 1716, 1794, 1872, 1911, 1950, 2054, 2158, 2262, 2327, 2470, 2574, 2665, 2769, 2873, 2951, 3029, 3133, 3250, 3289, 3341, 3432, 3510, 3653, 3770, 3887, 3978, 4095, 4186, 4264, 4355, 4459, 4550, 4693, 4784, 4875, 4966, 5018, 5083, 5135, 5239, 5304, 5343, 5421, 5512, 5590, 5681, 5759, 5811, 5902, 5993, 6032, 6071, 6149, 6188, 6331, 6422, 6513, 6604, 6695, 6747, 6812, 6864, 6955, 7033, 7150, 7215, 7293, 7358, 7410, 7449, 7501
+    // ' ' 0x0 at 0,0
+    // '!' 2x9 at 1,0
+    0xe1,0xe1,0xe1,0xe1,0xc1,0xa1,0x00,0xe1,0xe1,
+    // '"' 4x3 at 1,0
+    0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,
+    // '#' 7x8 at 0,0
+    0x00,0x39,0x0a,0x00,0x07,0x73,0x90,0x5f,0xff,0xff,0xd0,0x0a,0x19,0x10,0x00,0xa0,0xa1,0x0c,0xff,0xff,0xf7,0x07,0x75,0x90,0x00,0xa4,0x77,0x00,
+    // '$' 6x10 at 0,0
+    0x05,0xff,0xd1,0x0e,0x56,0x51,0x3d,0x46,0x00,0x0e,0x96,0x00,0x00,0xef,0x10,0x00,0x3a,0xf1,0x00,0x36,0xa7,0x36,0x36,0xc4,0x0c,0xff,0x90,0x00,0x36,0x00,
+    // '%' 9x9 at 1,0
+    0x7f,0xf7,0x00,0xa7,0x0c,0x10,0xc1,0x3b,0x00,0xc1,0x0c,0x1c,0x10,0x07,0xff,0x77,0x70,0x00,0x00,0x00,0xc1,0x00,0x00,0x00,0xa4,0x7f,0xf7,0x00,0x3b,0x0c,0x10,0xc0,0x0c,0x10,0xc1,0x0c,0x07,0x90,0x07,0xff,0x70,
+    // '&' 10x9 at 0,0
+    0x00,0x7f,0xfc,0x00,0x00,0x03,0xe1,0x0e,0x40,0x00,0x03,0xd1,0x0c,0x43,0xd1,0x00,0xaf,0xf4,0x03,0xd1,0x05,0xf5,0xec,0x05,0xc0,0x3e,0x10,0x0a,0x9a,0x70,0x5d,0x10,0x00,0xcc,0x00,0x0e,0x70,0x05,0xff,0x10,0x03,0xff,0xfd,0x17,0xfd,
+    // ''' 2x3 at 1,0
+    0xc1,0xc1,0xc1,
+    // '(' 3x11 at 1,0
+    0x07,0xc3,0xd1,0x79,0x0c,0x40,0xe1,0x0e,0x10,0xe1,0x0c,0x40,0x79,0x03,0xd1,0x07,0xc0,
+    // ')' 4x11 at 0,0
+    0xa9,0x00,0x0c,0x40,0x05,0xc0,0x03,0xd1,0x00,0xe1,0x00,0xc4,0x00,0xe1,0x03,0xd1,0x05,0xc0,0x0c,0x40,0xac,0x00,
+    // '*' 5x4 at 0,0
+    0x00,0xa1,0x07,0xca,0xb9,0x05,0xf7,0x00,0xc1,0xc1,
+    // '+' 7x5 at 0,3
+    0x00,0x0c,0x10,0x00,0x00,0xc1,0x00,0x3f,0xff,0xff,0x70,0x00,0xc1,0x00,0x00,0x0c,0x10,0x00,
+    // ',' 3x3 at 0,8
+    0x5d,0x1a,0x70,0xe1,0x00,
+    // '-' 5x1 at 0,5
+    0x3f,0xff,0x10,
+    // '.' 2x2 at 1,7
+    0xe4,0xe4,
+    // '/' 5x10 at 0,0
+    0x00,0x05,0xc0,0x00,0xc4,0x00,0x3b,0x00,0x07,0x70,0x00,0xe1,0x00,0x59,0x00,0x0c,0x40,0x03,0xb0,0x00,0x77,0x00,0x0c,0x10,0x00,
+    // '0' 6x9 at 0,0
+    0x05,0xff,0x90,0x0e,0x10,0xe4,0x5c,0x00,0x79,0x79,0x00,0x5c,0x79,0x00,0x5c,0x79,0x00,0x5c,0x5c,0x00,0x79,0x3e,0x10,0xe4,0x05,0xff,0x70,
+    // '1' 4x9 at 1,0
+    0x05,0xf1,0xcc,0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe1,
+    // '2' 6x9 at 0,0
+    0x0a,0xff,0x90,0x36,0x00,0xe4,0x00,0x00,0xc4,0x00,0x00,0xe1,0x00,0x0a,0x90,0x00,0xc9,0x00,0x0c,0x40,0x00,0x5c,0x00,0x00,0x7f,0xff,0xf9,
+    // '3' 6x9 at 0,0
+    0x0c,0xff,0x70,0x05,0x03,0xe1,0x00,0x00,0xe1,0x00,0x05,0xc0,0x07,0xfc,0x00,0x00,0x05,0xf4,0x00,0x00,0xa7,0x41,0x00,0xe4,0x3f,0xff,0x70,
+    // '4' 6x9 at 0,0
+    0x00,0x07,0xd1,0x00,0x0e,0xd1,0x00,0x79,0xd1,0x03,0xb3,0xd1,0x0c,0x43,0xd1,0x79,0x03,0xd1,0xef,0xff,0xfd,0x00,0x03,0xd1,0x00,0x03,0xd1,
+    // '5' 5x9 at 1,0
+    0x7f,0xff,0x1a,0x70,0x00,0xa4,0x00,0x0c,0xff,0x90,0x00,0x0e,0x40,0x00,0xa9,0x00,0x0a,0x70,0x03,0xf4,0xef,0xf7,0x00,
+    // '6' 6x9 at 0,0
+    0x00,0xaf,0xf4,0x0a,0x90,0x00,0x0c,0x10,0x00,0x5c,0xef,0xd1,0x5f,0x40,0xa9,0x5c,0x00,0x5c,0x5c,0x00,0x5c,0x0e,0x40,0xc7,0x03,0xff,0xc0,
+    // '7' 6x9 at 0,0
+    0x7f,0xff,0xff,0x00,0x00,0x79,0x00,0x00,0xe1,0x00,0x05,0x90,0x00,0x0c,0x40,0x00,0x3b,0x00,0x00,0x77,0x00,0x00,0xc4,0x00,0x00,0xe1,0x00,
+    // '8' 6x9 at 0,0
+    0x05,0xff,0x90,0x0e,0x40,0xe4,0x3d,0x10,0xa7,0x0c,0x40,0xe1,0x03,0xff,0x70,0x3d,0x10,0xa7,0x79,0x00,0x5c,0x5d,0x10,0xa9,0x07,0xff,0xc0,
+    // '9' 6x9 at 0,0
+    0x05,0xff,0x90,0x3e,0x10,0xe4,0x79,0x00,0x79,0x79,0x00,0x79,0x5f,0x10,0xc9,0x07,0xff,0xb9,0x00,0x00,0xa7,0x00,0x05,0xd1,0x0e,0xff,0x10,
+    // ':' 3x6 at 0,3
+    0x5d,0x15,0xd1,0x00,0x00,0x00,0x5d,0x15,0xd1,
+    // ';' 3x8 at 0,3
+    0x5d,0x15,0xd1,0x00,0x00,0x00,0x00,0x05,0xd1,0xa7,0x0e,0x10,
+    // '<' 6x6 at 1,2
+    0x00,0x00,0xa4,0x00,0x5f,0x70,0x3f,0xc0,0x00,0xaf,0x40,0x00,0x00,0xcf,0x10,0x00,0x00,0xe4,
+    // '=' 7x4 at 0,4
+    0x3f,0xff,0xff,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0xf7,
+    // '>' 6x6 at 1,2
+    0xc1,0x00,0x00,0x0e,0xc0,0x00,0x00,0x5f,0x70,0x00,0x0c,0xf1,0x0c,0xf4,0x00,0xc4,0x00,0x00,
+    // '?' 5x9 at 0,0
+    0x0e,0xff,0x14,0x40,0xa9,0x00,0x07,0x90,0x05,0xd1,0x03,0xd1,0x00,0x5c,0x00,0x00,0x00,0x00,0x3e,0x10,0x03,0xe1,0x00,
+    // '@' 10x10 at 1,0
+    0x00,0x7f,0xff,0xd1,0x00,0x0c,0xc0,0x00,0x5f,0x10,0x79,0x0c,0xfd,0x95,0xc0,0xc1,0x79,0x0a,0x70,0xc1,0xc1,0xa4,0x07,0x70,0xa4,0xa0,0xc1,0x07,0x40,0xc1,0xe1,0xa4,0x0e,0x73,0xb0,0xa9,0x3f,0xf5,0xff,0x10,0x0e,0x90,0x00,0x00,0x00,0x00,0xaf,0xff,0xf1,0x00,
+    // 'A' 8x9 at 0,0
+    0x00,0x0a,0xc0,0x00,0x00,0x3d,0xd4,0x00,0x00,0x79,0x79,0x00,0x00,0xc4,0x3d,0x10,0x03,0xd1,0x0c,0x40,0x07,0x90,0x07,0xc0,0x0e,0xff,0xff,0xf1,0x5d,0x10,0x00,0xc7,0xa9,0x00,0x00,0x7c,
+    // 'B' 6x9 at 1,0
+    0xef,0xff,0x70,0xe4,0x03,0xe1,0xe4,0x00,0xe4,0xe4,0x05,0xc0,0xef,0xff,0x10,0xe4,0x03,0xf4,0xe4,0x00,0xc7,0xe4,0x03,0xf4,0xef,0xff,0x40,
+    // 'C' 8x9 at 0,0
+    0x00,0x0c,0xff,0xd1,0x03,0xf7,0x00,0x36,0x0c,0x70,0x00,0x00,0x3e,0x10,0x00,0x00,0x3d,0x10,0x00,0x00,0x3e,0x10,0x00,0x00,0x0c,0x70,0x00,0x00,0x05,0xf7,0x00,0x36,0x00,0x3f,0xff,0xd1,
+    // 'D' 7x9 at 1,0
+    0xef,0xff,0x90,0x0e,0x40,0x0e,0xc0,0xe4,0x00,0x3e,0x1e,0x40,0x00,0xc7,0xe4,0x00,0x0c,0x7e,0x40,0x00,0xc4,0xe4,0x00,0x3e,0x1e,0x40,0x0e,0x70,0xef,0xff,0x40,0x00,
+    // 'E' 5x9 at 1,0
+    0xef,0xff,0x7e,0x40,0x00,0xe4,0x00,0x0e,0x40,0x00,0xef,0xff,0x1e,0x40,0x00,0xe4,0x00,0x0e,0x40,0x00,0xef,0xff,0x90,
+    // 'F' 5x9 at 1,0
+    0xef,0xff,0x9e,0x40,0x00,0xe4,0x00,0x0e,0x40,0x00,0xef,0xff,0x7e,0x40,0x00,0xe4,0x00,0x0e,0x40,0x00,0xe4,0x00,0x00,
+    // 'G' 8x9 at 0,0
+    0x00,0x3f,0xff,0xd1,0x03,0xf4,0x00,0x91,0x0c,0x70,0x00,0x00,0x3e,0x10,0x00,0x00,0x3d,0x10,0x7f,0xf4,0x3e,0x10,0x00,0xe4,0x0e,0x40,0x00,0xe4,0x07,0xf1,0x00,0xe4,0x00,0x5f,0xff,0x90,
+    // 'H' 8x9 at 1,0
+    0xe4,0x00,0x00,0xe4,0xe4,0x00,0x00,0xe4,0xe4,0x00,0x00,0xe4,0xe4,0x00,0x00,0xe4,0xef,0xff,0xff,0xf4,0xe4,0x00,0x00,0xe4,0xe4,0x00,0x00,0xe4,0xe4,0x00,0x00,0xe4,0xe4,0x00,0x00,0xe4,
+    // 'I' 2x9 at 1,0
+    0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,
+    // 'J' 4x9 at 0,0
+    0x00,0xe4,0x00,0xe4,0x00,0xe4,0x00,0xe4,0x00,0xe4,0x00,0xe4,0x00,0xe4,0x05,0xd1,0xef,0x40,
+    // 'K' 6x9 at 1,0
+    0xe4,0x00,0xcc,0xe4,0x0a,0x90,0xe4,0x7c,0x00,0xe9,0xd1,0x00,0xef,0x70,0x00,0xe7,0xf4,0x00,0xe4,0x5f,0x10,0xe4,0x07,0xd1,0xe4,0x00,0xad,
+    // 'L' 5x9 at 1,0
+    0xe4,0x00,0x0e,0x40,0x00,0xe4,0x00,0x0e,0x40,0x00,0xe4,0x00,0x0e,0x40,0x00,0xe4,0x00,0x0e,0x40,0x00,0xef,0xff,0x90,
+    // 'M' 10x9 at 1,0
+    0xec,0x00,0x00,0x07,0xf4,0xed,0x40,0x00,0x0e,0xf4,0xeb,0x90,0x00,0x5c,0xe4,0xe5,0xe1,0x00,0xc5,0xe4,0xe4,0xa7,0x03,0xd1,0xe4,0xe4,0x3d,0x1a,0x70,0xe4,0xe4,0x0c,0x7d,0x10,0xe4,0xe4,0x05,0xf9,0x00,0xe4,0xe4,0x00,0xc1,0x00,0xe4,
+    // 'N' 8x9 at 1,0
+    0xec,0x00,0x00,0xe4,0xed,0x70,0x00,0xe4,0xe7,0xd1,0x00,0xe4,0xe4,0xa9,0x00,0xe4,0xe4,0x0e,0x40,0xe4,0xe4,0x05,0xc0,0xe4,0xe4,0x00,0xc7,0xe4,0xe4,0x00,0x3f,0xf4,0xe4,0x00,0x07,0xf4,
+    // 'O' 9x9 at 0,0
+    0x00,0x5f,0xff,0x90,0x00,0x5f,0x40,0x0c,0x90,0x0c,0x70,0x00,0x3e,0x13,0xe1,0x00,0x00,0xc4,0x3d,0x10,0x00,0x0c,0x73,0xe1,0x00,0x00,0xc4,0x0c,0x70,0x00,0x3e,0x10,0x5f,0x10,0x0e,0x90,0x00,0x5f,0xff,0x70,0x00,
+    // 'P' 6x9 at 1,0
+    0xef,0xff,0x40,0xe4,0x07,0xd1,0xe4,0x00,0xe4,0xe4,0x00,0xe4,0xe4,0x07,0xd1,0xef,0xff,0x10,0xe4,0x00,0x00,0xe4,0x00,0x00,0xe4,0x00,0x00,
+    // 'Q' 9x10 at 0,0
+    0x00,0x7f,0xff,0xc0,0x00,0x7f,0x10,0x0a,0xc0,0x3e,0x10,0x00,0x0c,0x45,0xc0,0x00,0x00,0xa9,0x7c,0x00,0x00,0x07,0x95,0xc0,0x00,0x00,0x79,0x3e,0x10,0x00,0x0c,0x40,0xad,0x10,0x0c,0xc0,0x00,0x7f,0xff,0xf4,0x00,0x00,0x00,0x03,0xff,
+    // 'R' 6x9 at 1,0
+    0xef,0xff,0x70,0xe4,0x05,0xf1,0xe4,0x00,0xe4,0xe4,0x05,0xd1,0xef,0xfc,0x00,0xe4,0x3e,0x10,0xe4,0x07,0x90,0xe4,0x00,0xe4,0xe4,0x00,0x7d,
+    // 'S' 6x9 at 0,0
+    0x05,0xff,0xf1,0x3e,0x10,0x36,0x5d,0x10,0x00,0x0e,0x90,0x00,0x00,0xcf,0x70,0x00,0x03,0xf7,0x00,0x00,0x7c,0x44,0x00,0xc9,0x0e,0xff,0xc0,
+    // 'T' 7x9 at 0,0
+    0xaf,0xff,0xff,0x90,0x00,0xe4,0x00,0x00,0x0e,0x40,0x00,0x00,0xe4,0x00,0x00,0x0e,0x40,0x00,0x00,0xe4,0x00,0x00,0x0e,0x40,0x00,0x00,0xe4,0x00,0x00,0x0e,0x40,0x00,
+    // 'U' 7x9 at 1,0
+    0xe4,0x00,0x0e,0x4e,0x40,0x00,0xe4,0xe4,0x00,0x0e,0x4e,0x40,0x00,0xe4,0xe4,0x00,0x0e,0x4e,0x40,0x00,0xe4,0xc4,0x00,0x3e,0x1a,0xd1,0x0a,0xc0,0x0c,0xff,0xd1,0x00,
+    // 'V' 7x9 at 0,0
+    0xa9,0x00,0x05,0xc5,0xc0,0x00,0xa7,0x3e,0x10,0x0e,0x10,0xc7,0x05,0xc0,0x07,0x90,0xa7,0x00,0x3d,0x1c,0x40,0x00,0xc7,0xd1,0x00,0x07,0xf9,0x00,0x00,0x3f,0x40,0x00,
+    // 'W' 11x9 at 0,0
+    0xa7,0x00,0x0e,0x40,0x05,0xc5,0xc0,0x03,0xf9,0x00,0x79,0x3d,0x10,0x79,0xb0,0x0c,0x40,0xc4,0x0c,0x5e,0x10,0xe1,0x0a,0x70,0xc1,0xa4,0x5c,0x00,0x5c,0x5c,0x07,0x97,0x90,0x03,0xd8,0x70,0x3b,0xc4,0x00,0x0c,0xf4,0x00,0xef,0x10,0x00,0x7d,0x10,0x0a,0xc0,0x00,
+    // 'X' 7x9 at 0,0
+    0x5d,0x10,0x0a,0x90,0xa7,0x03,0xd1,0x03,0xd1,0xa7,0x00,0x07,0xdc,0x00,0x00,0x0e,0x40,0x00,0x0a,0xbd,0x10,0x05,0xd1,0xc7,0x00,0xc4,0x03,0xe1,0xac,0x00,0x0a,0xc0,
+    // 'Y' 7x9 at 0,0
+    0xa9,0x00,0x05,0xc3,0xe1,0x00,0xc4,0x0a,0x90,0x5c,0x00,0x3d,0x1c,0x70,0x00,0xa9,0xd1,0x00,0x05,0xf7,0x00,0x00,0x0e,0x40,0x00,0x00,0xe4,0x00,0x00,0x0e,0x40,0x00,
+    // 'Z' 7x9 at 0,0
+    0x7f,0xff,0xff,0xc0,0x00,0x05,0xf1,0x00,0x00,0xe7,0x00,0x00,0x7c,0x00,0x00,0x3f,0x40,0x00,0x0c,0x90,0x00,0x07,0xd1,0x00,0x00,0xe4,0x00,0x00,0xaf,0xff,0xff,0xc0,
+    // '[' 3x11 at 1,0
+    0xef,0x4e,0x10,0xe1,0x0e,0x10,0xe1,0x0e,0x10,0xe1,0x0e,0x10,0xe1,0x0e,0x10,0xef,0x40,
+    // '\' 5x10 at 0,0
+    0xe1,0x00,0x0a,0x70,0x00,0x3b,0x00,0x00,0xc4,0x00,0x05,0x90,0x00,0x0c,0x10,0x00,0xa7,0x00,0x03,0xb0,0x00,0x0c,0x40,0x00,0x59,
+    // ']' 4x11 at 0,0
+    0x5f,0xf1,0x00,0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe1,0x00,0xe1,0x5f,0xf1,
+    // '^' 6x5 at 1,0
+    0x00,0x79,0x00,0x00,0xcd,0x10,0x05,0x95,0x90,0x0c,0x10,0xc1,0x79,0x00,0x5c,
+    // '_' 5x1 at 0,10
+    0xef,0xff,0xf0,
+    // '`' 3x2 at 0,0
+    0x5d,0x10,0x5c,
+    // 'a' 6x6 at 0,3
+    0x0a,0xff,0xc0,0x00,0x00,0xe4,0x05,0xff,0xf4,0x3e,0x10,0xc4,0x5d,0x13,0xf4,0x0c,0xfe,0xd4,
+    // 'b' 6x9 at 1,0
+    0xe4,0x00,0x00,0xe4,0x00,0x00,0xe4,0x00,0x00,0xe7,0xff,0x90,0xed,0x13,0xf4,0xe4,0x00,0xa7,0xe4,0x00,0xc7,0xe9,0x03,0xe1,0xeb,0xff,0x70,
+    // 'c' 6x6 at 0,3
+    0x00,0xcf,0xf7,0x0c,0x90,0x00,0x3e,0x10,0x00,0x3e,0x10,0x00,0x0c,0x90,0x00,0x00,0xef,0xf7,
+    // 'd' 7x9 at 0,0
+    0x00,0x00,0x0e,0x40,0x00,0x00,0xe4,0x00,0x00,0x0e,0x40,0x3f,0xfa,0xe4,0x0e,0x70,0x7f,0x43,0xd1,0x00,0xe4,0x3d,0x10,0x0e,0x40,0xe7,0x07,0xf4,0x05,0xff,0xae,0x40,
+    // 'e' 6x6 at 0,3
+    0x03,0xff,0xf1,0x0e,0x40,0x59,0x3f,0xff,0xfc,0x3e,0x10,0x00,0x0e,0x90,0x00,0x03,0xff,0xfc,
+    // 'f' 4x9 at 0,0
+    0x05,0xfd,0x0e,0x70,0x0e,0x40,0xef,0xf9,0x0e,0x40,0x0e,0x40,0x0e,0x40,0x0e,0x40,0x0e,0x40,
+    // 'g' 7x9 at 0,3
+    0x03,0xff,0xae,0x40,0xe7,0x07,0xf4,0x3d,0x10,0x0e,0x43,0xd1,0x00,0xe4,0x0e,0x70,0x7f,0x40,0x5f,0xfa,0xe4,0x00,0x00,0x3e,0x10,0x00,0x0a,0xd1,0x0c,0xff,0xf1,0x00,
+    // 'h' 6x9 at 1,0
+    0xe4,0x00,0x00,0xe4,0x00,0x00,0xe4,0x00,0x00,0xe7,0xff,0x90,0xed,0x15,0xf1,0xe4,0x00,0xe4,0xe4,0x00,0xe4,0xe4,0x00,0xe4,0xe4,0x00,0xe4,
+    // 'i' 3x9 at 0,0
+    0x3f,0x40,0x00,0x00,0x00,0xe4,0x0e,0x40,0xe4,0x0e,0x40,0xe4,0x0e,0x40,
+    // 'j' 3x12 at 0,0
+    0x3f,0x40,0x00,0x00,0x00,0xe4,0x0e,0x40,0xe4,0x0e,0x40,0xe4,0x0e,0x40,0xe1,0x5d,0x1f,0x40,
+    // 'k' 5x9 at 1,0
+    0xe4,0x00,0x0e,0x40,0x00,0xe4,0x00,0x0e,0x40,0xec,0xe5,0xc7,0x0e,0xd9,0x00,0xed,0xc0,0x0e,0x4a,0x90,0xe4,0x0c,0xd0,
+    // 'l' 2x9 at 1,0
+    0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,
+    // 'm' 10x6 at 1,3
+    0xe7,0xff,0x77,0xff,0x90,0xed,0x15,0xf9,0x05,0xf1,0xe4,0x00,0xe4,0x00,0xe4,0xe4,0x00,0xe4,0x00,0xe4,0xe4,0x00,0xe4,0x00,0xe4,0xe4,0x00,0xe4,0x00,0xe4,
+    // 'n' 6x6 at 1,3
+    0xe9,0xff,0x90,0xec,0x05,0xf1,0xe4,0x00,0xe4,0xe4,0x00,0xe4,0xe4,0x00,0xe4,0xe4,0x00,0xe4,
+    // 'o' 7x6 at 0,3
+    0x03,0xff,0xf7,0x00,0xe7,0x03,0xf4,0x3e,0x10,0x0a,0x73,0xe1,0x00,0xa7,0x0e,0x70,0x3e,0x10,0x3f,0xff,0x40,
+    // 'p' 6x9 at 1,3
+    0xe7,0xff,0x90,0xed,0x13,0xf4,0xe4,0x00,0xa7,0xe4,0x00,0xc7,0xe9,0x03,0xe1,0xeb,0xff,0x70,0xe4,0x00,0x00,0xe4,0x00,0x00,0xe4,0x00,0x00,
+    // 'q' 7x9 at 0,3
+    0x03,0xff,0xae,0x40,0xe7,0x07,0xf4,0x3d,0x10,0x0e,0x43,0xd1,0x00,0xe4,0x0e,0x70,0x7f,0x40,0x5f,0xfa,0xe4,0x00,0x00,0x0e,0x40,0x00,0x00,0xe4,0x00,0x00,0x0e,0x40,
+    // 'r' 3x6 at 1,3
+    0xeb,0xfe,0x90,0xe4,0x0e,0x40,0xe4,0x0e,0x40,
+    // 's' 5x6 at 0,3
+    0x0c,0xff,0x75,0xc0,0x00,0x3f,0x90,0x00,0x07,0xf7,0x00,0x07,0x95,0xff,0xf1,
+    // 't' 4x8 at 0,1
+    0x0e,0x40,0x0e,0x40,0xef,0xfc,0x0e,0x40,0x0e,0x40,0x0e,0x40,0x0e,0x40,0x0a,0xfc,
+    // 'u' 6x6 at 1,3
+    0xe4,0x00,0xe4,0xe4,0x00,0xe4,0xe4,0x00,0xe4,0xe4,0x00,0xe4,0xc7,0x05,0xf4,0x5f,0xfc,0xe4,
+    // 'v' 6x6 at 0,3
+    0xc7,0x00,0x5d,0x5c,0x00,0xa7,0x0e,0x10,0xc1,0x07,0x97,0x90,0x03,0xdc,0x10,0x00,0xcc,0x00,
+    // 'w' 9x6 at 0,3
+    0xa7,0x00,0xe4,0x03,0xb5,0xc0,0x5d,0x90,0x79,0x3d,0x1a,0x7d,0x1c,0x40,0xc5,0xc1,0xc5,0xd1,0x07,0xd9,0x07,0xb9,0x00,0x3f,0x40,0x3f,0x40,
+    // 'x' 5x6 at 0,3
+    0xc9,0x05,0xd0,0xe2,0xe1,0x05,0xf7,0x00,0x5f,0x70,0x0e,0x2e,0x1c,0x90,0x7d,
+    // 'y' 6x9 at 0,3
+    0xc7,0x00,0x5d,0x5c,0x00,0xa7,0x0e,0x10,0xc1,0x07,0x97,0x90,0x03,0xdd,0x40,0x00,0xac,0x00,0x00,0xa7,0x00,0x03,0xd1,0x00,0xcf,0x40,0x00,
+    // 'z' 5x6 at 0,3
+    0x7f,0xff,0xc0,0x00,0xe1,0x00,0xa7,0x00,0x5c,0x00,0x0e,0x10,0x0a,0xff,0xfd,
+    // '{' 4x11 at 0,0
+    0x07,0xf1,0x0e,0x40,0x0e,0x10,0x0e,0x10,0x3e,0x10,0xe1,0x00,0x3e,0x10,0x0e,0x10,0x0e,0x10,0x0e,0x40,0x07,0xf1,
+    // '|' 2x12 at 1,0
+    0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,0xe1,
+    // '}' 3x11 at 1,0
+    0xc9,0x00,0xe1,0x0e,0x10,0xe1,0x0c,0x40,0x0e,0x0c,0x40,0xe1,0x0e,0x10,0xe1,0xc9,0x00,
+    // '~' 6x2 at 1,5
+    0x5f,0xf1,0x3b,0xc1,0x3f,0xf7,
 };
 
-const uint8 segoe_ui_widths[] = {
-    3, 3, 5, 7, 6, 10, 10, 3, 4, 4, 5, 8, 3, 5, 3, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 3, 3, 8, 8, 8, 5, 11, 8, 7, 8, 8, 6, 6, 8, 9, 3, 4, 7, 6, 11, 9, 9, 7, 9, 7, 6, 7, 8, 7, 11, 7, 7, 7, 4, 5, 4, 8, 5, 3, 6, 7, 6, 7, 6, 4, 7, 7, 3, 3, 6, 3, 11, 7, 7, 7, 7, 4, 5, 4, 7, 6, 9, 5, 6, 5, 4, 3, 4, 8, 4, 6, 6, 3, 6, 5, 9, 5, 5, 4, 15, 6, 4, 11, 6, 7, 6, 6, 3, 3, 5, 5, 5, 6, 12, 4, 9, 5, 4, 11, 6, 5, 7, 3, 3, 6, 6, 7, 6, 3, 5, 5, 11, 5, 6, 8, 5, 11, 5, 5, 8, 4, 4, 3, 7, 6, 3, 2, 4, 5, 6, 11, 11, 11, 5, 8, 8, 8, 8, 8, 8, 10, 8, 6, 6, 6, 6, 3, 3, 3, 3, 8, 9, 9, 9, 9, 9, 9, 8, 9, 8, 8, 8, 8, 7, 7, 7, 6, 6, 6, 6, 6, 6, 10, 6, 6, 6, 6, 6, 3, 3, 3, 3, 7, 7, 7, 7, 7, 7, 7, 8, 7, 7, 7, 7, 7, 6, 7, 6
+const imglyph_t segoe_ui_glyphs[] = {
+    {0, 3, 0, 0, 0, 0}, // ' '
+    {0, 3, 1, 0, 2, 9}, // '!'
+    {9, 5, 1, 0, 4, 3}, // '"'
+    {15, 7, 0, 0, 7, 8}, // '#'
+    {43, 6, 0, 0, 6, 10}, // '$'
+    {73, 10, 1, 0, 9, 9}, // '%'
+    {114, 10, 0, 0, 10, 9}, // '&'
+    {159, 3, 1, 0, 2, 3}, // '''
+    {162, 4, 1, 0, 3, 11}, // '('
+    {179, 4, 0, 0, 4, 11}, // ')'
+    {201, 5, 0, 0, 5, 4}, // '*'
+    {211, 8, 0, 3, 7, 5}, // '+'
+    {229, 3, 0, 8, 3, 3}, // ','
+    {234, 5, 0, 5, 5, 1}, // '-'
+    {237, 3, 1, 7, 2, 2}, // '.'
+    {239, 5, 0, 0, 5, 10}, // '/'
+    {264, 6, 0, 0, 6, 9}, // '0'
+    {291, 6, 1, 0, 4, 9}, // '1'
+    {309, 6, 0, 0, 6, 9}, // '2'
+    {336, 6, 0, 0, 6, 9}, // '3'
+    {363, 6, 0, 0, 6, 9}, // '4'
+    {390, 6, 1, 0, 5, 9}, // '5'
+    {413, 6, 0, 0, 6, 9}, // '6'
+    {440, 6, 0, 0, 6, 9}, // '7'
+    {467, 6, 0, 0, 6, 9}, // '8'
+    {494, 6, 0, 0, 6, 9}, // '9'
+    {521, 3, 0, 3, 3, 6}, // ':'
+    {530, 3, 0, 3, 3, 8}, // ';'
+    {542, 8, 1, 2, 6, 6}, // '<'
+    {560, 8, 0, 4, 7, 4}, // '='
+    {574, 8, 1, 2, 6, 6}, // '>'
+    {592, 5, 0, 0, 5, 9}, // '?'
+    {615, 11, 1, 0, 10, 10}, // '@'
+    {665, 8, 0, 0, 8, 9}, // 'A'
+    {701, 7, 1, 0, 6, 9}, // 'B'
+    {728, 8, 0, 0, 8, 9}, // 'C'
+    {764, 8, 1, 0, 7, 9}, // 'D'
+    {796, 6, 1, 0, 5, 9}, // 'E'
+    {819, 6, 1, 0, 5, 9}, // 'F'
+    {842, 8, 0, 0, 8, 9}, // 'G'
+    {878, 9, 1, 0, 8, 9}, // 'H'
+    {914, 3, 1, 0, 2, 9}, // 'I'
+    {923, 4, 0, 0, 4, 9}, // 'J'
+    {941, 7, 1, 0, 6, 9}, // 'K'
+    {968, 6, 1, 0, 5, 9}, // 'L'
+    {991, 11, 1, 0, 10, 9}, // 'M'
+    {1036, 9, 1, 0, 8, 9}, // 'N'
+    {1072, 9, 0, 0, 9, 9}, // 'O'
+    {1113, 7, 1, 0, 6, 9}, // 'P'
+    {1140, 9, 0, 0, 9, 10}, // 'Q'
+    {1185, 7, 1, 0, 6, 9}, // 'R'
+    {1212, 6, 0, 0, 6, 9}, // 'S'
+    {1239, 7, 0, 0, 7, 9}, // 'T'
+    {1271, 8, 1, 0, 7, 9}, // 'U'
+    {1303, 7, 0, 0, 7, 9}, // 'V'
+    {1335, 11, 0, 0, 11, 9}, // 'W'
+    {1385, 7, 0, 0, 7, 9}, // 'X'
+    {1417, 7, 0, 0, 7, 9}, // 'Y'
+    {1449, 7, 0, 0, 7, 9}, // 'Z'
+    {1481, 4, 1, 0, 3, 11}, // '['
+    {1498, 5, 0, 0, 5, 10}, // '\'
+    {1523, 4, 0, 0, 4, 11}, // ']'
+    {1545, 8, 1, 0, 6, 5}, // '^'
+    {1560, 5, 0, 10, 5, 1}, // '_'
+    {1563, 3, 0, 0, 3, 2}, // '`'
+    {1566, 6, 0, 3, 6, 6}, // 'a'
+    {1584, 7, 1, 0, 6, 9}, // 'b'
+    {1611, 6, 0, 3, 6, 6}, // 'c'
+    {1629, 7, 0, 0, 7, 9}, // 'd'
+    {1661, 6, 0, 3, 6, 6}, // 'e'
+    {1679, 4, 0, 0, 4, 9}, // 'f'
+    {1697, 7, 0, 3, 7, 9}, // 'g'
+    {1729, 7, 1, 0, 6, 9}, // 'h'
+    {1756, 3, 0, 0, 3, 9}, // 'i'
+    {1770, 3, 0, 0, 3, 12}, // 'j'
+    {1788, 6, 1, 0, 5, 9}, // 'k'
+    {1811, 3, 1, 0, 2, 9}, // 'l'
+    {1820, 11, 1, 3, 10, 6}, // 'm'
+    {1850, 7, 1, 3, 6, 6}, // 'n'
+    {1868, 7, 0, 3, 7, 6}, // 'o'
+    {1889, 7, 1, 3, 6, 9}, // 'p'
+    {1916, 7, 0, 3, 7, 9}, // 'q'
+    {1948, 4, 1, 3, 3, 6}, // 'r'
+    {1957, 5, 0, 3, 5, 6}, // 's'
+    {1972, 4, 0, 1, 4, 8}, // 't'
+    {1988, 7, 1, 3, 6, 6}, // 'u'
+    {2006, 6, 0, 3, 6, 6}, // 'v'
+    {2024, 9, 0, 3, 9, 6}, // 'w'
+    {2051, 5, 0, 3, 5, 6}, // 'x'
+    {2066, 6, 0, 3, 6, 9}, // 'y'
+    {2093, 5, 0, 3, 5, 6}, // 'z'
+    {2108, 4, 0, 0, 4, 11}, // '{'
+    {2130, 3, 1, 0, 2, 12}, // '|'
+    {2142, 4, 1, 0, 3, 11}, // '}'
+    {2159, 8, 1, 5, 6, 2}, // '~'
 };
 
 imfont_t font_segoe_ui = {
     segoe_ui_bytes,
-    segoe_ui_offsets,
-    segoe_ui_widths,
+    segoe_ui_glyphs,
+    NULL, 0,
+    4,
     11, 13
 };
\ No newline at end of file
@@ -1,1347 +1,297 @@
 uint8 __eds__ titillium_web_bytes[] __attribute__((space(prog))) = {
-    // ' '
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // '!'
-    0x00,0x11,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x11,0x00,
-    0x00,0x11,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // '"'
-    0x00,0x0f,0x00,0x0f,0x00,
-    0x11,0x1c,0x11,0x1c,0x00,
-    0x11,0x1c,0x11,0x1c,0x00,
-    0x00,0x0f,0x00,0x0f,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // '#'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x17,0x17,0x00,0x1c,0x00,0x00,
-    0x00,0x17,0x17,0x00,0x1c,0x00,0x00,
-    0x18,0x1d,0x1d,0x1c,0x1f,0x1c,0x14,
-    0x00,0x17,0x17,0x00,0x1c,0x00,0x00,
-    0x00,0x17,0x17,0x00,0x1c,0x00,0x00,
-    0x18,0x1d,0x1d,0x1c,0x1f,0x1c,0x14,
-    0x00,0x17,0x17,0x00,0x1c,0x00,0x00,
-    0x00,0x17,0x17,0x00,0x1c,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '$'
-    0x00,0x00,0x00,0x11,0x13,0x00,0x00,
-    0x00,0x18,0x1d,0x1d,0x1d,0x19,0x00,
-    0x0c,0x1d,0x00,0x17,0x00,0x00,0x00,
-    0x0f,0x1d,0x00,0x1c,0x00,0x00,0x00,
-    0x00,0x19,0x1d,0x1c,0x0f,0x00,0x00,
-    0x00,0x00,0x0c,0x1d,0x1c,0x18,0x00,
-    0x00,0x00,0x00,0x17,0x00,0x1f,0x00,
-    0x00,0x00,0x11,0x17,0x0c,0x1d,0x00,
-    0x00,0x1c,0x1d,0x1d,0x1d,0x13,0x00,
-    0x00,0x00,0x17,0x0f,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '%'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x13,0x1b,0x19,0x00,0x1b,0x00,0x00,
-    0x1b,0x00,0x1c,0x0f,0x16,0x00,0x00,
-    0x16,0x16,0x1c,0x16,0x0c,0x00,0x00,
-    0x00,0x11,0x00,0x1b,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x18,0x0c,0x0f,0x00,
-    0x00,0x00,0x14,0x14,0x1b,0x1c,0x0f,
-    0x00,0x00,0x19,0x11,0x17,0x11,0x16,
-    0x00,0x00,0x18,0x00,0x1c,0x1b,0x0c,
-    0x00,0x00,0x0c,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '&'
-    0x00,0x00,0x0c,0x16,0x13,0x00,0x00,0x00,0x00,
-    0x00,0x0c,0x1d,0x17,0x1b,0x19,0x00,0x00,0x00,
-    0x00,0x11,0x17,0x00,0x00,0x1c,0x00,0x00,0x00,
-    0x00,0x0c,0x1d,0x00,0x17,0x18,0x00,0x00,0x00,
-    0x00,0x17,0x1d,0x1f,0x17,0x00,0x14,0x00,0x00,
-    0x13,0x1b,0x00,0x14,0x1d,0x00,0x1f,0x00,0x00,
-    0x17,0x17,0x00,0x00,0x14,0x1d,0x1b,0x00,0x00,
-    0x14,0x1b,0x00,0x00,0x00,0x1d,0x1c,0x00,0x00,
-    0x00,0x1c,0x1d,0x1c,0x1d,0x14,0x0f,0x1c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '''
-    0x00,0x0f,0x00,
-    0x11,0x1c,0x00,
-    0x11,0x1c,0x00,
-    0x00,0x0f,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // '('
-    0x00,0x14,0x18,
-    0x00,0x1b,0x11,
-    0x00,0x1f,0x00,
-    0x11,0x1c,0x00,
-    0x13,0x19,0x00,
-    0x17,0x17,0x00,
-    0x11,0x1b,0x00,
-    0x0c,0x1d,0x00,
-    0x00,0x1d,0x00,
-    0x00,0x18,0x14,
-    0x00,0x0c,0x13,
-    0x00,0x00,0x00,
-
-    // ')'
-    0x14,0x17,0x00,
-    0x00,0x1d,0x00,
-    0x00,0x1d,0x0c,
-    0x00,0x19,0x14,
-    0x00,0x17,0x17,
-    0x00,0x17,0x17,
-    0x00,0x17,0x17,
-    0x00,0x1b,0x13,
-    0x00,0x1f,0x00,
-    0x0f,0x1c,0x00,
-    0x11,0x0f,0x00,
-    0x00,0x00,0x00,
-
-    // '*'
-    0x00,0x00,0x0c,0x0c,0x00,
-    0x0c,0x19,0x18,0x0c,0x00,
-    0x00,0x16,0x1f,0x1c,0x14,
-    0x0c,0x18,0x19,0x0c,0x00,
-    0x00,0x00,0x0c,0x0f,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // '+'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x18,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
-    0x0c,0x17,0x17,0x1d,0x17,0x17,0x00,
-    0x0c,0x17,0x17,0x1d,0x17,0x17,0x00,
-    0x00,0x00,0x00,0x1c,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x18,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // ','
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x11,0x00,
-    0x11,0x1b,0x00,
-    0x16,0x16,0x00,
-    0x11,0x0c,0x00,
-    0x00,0x00,0x00,
-
-    // '-'
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x0f,0x1c,0x1c,0x1c,0x14,
-    0x00,0x11,0x11,0x11,0x0c,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // '.'
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x0c,0x14,0x00,
-    0x11,0x1c,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // '/'
-    0x00,0x00,0x00,0x0f,0x0c,
-    0x00,0x00,0x00,0x19,0x13,
-    0x00,0x00,0x00,0x1d,0x00,
-    0x00,0x00,0x16,0x17,0x00,
-    0x00,0x00,0x1d,0x0c,0x00,
-    0x00,0x11,0x19,0x00,0x00,
-    0x00,0x19,0x11,0x00,0x00,
-    0x00,0x1d,0x00,0x00,0x00,
-    0x16,0x16,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // '0'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x14,0x1d,0x1c,0x1d,0x0f,0x00,
-    0x0c,0x1d,0x00,0x00,0x0f,0x1d,0x00,
-    0x16,0x18,0x00,0x00,0x00,0x1d,0x0c,
-    0x17,0x17,0x00,0x00,0x00,0x1c,0x11,
-    0x17,0x17,0x00,0x00,0x00,0x1c,0x11,
-    0x17,0x17,0x00,0x00,0x00,0x1c,0x0f,
-    0x0f,0x1d,0x00,0x00,0x0f,0x1d,0x00,
-    0x00,0x18,0x1d,0x1c,0x1d,0x11,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '1'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x0c,0x1c,0x1c,0x00,0x00,
-    0x00,0x14,0x1d,0x17,0x1c,0x00,0x00,
-    0x00,0x0f,0x00,0x11,0x1c,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x1c,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x1c,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x1c,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x1c,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x1c,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '2'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1d,0x1c,0x1d,0x1d,0x0f,0x00,
-    0x00,0x00,0x00,0x00,0x16,0x19,0x00,
-    0x00,0x00,0x00,0x00,0x13,0x1b,0x00,
-    0x00,0x00,0x00,0x00,0x1c,0x13,0x00,
-    0x00,0x00,0x00,0x19,0x19,0x00,0x00,
-    0x00,0x00,0x19,0x19,0x00,0x00,0x00,
-    0x00,0x16,0x19,0x00,0x00,0x00,0x00,
-    0x0f,0x1f,0x1c,0x1c,0x1c,0x1c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '3'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1d,0x1c,0x1c,0x1d,0x0f,0x00,
-    0x00,0x00,0x00,0x00,0x13,0x1b,0x00,
-    0x00,0x00,0x00,0x00,0x13,0x1b,0x00,
-    0x00,0x0c,0x17,0x18,0x1d,0x0f,0x00,
-    0x00,0x00,0x11,0x11,0x1b,0x18,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x1f,0x00,
-    0x00,0x00,0x00,0x00,0x0f,0x1d,0x00,
-    0x0f,0x1d,0x1c,0x1c,0x1d,0x13,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '4'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x16,0x19,0x00,0x00,0x00,
-    0x00,0x00,0x1d,0x0c,0x00,0x00,0x00,
-    0x00,0x11,0x1c,0x00,0x00,0x00,0x00,
-    0x00,0x19,0x14,0x00,0x18,0x0f,0x00,
-    0x00,0x1d,0x00,0x00,0x1c,0x11,0x00,
-    0x14,0x1b,0x11,0x11,0x1d,0x16,0x00,
-    0x11,0x17,0x17,0x17,0x1d,0x19,0x0c,
-    0x00,0x00,0x00,0x00,0x1c,0x11,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '5'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x1f,0x1f,0x1f,0x1c,0x00,
-    0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1d,0x1d,0x1d,0x1d,0x13,0x00,
-    0x00,0x11,0x00,0x00,0x0f,0x1f,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x1f,0x00,
-    0x00,0x00,0x00,0x00,0x0f,0x1d,0x00,
-    0x0f,0x1d,0x1c,0x1c,0x1d,0x0f,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '6'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x0f,0x1d,0x1c,0x1c,0x1b,0x00,
-    0x00,0x1d,0x0f,0x00,0x00,0x00,0x00,
-    0x11,0x1b,0x00,0x00,0x00,0x00,0x00,
-    0x16,0x1c,0x1d,0x1f,0x1d,0x14,0x00,
-    0x16,0x19,0x00,0x00,0x0c,0x1f,0x00,
-    0x11,0x1b,0x00,0x00,0x00,0x1c,0x11,
-    0x00,0x1d,0x00,0x00,0x00,0x1f,0x00,
-    0x00,0x14,0x1d,0x1c,0x1d,0x14,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '7'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x1f,0x1f,0x1f,0x1c,0x00,
-    0x00,0x00,0x00,0x00,0x11,0x1b,0x00,
-    0x00,0x00,0x00,0x00,0x19,0x13,0x00,
-    0x00,0x00,0x00,0x0c,0x1d,0x00,0x00,
-    0x00,0x00,0x00,0x18,0x14,0x00,0x00,
-    0x00,0x00,0x00,0x1d,0x00,0x00,0x00,
-    0x00,0x00,0x17,0x17,0x00,0x00,0x00,
-    0x00,0x00,0x1d,0x0c,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '8'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x19,0x1d,0x1c,0x1d,0x16,0x00,
-    0x16,0x1b,0x00,0x00,0x00,0x1d,0x0c,
-    0x16,0x18,0x00,0x00,0x00,0x1d,0x0f,
-    0x00,0x1c,0x18,0x17,0x1c,0x17,0x00,
-    0x0f,0x1d,0x14,0x11,0x17,0x1d,0x00,
-    0x17,0x17,0x00,0x00,0x00,0x1c,0x11,
-    0x17,0x18,0x00,0x00,0x00,0x1d,0x11,
-    0x00,0x1c,0x1d,0x1c,0x1d,0x18,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '9'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x18,0x1d,0x1d,0x1c,0x00,0x00,
-    0x13,0x1c,0x00,0x00,0x16,0x19,0x00,
-    0x17,0x17,0x00,0x00,0x00,0x1f,0x00,
-    0x14,0x1b,0x00,0x00,0x00,0x1d,0x00,
-    0x00,0x19,0x1d,0x1d,0x1c,0x1d,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x1f,0x00,
-    0x00,0x00,0x00,0x00,0x14,0x1b,0x00,
-    0x0f,0x1c,0x1c,0x1c,0x1c,0x0c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // ':'
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x0f,0x00,
-    0x11,0x1c,0x00,
-    0x00,0x0f,0x00,
-    0x00,0x00,0x00,
-    0x0c,0x14,0x00,
-    0x11,0x1c,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // ';'
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x11,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x11,0x00,
-    0x00,0x00,0x00,
-    0x00,0x11,0x00,
-    0x00,0x1d,0x00,
-    0x11,0x19,0x00,
-    0x0f,0x0f,0x00,
-    0x00,0x00,0x00,
-
-    // '<'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x11,0x17,0x00,
-    0x00,0x00,0x11,0x1c,0x19,0x0f,0x00,
-    0x0c,0x1b,0x19,0x0c,0x00,0x00,0x00,
-    0x0c,0x1c,0x19,0x0c,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x1c,0x1b,0x11,0x00,
-    0x00,0x00,0x00,0x00,0x11,0x17,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '='
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x0c,0x17,0x17,0x17,0x17,0x17,0x00,
-    0x00,0x11,0x11,0x11,0x11,0x11,0x00,
-    0x00,0x11,0x11,0x11,0x11,0x11,0x00,
-    0x0c,0x17,0x17,0x17,0x17,0x17,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '>'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x19,0x0c,0x00,0x00,0x00,0x00,
-    0x00,0x14,0x1c,0x19,0x0c,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x1c,0x19,0x00,
-    0x00,0x00,0x00,0x11,0x1c,0x19,0x00,
-    0x00,0x14,0x1d,0x19,0x0c,0x00,0x00,
-    0x00,0x19,0x0c,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '?'
-    0x00,0x13,0x17,0x13,0x00,0x00,
-    0x13,0x17,0x17,0x1b,0x19,0x00,
-    0x00,0x00,0x00,0x00,0x1d,0x00,
-    0x00,0x00,0x00,0x16,0x1b,0x00,
-    0x00,0x00,0x14,0x1d,0x00,0x00,
-    0x00,0x0c,0x1d,0x00,0x00,0x00,
-    0x00,0x0c,0x14,0x00,0x00,0x00,
-    0x00,0x00,0x0f,0x00,0x00,0x00,
-    0x00,0x11,0x1c,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '@'
-    0x00,0x00,0x00,0x11,0x17,0x1c,0x1c,0x17,0x13,0x00,0x00,0x00,
-    0x00,0x00,0x1c,0x19,0x11,0x0c,0x0c,0x11,0x18,0x1d,0x00,0x00,
-    0x00,0x19,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x19,0x00,
-    0x00,0x1d,0x00,0x00,0x1c,0x1d,0x1c,0x1f,0x11,0x00,0x1f,0x00,
-    0x11,0x19,0x00,0x13,0x19,0x00,0x00,0x1c,0x11,0x00,0x1c,0x0f,
-    0x16,0x17,0x00,0x17,0x17,0x00,0x00,0x1c,0x11,0x00,0x1c,0x11,
-    0x14,0x17,0x00,0x17,0x17,0x00,0x00,0x1c,0x11,0x00,0x1c,0x11,
-    0x11,0x1b,0x00,0x14,0x19,0x00,0x00,0x1c,0x11,0x00,0x1f,0x00,
-    0x00,0x1f,0x00,0x00,0x1d,0x1c,0x1d,0x19,0x1d,0x1d,0x18,0x00,
-    0x00,0x18,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x18,0x1d,0x17,0x14,0x16,0x14,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x0c,0x13,0x17,0x17,0x11,0x00,0x00,0x00,0x00,
-
-    // 'A'
-    0x00,0x00,0x0c,0x11,0x0f,0x00,0x00,
-    0x00,0x00,0x19,0x19,0x1d,0x00,0x00,
-    0x00,0x00,0x1f,0x00,0x1d,0x00,0x00,
-    0x00,0x0f,0x1b,0x00,0x18,0x14,0x00,
-    0x00,0x17,0x16,0x00,0x13,0x19,0x00,
-    0x00,0x1c,0x0c,0x00,0x00,0x1d,0x00,
-    0x00,0x1f,0x1c,0x1c,0x1c,0x1f,0x0f,
-    0x13,0x19,0x00,0x00,0x00,0x16,0x16,
-    0x18,0x14,0x00,0x00,0x00,0x0f,0x1b,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'B'
-    0x00,0x11,0x11,0x11,0x11,0x00,0x00,0x00,
-    0x00,0x1f,0x17,0x17,0x18,0x1d,0x0c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x17,0x17,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x18,0x16,0x00,
-    0x00,0x1f,0x1c,0x1c,0x1c,0x1d,0x00,0x00,
-    0x00,0x1f,0x11,0x11,0x11,0x1b,0x17,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x11,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x16,0x1b,0x00,
-    0x00,0x1f,0x1c,0x1c,0x1d,0x1c,0x0f,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'C'
-    0x00,0x00,0x0f,0x17,0x16,0x11,0x00,
-    0x00,0x18,0x1c,0x17,0x17,0x18,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x0f,0x00,0x00,0x00,0x00,
-    0x00,0x14,0x1d,0x1c,0x1c,0x1d,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'D'
-    0x00,0x11,0x11,0x11,0x11,0x00,0x00,0x00,
-    0x00,0x1f,0x17,0x17,0x18,0x1d,0x0f,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x13,0x1b,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x1f,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x1f,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x1f,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x1d,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x19,0x18,0x00,
-    0x00,0x1f,0x1c,0x1c,0x1d,0x19,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'E'
-    0x00,0x11,0x11,0x11,0x11,0x11,0x00,
-    0x00,0x1f,0x17,0x17,0x17,0x17,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x1c,0x1c,0x1c,0x0f,0x00,
-    0x00,0x1f,0x11,0x11,0x11,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x1c,0x1c,0x1c,0x1c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'F'
-    0x00,0x11,0x11,0x11,0x11,0x11,0x00,
-    0x00,0x1f,0x17,0x17,0x17,0x17,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x11,0x11,0x11,0x00,0x00,
-    0x00,0x1f,0x17,0x17,0x17,0x0c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'G'
-    0x00,0x00,0x0f,0x16,0x17,0x11,0x0c,0x00,
-    0x00,0x17,0x1d,0x17,0x17,0x17,0x13,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x0f,0x11,0x0c,0x00,
-    0x11,0x1c,0x00,0x00,0x14,0x19,0x17,0x00,
-    0x0f,0x1c,0x00,0x00,0x00,0x11,0x17,0x00,
-    0x00,0x1d,0x0f,0x00,0x00,0x11,0x17,0x00,
-    0x00,0x0f,0x1d,0x1c,0x1c,0x1d,0x16,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'H'
-    0x00,0x11,0x00,0x00,0x00,0x00,0x0f,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x1c,0x00,
-    0x00,0x1f,0x17,0x17,0x17,0x17,0x1d,0x00,
-    0x00,0x1f,0x11,0x11,0x11,0x11,0x1d,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x1c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'I'
-    0x00,0x11,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x1f,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // 'J'
-    0x00,0x0c,0x0c,0x00,
-    0x00,0x17,0x17,0x00,
-    0x00,0x17,0x17,0x00,
-    0x00,0x17,0x17,0x00,
-    0x00,0x17,0x17,0x00,
-    0x00,0x17,0x17,0x00,
-    0x00,0x17,0x17,0x00,
-    0x00,0x17,0x17,0x00,
-    0x00,0x18,0x17,0x00,
-    0x18,0x1b,0x0c,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // 'K'
-    0x00,0x11,0x00,0x00,0x00,0x0f,0x0c,
-    0x00,0x1f,0x00,0x00,0x00,0x1d,0x00,
-    0x00,0x1f,0x00,0x00,0x18,0x17,0x00,
-    0x00,0x1f,0x00,0x0c,0x1d,0x00,0x00,
-    0x00,0x1f,0x17,0x1c,0x13,0x00,0x00,
-    0x00,0x1f,0x11,0x19,0x17,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x1d,0x0c,0x00,
-    0x00,0x1f,0x00,0x00,0x14,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x1c,0x14,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'L'
-    0x00,0x11,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x1c,0x1c,0x1c,0x14,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'M'
-    0x00,0x11,0x0f,0x00,0x00,0x00,0x00,0x0f,0x11,0x00,
-    0x00,0x1f,0x1d,0x00,0x00,0x00,0x00,0x1d,0x1f,0x00,
-    0x00,0x1f,0x19,0x13,0x00,0x00,0x0f,0x1b,0x1c,0x00,
-    0x00,0x1f,0x13,0x19,0x00,0x00,0x18,0x14,0x1c,0x00,
-    0x00,0x1f,0x00,0x1d,0x00,0x00,0x1d,0x00,0x1c,0x00,
-    0x00,0x1f,0x00,0x18,0x13,0x0f,0x19,0x00,0x1c,0x00,
-    0x00,0x1f,0x00,0x0f,0x19,0x18,0x13,0x00,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x1d,0x1d,0x00,0x00,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x16,0x17,0x00,0x00,0x1c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'N'
-    0x00,0x11,0x0f,0x00,0x00,0x00,0x0f,0x00,
-    0x00,0x1f,0x1d,0x0c,0x00,0x00,0x1c,0x00,
-    0x00,0x1f,0x14,0x17,0x00,0x00,0x1c,0x00,
-    0x00,0x1f,0x00,0x1d,0x00,0x00,0x1c,0x00,
-    0x00,0x1f,0x00,0x18,0x14,0x00,0x1c,0x00,
-    0x00,0x1f,0x00,0x0c,0x1c,0x00,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x19,0x0f,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x11,0x19,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x1d,0x1f,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'O'
-    0x00,0x00,0x0f,0x16,0x16,0x0c,0x00,0x00,
-    0x00,0x16,0x1d,0x17,0x17,0x1d,0x14,0x00,
-    0x00,0x1d,0x00,0x00,0x00,0x0c,0x1f,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x1d,0x0f,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x1c,0x11,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x1c,0x11,
-    0x0f,0x1c,0x00,0x00,0x00,0x00,0x1d,0x0c,
-    0x00,0x1d,0x0f,0x00,0x00,0x0f,0x1d,0x00,
-    0x00,0x11,0x1d,0x1c,0x1c,0x1d,0x0f,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'P'
-    0x00,0x11,0x11,0x11,0x11,0x00,0x00,
-    0x00,0x1f,0x17,0x17,0x18,0x1d,0x0f,
-    0x00,0x1f,0x00,0x00,0x00,0x14,0x19,
-    0x00,0x1f,0x00,0x00,0x00,0x11,0x1c,
-    0x00,0x1f,0x00,0x00,0x00,0x17,0x18,
-    0x00,0x1f,0x17,0x17,0x1b,0x1d,0x0c,
-    0x00,0x1f,0x11,0x11,0x0f,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'Q'
-    0x00,0x00,0x0f,0x16,0x16,0x0c,0x00,0x00,
-    0x00,0x16,0x1d,0x17,0x17,0x1d,0x14,0x00,
-    0x00,0x1d,0x00,0x00,0x00,0x0c,0x1f,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x1d,0x0f,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x1c,0x11,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x1c,0x11,
-    0x0f,0x1c,0x00,0x00,0x00,0x00,0x1d,0x0c,
-    0x00,0x1d,0x0f,0x00,0x00,0x0f,0x1d,0x00,
-    0x00,0x11,0x1d,0x1c,0x1c,0x1f,0x0f,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x1c,0x14,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x0c,0x17,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'R'
-    0x00,0x11,0x11,0x11,0x11,0x00,0x00,0x00,
-    0x00,0x1f,0x17,0x17,0x18,0x1d,0x11,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x13,0x1b,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x11,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x19,0x17,0x00,
-    0x00,0x1f,0x1c,0x1c,0x1f,0x18,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x14,0x19,0x00,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x1d,0x0c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x16,0x19,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'S'
-    0x00,0x00,0x14,0x17,0x14,0x0f,0x00,
-    0x0c,0x1d,0x17,0x17,0x17,0x14,0x00,
-    0x16,0x18,0x00,0x00,0x00,0x00,0x00,
-    0x13,0x1b,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x18,0x1f,0x1b,0x14,0x00,0x00,
-    0x00,0x00,0x00,0x11,0x1b,0x1b,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x1f,0x00,
-    0x00,0x00,0x00,0x00,0x0f,0x1d,0x00,
-    0x11,0x1c,0x1c,0x1c,0x1d,0x0f,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'T'
-    0x0f,0x11,0x11,0x11,0x11,0x11,0x00,
-    0x14,0x17,0x19,0x1d,0x17,0x17,0x0c,
-    0x00,0x00,0x11,0x1c,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x1c,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x1c,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x1c,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x1c,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x1c,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x1c,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'U'
-    0x00,0x11,0x00,0x00,0x00,0x00,0x0f,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x11,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x11,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x11,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x11,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x11,0x1c,0x00,
-    0x00,0x1f,0x00,0x00,0x00,0x11,0x1c,0x00,
-    0x00,0x1f,0x0f,0x00,0x00,0x16,0x19,0x00,
-    0x00,0x14,0x1d,0x1c,0x1c,0x1d,0x0c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'V'
-    0x0f,0x00,0x00,0x00,0x00,0x00,0x0f,
-    0x17,0x16,0x00,0x00,0x00,0x16,0x17,
-    0x11,0x1b,0x00,0x00,0x00,0x1c,0x11,
-    0x00,0x1f,0x00,0x00,0x00,0x1f,0x00,
-    0x00,0x1c,0x0f,0x00,0x11,0x1b,0x00,
-    0x00,0x16,0x17,0x00,0x17,0x16,0x00,
-    0x00,0x0f,0x1c,0x00,0x1c,0x0f,0x00,
-    0x00,0x00,0x1f,0x00,0x1f,0x00,0x00,
-    0x00,0x00,0x1b,0x1d,0x1b,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'W'
-    0x0f,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0f,0x00,
-    0x17,0x17,0x00,0x00,0x14,0x1f,0x00,0x00,0x00,0x1d,0x0c,
-    0x11,0x1b,0x00,0x00,0x19,0x1c,0x11,0x00,0x00,0x1d,0x00,
-    0x00,0x1d,0x00,0x00,0x1d,0x13,0x17,0x00,0x11,0x1b,0x00,
-    0x00,0x1d,0x00,0x00,0x1c,0x0c,0x1b,0x00,0x16,0x17,0x00,
-    0x00,0x1b,0x11,0x13,0x17,0x00,0x1d,0x00,0x18,0x11,0x00,
-    0x00,0x17,0x16,0x17,0x13,0x00,0x1b,0x0f,0x1c,0x00,0x00,
-    0x00,0x11,0x19,0x1c,0x00,0x00,0x16,0x14,0x1d,0x00,0x00,
-    0x00,0x00,0x1f,0x1d,0x00,0x00,0x11,0x1d,0x1b,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'X'
-    0x0f,0x00,0x00,0x00,0x00,0x0c,0x0c,
-    0x11,0x1c,0x00,0x00,0x00,0x1d,0x00,
-    0x00,0x1b,0x13,0x00,0x18,0x14,0x00,
-    0x00,0x0c,0x1d,0x11,0x1c,0x00,0x00,
-    0x00,0x00,0x17,0x1f,0x0f,0x00,0x00,
-    0x00,0x00,0x18,0x1d,0x11,0x00,0x00,
-    0x00,0x0f,0x1c,0x0c,0x1d,0x00,0x00,
-    0x00,0x1d,0x0f,0x00,0x17,0x17,0x00,
-    0x16,0x17,0x00,0x00,0x00,0x1d,0x0f,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'Y'
-    0x11,0x00,0x00,0x00,0x00,0x0f,0x00,
-    0x16,0x19,0x00,0x00,0x0c,0x1d,0x00,
-    0x00,0x1d,0x0c,0x00,0x19,0x14,0x00,
-    0x00,0x14,0x19,0x11,0x1d,0x00,0x00,
-    0x00,0x00,0x1c,0x1d,0x11,0x00,0x00,
-    0x00,0x00,0x13,0x1d,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x1c,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x1c,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x1c,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'Z'
-    0x0c,0x11,0x11,0x11,0x11,0x11,0x00,
-    0x11,0x17,0x17,0x17,0x19,0x1f,0x00,
-    0x00,0x00,0x00,0x00,0x1b,0x16,0x00,
-    0x00,0x00,0x00,0x14,0x1b,0x00,0x00,
-    0x00,0x00,0x0c,0x1d,0x00,0x00,0x00,
-    0x00,0x00,0x1c,0x13,0x00,0x00,0x00,
-    0x00,0x17,0x18,0x00,0x00,0x00,0x00,
-    0x0f,0x1d,0x00,0x00,0x00,0x00,0x00,
-    0x17,0x1d,0x1c,0x1c,0x1c,0x1c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '['
-    0x00,0x1f,0x1c,0x14,
-    0x00,0x1c,0x00,0x00,
-    0x00,0x1c,0x00,0x00,
-    0x00,0x1c,0x00,0x00,
-    0x00,0x1c,0x00,0x00,
-    0x00,0x1c,0x00,0x00,
-    0x00,0x1c,0x00,0x00,
-    0x00,0x1c,0x00,0x00,
-    0x00,0x1c,0x00,0x00,
-    0x00,0x1d,0x11,0x0c,
-    0x00,0x17,0x17,0x11,
-    0x00,0x00,0x00,0x00,
-
-    // '\'
-    0x0f,0x0c,0x00,0x00,0x00,
-    0x14,0x19,0x00,0x00,0x00,
-    0x00,0x1d,0x00,0x00,0x00,
-    0x00,0x17,0x17,0x00,0x00,
-    0x00,0x00,0x1d,0x00,0x00,
-    0x00,0x00,0x19,0x14,0x00,
-    0x00,0x00,0x0c,0x1d,0x00,
-    0x00,0x00,0x00,0x1b,0x11,
-    0x00,0x00,0x00,0x11,0x1b,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // ']'
-    0x14,0x1c,0x1f,0x00,
-    0x00,0x00,0x1f,0x00,
-    0x00,0x00,0x1f,0x00,
-    0x00,0x00,0x1f,0x00,
-    0x00,0x00,0x1f,0x00,
-    0x00,0x00,0x1f,0x00,
-    0x00,0x00,0x1f,0x00,
-    0x00,0x00,0x1f,0x00,
-    0x00,0x00,0x1f,0x00,
-    0x0c,0x11,0x1f,0x00,
-    0x11,0x17,0x17,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // '^'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x11,0x1f,0x00,0x00,0x00,
-    0x00,0x00,0x1d,0x17,0x17,0x00,0x00,
-    0x00,0x14,0x17,0x00,0x1d,0x0c,0x00,
-    0x00,0x1d,0x00,0x00,0x13,0x19,0x00,
-    0x00,0x0f,0x00,0x00,0x00,0x11,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '_'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1c,0x1f,0x1f,0x1f,0x1f,0x11,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '`'
-    0x1b,0x14,0x00,
-    0x0c,0x16,0x19,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // 'a'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x0c,0x1c,0x1c,0x1d,0x1b,0x00,
-    0x00,0x00,0x00,0x00,0x1d,0x00,
-    0x00,0x13,0x17,0x18,0x1f,0x00,
-    0x14,0x1b,0x11,0x00,0x1c,0x00,
-    0x17,0x17,0x00,0x00,0x1c,0x00,
-    0x0f,0x1d,0x1c,0x1c,0x1d,0x18,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'b'
-    0x0c,0x14,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1f,0x1c,0x1c,0x1d,0x0f,0x00,
-    0x11,0x1c,0x00,0x00,0x14,0x18,0x00,
-    0x11,0x1c,0x00,0x00,0x11,0x1c,0x00,
-    0x11,0x1c,0x00,0x00,0x11,0x1c,0x00,
-    0x11,0x1c,0x00,0x00,0x17,0x17,0x00,
-    0x11,0x1f,0x1c,0x1c,0x1d,0x0c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'c'
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x19,0x1d,0x1c,0x18,
-    0x11,0x1c,0x00,0x00,0x00,
-    0x14,0x17,0x00,0x00,0x00,
-    0x14,0x17,0x00,0x00,0x00,
-    0x11,0x1d,0x00,0x00,0x00,
-    0x00,0x1b,0x1d,0x1c,0x18,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,
-
-    // 'd'
-    0x00,0x00,0x00,0x00,0x11,0x11,0x00,
-    0x00,0x00,0x00,0x00,0x17,0x17,0x00,
-    0x00,0x00,0x00,0x00,0x17,0x17,0x00,
-    0x00,0x19,0x1d,0x1c,0x1d,0x17,0x00,
-    0x0f,0x1d,0x00,0x00,0x17,0x17,0x00,
-    0x14,0x17,0x00,0x00,0x17,0x17,0x00,
-    0x17,0x17,0x00,0x00,0x17,0x17,0x00,
-    0x11,0x1c,0x00,0x00,0x17,0x17,0x00,
-    0x00,0x1c,0x1d,0x1c,0x1d,0x17,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'e'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x18,0x1d,0x1c,0x1c,0x00,
-    0x0f,0x1c,0x00,0x00,0x18,0x14,
-    0x16,0x19,0x11,0x11,0x19,0x17,
-    0x16,0x1c,0x17,0x17,0x17,0x11,
-    0x11,0x1c,0x00,0x00,0x00,0x00,
-    0x00,0x1b,0x1d,0x1c,0x1c,0x0f,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'f'
-    0x00,0x11,0x1c,0x1c,
-    0x00,0x1c,0x0f,0x00,
-    0x00,0x1f,0x00,0x00,
-    0x18,0x1f,0x1c,0x18,
-    0x00,0x1f,0x00,0x00,
-    0x00,0x1f,0x00,0x00,
-    0x00,0x1f,0x00,0x00,
-    0x00,0x1f,0x00,0x00,
-    0x00,0x1f,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // 'g'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1c,0x1b,0x1b,0x1f,0x1c,
-    0x11,0x19,0x00,0x00,0x1c,0x0f,
-    0x11,0x19,0x00,0x00,0x1d,0x0f,
-    0x00,0x1c,0x1d,0x1c,0x18,0x00,
-    0x00,0x1b,0x00,0x00,0x00,0x00,
-    0x00,0x1b,0x1f,0x1c,0x1c,0x13,
-    0x11,0x19,0x00,0x00,0x0c,0x1c,
-    0x14,0x1b,0x00,0x00,0x11,0x1b,
-    0x00,0x19,0x1c,0x1c,0x19,0x0c,
-
-    // 'h'
-    0x0c,0x14,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1f,0x1c,0x1c,0x1d,0x0f,0x00,
-    0x11,0x1c,0x00,0x00,0x14,0x17,0x00,
-    0x11,0x1c,0x00,0x00,0x11,0x1b,0x00,
-    0x11,0x1c,0x00,0x00,0x11,0x1c,0x00,
-    0x11,0x1c,0x00,0x00,0x11,0x1c,0x00,
-    0x11,0x1c,0x00,0x00,0x11,0x1c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'i'
-    0x0c,0x14,0x00,
-    0x0f,0x18,0x00,
-    0x00,0x00,0x00,
-    0x11,0x1c,0x00,
-    0x11,0x1c,0x00,
-    0x11,0x1c,0x00,
-    0x11,0x1c,0x00,
-    0x11,0x1c,0x00,
-    0x11,0x1c,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // 'j'
-    0x0c,0x14,0x00,
-    0x0f,0x18,0x00,
-    0x00,0x00,0x00,
-    0x11,0x1c,0x00,
-    0x11,0x1c,0x00,
-    0x11,0x1c,0x00,
-    0x11,0x1c,0x00,
-    0x11,0x1c,0x00,
-    0x11,0x1c,0x00,
-    0x11,0x1c,0x00,
-    0x1d,0x13,0x00,
-    0x11,0x00,0x00,
-
-    // 'k'
-    0x0c,0x14,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x1d,0x0f,
-    0x11,0x1c,0x00,0x1b,0x14,0x00,
-    0x11,0x1d,0x18,0x1b,0x00,0x00,
-    0x11,0x1d,0x13,0x1d,0x00,0x00,
-    0x11,0x1c,0x00,0x17,0x18,0x00,
-    0x11,0x1c,0x00,0x00,0x1d,0x0f,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'l'
-    0x00,0x14,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-    0x00,0x00,0x00,
-
-    // 'm'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1f,0x1c,0x1c,0x1d,0x1b,0x1c,0x1d,0x1d,0x00,
-    0x11,0x1c,0x00,0x00,0x17,0x17,0x00,0x00,0x1d,0x0c,
-    0x11,0x1c,0x00,0x00,0x17,0x17,0x00,0x00,0x1c,0x11,
-    0x11,0x1c,0x00,0x00,0x17,0x17,0x00,0x00,0x1c,0x11,
-    0x11,0x1c,0x00,0x00,0x17,0x17,0x00,0x00,0x1c,0x11,
-    0x11,0x1c,0x00,0x00,0x17,0x17,0x00,0x00,0x1c,0x11,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'n'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1f,0x1c,0x1c,0x1d,0x0f,0x00,
-    0x11,0x1c,0x00,0x00,0x14,0x17,0x00,
-    0x11,0x1c,0x00,0x00,0x11,0x1b,0x00,
-    0x11,0x1c,0x00,0x00,0x11,0x1c,0x00,
-    0x11,0x1c,0x00,0x00,0x11,0x1c,0x00,
-    0x11,0x1c,0x00,0x00,0x11,0x1c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'o'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x19,0x1d,0x1c,0x1d,0x0c,0x00,
-    0x0f,0x1c,0x00,0x00,0x14,0x18,0x00,
-    0x16,0x17,0x00,0x00,0x11,0x1c,0x00,
-    0x16,0x17,0x00,0x00,0x11,0x1c,0x00,
-    0x0f,0x1c,0x00,0x00,0x14,0x18,0x00,
-    0x00,0x19,0x1d,0x1c,0x1d,0x0c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'p'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1f,0x1d,0x1c,0x1f,0x0c,0x00,
-    0x11,0x1c,0x00,0x00,0x14,0x18,0x00,
-    0x11,0x1c,0x00,0x00,0x11,0x1c,0x00,
-    0x11,0x1c,0x00,0x00,0x11,0x1c,0x00,
-    0x11,0x1c,0x00,0x00,0x16,0x18,0x00,
-    0x11,0x1f,0x1c,0x1c,0x1d,0x0c,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x00,0x00,0x00,
-    0x0f,0x18,0x00,0x00,0x00,0x00,0x00,
-
-    // 'q'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x18,0x1d,0x1c,0x1d,0x17,0x00,
-    0x0f,0x1d,0x00,0x00,0x17,0x17,0x00,
-    0x16,0x17,0x00,0x00,0x17,0x17,0x00,
-    0x16,0x17,0x00,0x00,0x17,0x17,0x00,
-    0x11,0x1c,0x00,0x00,0x17,0x17,0x00,
-    0x00,0x1c,0x1d,0x1c,0x1f,0x17,0x00,
-    0x00,0x00,0x00,0x00,0x17,0x17,0x00,
-    0x00,0x00,0x00,0x00,0x17,0x17,0x00,
-    0x00,0x00,0x00,0x00,0x14,0x14,0x00,
-
-    // 'r'
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x11,0x1d,0x19,0x1d,
-    0x11,0x1d,0x11,0x00,
-    0x11,0x1c,0x00,0x00,
-    0x11,0x1c,0x00,0x00,
-    0x11,0x1c,0x00,0x00,
-    0x11,0x1c,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // 's'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x0c,0x1d,0x1c,0x1c,0x1b,0x00,
-    0x17,0x17,0x00,0x00,0x00,0x00,
-    0x11,0x1f,0x18,0x14,0x00,0x00,
-    0x00,0x00,0x11,0x18,0x1d,0x00,
-    0x00,0x00,0x00,0x00,0x1d,0x00,
-    0x13,0x1c,0x1c,0x1d,0x19,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 't'
-    0x00,0x00,0x00,0x00,
-    0x00,0x18,0x00,0x00,
-    0x00,0x1c,0x00,0x00,
-    0x18,0x1f,0x1c,0x1c,
-    0x00,0x1c,0x00,0x00,
-    0x00,0x1c,0x00,0x00,
-    0x00,0x1c,0x00,0x00,
-    0x00,0x1c,0x00,0x00,
-    0x00,0x18,0x1d,0x1c,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // 'u'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x11,0x1c,0x00,0x00,0x17,0x17,0x00,
-    0x11,0x1c,0x00,0x00,0x17,0x17,0x00,
-    0x11,0x1c,0x00,0x00,0x17,0x17,0x00,
-    0x11,0x1c,0x00,0x00,0x17,0x17,0x00,
-    0x0c,0x1d,0x00,0x00,0x17,0x17,0x00,
-    0x00,0x1c,0x1d,0x1c,0x1d,0x17,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'v'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x18,0x14,0x00,0x00,0x18,0x14,
-    0x13,0x1b,0x00,0x00,0x1d,0x00,
-    0x00,0x1f,0x00,0x0c,0x1d,0x00,
-    0x00,0x1b,0x0f,0x16,0x17,0x00,
-    0x00,0x16,0x16,0x1b,0x0f,0x00,
-    0x00,0x0c,0x1f,0x1d,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'w'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x18,0x14,0x00,0x00,0x1f,0x0c,0x00,0x11,0x19,0x00,
-    0x11,0x19,0x00,0x13,0x1d,0x16,0x00,0x17,0x16,0x00,
-    0x00,0x1d,0x00,0x18,0x14,0x1b,0x00,0x1b,0x0f,0x00,
-    0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x00,
-    0x00,0x18,0x16,0x1b,0x00,0x18,0x16,0x1b,0x00,0x00,
-    0x00,0x13,0x1f,0x16,0x00,0x13,0x1f,0x16,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'x'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x16,0x18,0x00,0x0c,0x1d,0x00,
-    0x00,0x1d,0x0f,0x1c,0x0f,0x00,
-    0x00,0x0f,0x1f,0x18,0x00,0x00,
-    0x00,0x0f,0x1f,0x18,0x00,0x00,
-    0x00,0x1d,0x0f,0x1c,0x11,0x00,
-    0x16,0x18,0x00,0x0f,0x1d,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // 'y'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x18,0x14,0x00,0x00,0x18,0x14,
-    0x13,0x19,0x00,0x00,0x1d,0x00,
-    0x00,0x1f,0x00,0x0c,0x1d,0x00,
-    0x00,0x1b,0x0f,0x14,0x17,0x00,
-    0x00,0x16,0x17,0x1b,0x0f,0x00,
-    0x00,0x0c,0x1f,0x1f,0x00,0x00,
-    0x00,0x00,0x11,0x19,0x00,0x00,
-    0x00,0x00,0x18,0x14,0x00,0x00,
-    0x00,0x00,0x19,0x00,0x00,0x00,
-
-    // 'z'
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x14,0x1c,0x1c,0x1d,0x1f,0x00,
-    0x00,0x00,0x00,0x1b,0x16,0x00,
-    0x00,0x00,0x16,0x19,0x00,0x00,
-    0x00,0x0f,0x1d,0x00,0x00,0x00,
-    0x00,0x1d,0x0f,0x00,0x00,0x00,
-    0x17,0x1f,0x1c,0x1c,0x1c,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-
-    // '{'
-    0x00,0x0c,0x1d,0x18,
-    0x00,0x17,0x17,0x00,
-    0x00,0x17,0x16,0x00,
-    0x00,0x17,0x17,0x00,
-    0x0f,0x1d,0x11,0x00,
-    0x18,0x1c,0x00,0x00,
-    0x00,0x18,0x16,0x00,
-    0x00,0x17,0x17,0x00,
-    0x00,0x17,0x14,0x00,
-    0x00,0x13,0x1d,0x0f,
-    0x00,0x00,0x11,0x14,
-    0x00,0x00,0x00,0x00,
-
-    // '|'
-    0x00,0x14,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x1c,0x00,
-    0x00,0x18,0x00,
-
-    // '}'
-    0x14,0x1d,0x0f,0x00,
-    0x00,0x13,0x1b,0x00,
-    0x00,0x11,0x1c,0x00,
-    0x00,0x11,0x1c,0x00,
-    0x00,0x00,0x1d,0x11,
-    0x00,0x00,0x18,0x1d,
-    0x00,0x0f,0x1d,0x00,
-    0x00,0x11,0x1c,0x00,
-    0x00,0x11,0x1c,0x00,
-    0x0c,0x19,0x17,0x00,
-    0x11,0x14,0x00,0x00,
-    0x00,0x00,0x00,0x00,
-
-    // '~'
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1b,0x1d,0x17,0x11,0x16,0x00,
-    0x00,0x0f,0x00,0x14,0x19,0x13,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
-};
-
-const uint16 titillium_web_offsets[] = {
-    0, 36, 72, 132, 216, 300, 384, 492, 528, 564, 600, 660, 744, 780, 840, 876, 936, 1020, 1104, 1188, 1272, 1356, 1440, 1524, 1608, 1692, 1776, 1812, 1848, 1932, 2016, 2100, 2172, 2316, 2400, 2496, 2580, 2676, 2760, 2844, 2940, 3036, 3072, 3120, 3204, 3276, 3396, 3492, 3588, 3672, 3768, 3864, 3948, 4032, 4128, 4212, 4344, 4428, 4512, 4596, 4644, 4704, 4752, 4836, 4932, 4968, 5040, 5124, 5184, 5268, 5340, 5388, 5460, 5544, 5580, 5616, 5688, 5724, 5844, 5928, 6012, 6096, 6180, 6228, 6300, 6348, 6432, 6504, 6624, 6696, 6768, 6840, 6888, 6924, 6972
+    // ' ' 0x0 at 0,0
+    // '!' 1x9 at 1,0
+    0x8f,0xff,0xff,0x88,0xf0,
+    // '"' 4x4 at 0,0
+    0x07,0x07,0x8e,0x8e,0x8e,0x8e,0x07,0x07,
+    // '#' 7x8 at 0,1
+    0x0b,0xb0,0xe0,0x00,0xbb,0x0e,0x00,0xce,0xee,0xfe,0xa0,0xbb,0x0e,0x00,0x0b,0xb0,0xe0,0x0c,0xee,0xef,0xea,0x0b,0xb0,0xe0,0x00,0xbb,0x0e,0x00,
+    // '$' 6x11 at 0,0
+    0x00,0x08,0x90,0x0c,0xee,0xec,0x6e,0x0b,0x00,0x7e,0x0e,0x00,0x0c,0xee,0x70,0x00,0x6e,0xec,0x00,0x0b,0x0f,0x00,0x8b,0x6e,0x0e,0xee,0xe9,0x00,0xb7,0x00,0x00,0x80,0x00,
+    // '%' 7x9 at 0,1
+    0x9d,0xc0,0xd0,0x0d,0x0e,0x7b,0x00,0xbb,0xeb,0x60,0x00,0x80,0xd0,0x00,0x00,0x0c,0x67,0x00,0x0a,0xad,0xe7,0x00,0xc8,0xb8,0xb0,0x0c,0x0e,0xd6,0x00,0x60,0x00,0x00,
+    // '&' 8x9 at 0,0
+    0x00,0x6b,0x90,0x00,0x06,0xeb,0xdc,0x00,0x08,0xb0,0x0e,0x00,0x06,0xe0,0xbc,0x00,0x0b,0xef,0xb0,0xa0,0x9d,0x0a,0xe0,0xf0,0xbb,0x00,0xae,0xd0,0xad,0x00,0x0e,0xe0,0x0e,0xee,0xea,0x7e,
+    // ''' 2x4 at 0,0
+    0x07,0x8e,0x8e,0x07,
+    // '(' 3x11 at 0,0
+    0x0a,0xc0,0xd8,0x0f,0x08,0xe0,0x9c,0x0b,0xb0,0x8d,0x06,0xe0,0x0e,0x00,0xca,0x06,0x90,
+    // ')' 3x11 at 0,0
+    0xab,0x00,0xe0,0x0e,0x60,0xca,0x0b,0xb0,0xbb,0x0b,0xb0,0xd9,0x0f,0x07,0xe0,0x87,0x00,
+    // '*' 5x5 at 0,0
+    0x00,0x66,0x06,0xcc,0x60,0x0b,0xfe,0xa6,0xcc,0x60,0x00,0x67,0x00,
+    // '+' 6x6 at 0,3
+    0x00,0x0c,0x00,0x00,0x0e,0x00,0x6b,0xbe,0xbb,0x6b,0xbe,0xbb,0x00,0x0e,0x00,0x00,0x0c,0x00,
+    // ',' 2x4 at 0,7
+    0x08,0x8d,0xbb,0x86,
+    // '-' 5x2 at 0,5
+    0x7e,0xee,0xa0,0x88,0x86,
+    // '.' 2x2 at 0,7
+    0x6a,0x8e,
+    // '/' 5x9 at 0,0
+    0x00,0x07,0x60,0x00,0xc9,0x00,0x0e,0x00,0x0b,0xb0,0x00,0xe6,0x00,0x8c,0x00,0x0c,0x80,0x00,0xe0,0x00,0xbb,0x00,0x00,
+    // '0' 7x8 at 0,1
+    0x0a,0xee,0xe7,0x06,0xe0,0x07,0xe0,0xbc,0x00,0x0e,0x6b,0xb0,0x00,0xe8,0xbb,0x00,0x0e,0x8b,0xb0,0x00,0xe7,0x7e,0x00,0x7e,0x00,0xce,0xee,0x80,
+    // '1' 4x8 at 1,1
+    0x06,0xee,0xae,0xbe,0x70,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,
+    // '2' 6x8 at 0,1
+    0x0e,0xee,0xe7,0x00,0x00,0xbc,0x00,0x00,0x9d,0x00,0x00,0xe9,0x00,0x0c,0xc0,0x00,0xcc,0x00,0x0b,0xc0,0x00,0x7f,0xee,0xee,
+    // '3' 6x8 at 0,1
+    0x0e,0xee,0xe7,0x00,0x00,0x9d,0x00,0x00,0x9d,0x06,0xbc,0xe7,0x00,0x88,0xdc,0x00,0x00,0x0f,0x00,0x00,0x7e,0x7e,0xee,0xe9,
+    // '4' 7x8 at 0,1
+    0x00,0xbc,0x00,0x00,0x0e,0x60,0x00,0x08,0xe0,0x00,0x00,0xca,0x0c,0x70,0x0e,0x00,0xe8,0x0a,0xd8,0x8e,0xb0,0x8b,0xbb,0xec,0x60,0x00,0x0e,0x80,
+    // '5' 6x8 at 0,1
+    0x0f,0xff,0xfe,0x0e,0x00,0x00,0x0e,0x00,0x00,0x0e,0xee,0xe9,0x08,0x00,0x7f,0x00,0x00,0x0f,0x00,0x00,0x7e,0x7e,0xee,0xe7,
+    // '6' 7x8 at 0,1
+    0x07,0xee,0xed,0x00,0xe7,0x00,0x00,0x8d,0x00,0x00,0x0b,0xee,0xfe,0xa0,0xbc,0x00,0x6f,0x08,0xd0,0x00,0xe8,0x0e,0x00,0x0f,0x00,0xae,0xee,0xa0,
+    // '7' 5x8 at 1,1
+    0xff,0xff,0xe0,0x00,0x8d,0x00,0x0c,0x90,0x06,0xe0,0x00,0xca,0x00,0x0e,0x00,0x0b,0xb0,0x00,0xe6,0x00,
+    // '8' 7x8 at 0,1
+    0x0c,0xee,0xeb,0x0b,0xd0,0x00,0xe6,0xbc,0x00,0x0e,0x70,0xec,0xbe,0xb0,0x7e,0xa8,0xbe,0x0b,0xb0,0x00,0xe8,0xbc,0x00,0x0e,0x80,0xee,0xee,0xc0,
+    // '9' 6x8 at 0,1
+    0x0c,0xee,0xe0,0x9e,0x00,0xbc,0xbb,0x00,0x0f,0xad,0x00,0x0e,0x0c,0xee,0xee,0x00,0x00,0x0f,0x00,0x00,0xad,0x7e,0xee,0xe6,
+    // ':' 2x6 at 0,3
+    0x07,0x8e,0x07,0x00,0x6a,0x8e,
+    // ';' 2x8 at 0,3
+    0x08,0x0f,0x08,0x00,0x08,0x0e,0x8c,0x77,
+    // '<' 6x6 at 0,3
+    0x00,0x00,0x8b,0x00,0x8e,0xc7,0x6d,0xc6,0x00,0x6e,0xc6,0x00,0x00,0x8e,0xd8,0x00,0x00,0x8b,
+    // '=' 6x4 at 0,4
+    0x6b,0xbb,0xbb,0x08,0x88,0x88,0x08,0x88,0x88,0x6b,0xbb,0xbb,
+    // '>' 5x6 at 1,3
+    0xc6,0x00,0x0a,0xec,0x60,0x00,0x8e,0xc0,0x08,0xec,0xae,0xc6,0x0c,0x60,0x00,
+    // '?' 5x9 at 0,0
+    0x09,0xb9,0x09,0xbb,0xdc,0x00,0x00,0xe0,0x00,0xbd,0x00,0xae,0x00,0x6e,0x00,0x06,0xa0,0x00,0x07,0x00,0x08,0xe0,0x00,
+    // '@' 12x12 at 0,0
+    0x00,0x08,0xbe,0xeb,0x90,0x00,0x00,0xec,0x86,0x68,0xce,0x00,0x0c,0xb0,0x00,0x00,0x0b,0xc0,0x0e,0x00,0xee,0xef,0x80,0xf0,0x8c,0x09,0xc0,0x0e,0x80,0xe7,0xbb,0x0b,0xb0,0x0e,0x80,0xe8,0xab,0x0b,0xb0,0x0e,0x80,0xe8,0x8d,0x0a,0xc0,0x0e,0x80,0xf0,0x0f,0x00,0xee,0xec,0xee,0xc0,0x0c,0xc0,0x00,0x00,0x00,0x00,0x00,0xce,0xba,0xba,0x00,0x00,0x00,0x06,0x9b,0xb8,0x00,0x00,
+    // 'A' 7x9 at 0,0
+    0x00,0x68,0x70,0x00,0x0c,0xce,0x00,0x00,0xf0,0xe0,0x00,0x7d,0x0c,0xa0,0x0b,0xb0,0x9c,0x00,0xe6,0x00,0xe0,0x0f,0xee,0xef,0x79,0xc0,0x00,0xbb,0xca,0x00,0x07,0xd0,
+    // 'B' 6x9 at 1,0
+    0x88,0x88,0x00,0xfb,0xbc,0xe6,0xf0,0x00,0xbb,0xf0,0x00,0xcb,0xfe,0xee,0xe0,0xf8,0x88,0xdb,0xf0,0x00,0x8e,0xf0,0x00,0xbd,0xfe,0xee,0xe7,
+    // 'C' 6x9 at 0,0
+    0x00,0x7b,0xb8,0x0c,0xeb,0xbc,0x0f,0x00,0x00,0x8e,0x00,0x00,0x8e,0x00,0x00,0x8e,0x00,0x00,0x8e,0x00,0x00,0x0f,0x70,0x00,0x0a,0xee,0xee,
+    // 'D' 6x9 at 1,0
+    0x88,0x88,0x00,0xfb,0xbc,0xe7,0xf0,0x00,0x9d,0xf0,0x00,0x0f,0xf0,0x00,0x0f,0xf0,0x00,0x0f,0xf0,0x00,0x0e,0xf0,0x00,0xcc,0xfe,0xee,0xc0,
+    // 'E' 5x9 at 1,0
+    0x88,0x88,0x8f,0xbb,0xbb,0xf0,0x00,0x0f,0x00,0x00,0xfe,0xee,0x7f,0x88,0x80,0xf0,0x00,0x0f,0x00,0x00,0xfe,0xee,0xe0,
+    // 'F' 5x9 at 1,0
+    0x88,0x88,0x8f,0xbb,0xbb,0xf0,0x00,0x0f,0x00,0x00,0xf8,0x88,0x0f,0xbb,0xb6,0xf0,0x00,0x0f,0x00,0x00,0xf0,0x00,0x00,
+    // 'G' 7x9 at 0,0
+    0x00,0x7b,0xb8,0x60,0xbe,0xbb,0xb9,0x0f,0x00,0x00,0x08,0xe0,0x00,0x00,0x8e,0x00,0x78,0x68,0xe0,0x0a,0xcb,0x7e,0x00,0x08,0xb0,0xe7,0x00,0x8b,0x07,0xee,0xee,0xb0,
+    // 'H' 6x9 at 1,0
+    0x80,0x00,0x07,0xf0,0x00,0x0e,0xf0,0x00,0x0e,0xf0,0x00,0x0e,0xfb,0xbb,0xbe,0xf8,0x88,0x8e,0xf0,0x00,0x0e,0xf0,0x00,0x0e,0xf0,0x00,0x0e,
+    // 'I' 1x9 at 1,0
+    0x8f,0xff,0xff,0xff,0xf0,
+    // 'J' 3x10 at 0,0
+    0x06,0x60,0xbb,0x0b,0xb0,0xbb,0x0b,0xb0,0xbb,0x0b,0xb0,0xbb,0x0c,0xbc,0xd6,
+    // 'K' 6x9 at 1,0
+    0x80,0x00,0x76,0xf0,0x00,0xe0,0xf0,0x0c,0xb0,0xf0,0x6e,0x00,0xfb,0xe9,0x00,0xf8,0xcb,0x00,0xf0,0x0e,0x60,0xf0,0x0a,0xe0,0xf0,0x00,0xea,
+    // 'L' 5x9 at 1,0
+    0x80,0x00,0x0f,0x00,0x00,0xf0,0x00,0x0f,0x00,0x00,0xf0,0x00,0x0f,0x00,0x00,0xf0,0x00,0x0f,0x00,0x00,0xfe,0xee,0xa0,
+    // 'M' 8x9 at 1,0
+    0x87,0x00,0x00,0x78,0xfe,0x00,0x00,0xef,0xfc,0x90,0x07,0xde,0xf9,0xc0,0x0c,0xae,0xf0,0xe0,0x0e,0x0e,0xf0,0xc9,0x7c,0x0e,0xf0,0x7c,0xc9,0x0e,0xf0,0x0e,0xe0,0x0e,0xf0,0x0b,0xb0,0x0e,
+    // 'N' 6x9 at 1,0
+    0x87,0x00,0x07,0xfe,0x60,0x0e,0xfa,0xb0,0x0e,0xf0,0xe0,0x0e,0xf0,0xca,0x0e,0xf0,0x6e,0x0e,0xf0,0x0c,0x7e,0xf0,0x08,0xce,0xf0,0x00,0xef,
+    // 'O' 8x9 at 0,0
+    0x00,0x7b,0xb6,0x00,0x0b,0xeb,0xbe,0xa0,0x0e,0x00,0x06,0xf0,0x8e,0x00,0x00,0xe7,0x8e,0x00,0x00,0xe8,0x8e,0x00,0x00,0xe8,0x7e,0x00,0x00,0xe6,0x0e,0x70,0x07,0xe0,0x08,0xee,0xee,0x70,
+    // 'P' 6x9 at 1,0
+    0x88,0x88,0x00,0xfb,0xbc,0xe7,0xf0,0x00,0xac,0xf0,0x00,0x8e,0xf0,0x00,0xbc,0xfb,0xbd,0xe6,0xf8,0x87,0x00,0xf0,0x00,0x00,0xf0,0x00,0x00,
+    // 'Q' 8x11 at 0,0
+    0x00,0x7b,0xb6,0x00,0x0b,0xeb,0xbe,0xa0,0x0e,0x00,0x06,0xf0,0x8e,0x00,0x00,0xe7,0x8e,0x00,0x00,0xe8,0x8e,0x00,0x00,0xe8,0x7e,0x00,0x00,0xe6,0x0e,0x70,0x07,0xe0,0x08,0xee,0xef,0x70,0x00,0x00,0x0e,0xa0,0x00,0x00,0x06,0xb0,
+    // 'R' 6x9 at 1,0
+    0x88,0x88,0x00,0xfb,0xbc,0xe8,0xf0,0x00,0x9d,0xf0,0x00,0x8e,0xf0,0x00,0xcb,0xfe,0xef,0xc0,0xf0,0x0a,0xc0,0xf0,0x00,0xe6,0xf0,0x00,0xbc,
+    // 'S' 6x9 at 0,0
+    0x00,0xab,0xa7,0x6e,0xbb,0xba,0xbc,0x00,0x00,0x9d,0x00,0x00,0x0c,0xfd,0xa0,0x00,0x08,0xdd,0x00,0x00,0x0f,0x00,0x00,0x7e,0x8e,0xee,0xe7,
+    // 'T' 7x9 at 0,0
+    0x78,0x88,0x88,0x0a,0xbc,0xeb,0xb6,0x00,0x8e,0x00,0x00,0x08,0xe0,0x00,0x00,0x8e,0x00,0x00,0x08,0xe0,0x00,0x00,0x8e,0x00,0x00,0x08,0xe0,0x00,0x00,0x8e,0x00,0x00,
+    // 'U' 6x9 at 1,0
+    0x80,0x00,0x07,0xf0,0x00,0x8e,0xf0,0x00,0x8e,0xf0,0x00,0x8e,0xf0,0x00,0x8e,0xf0,0x00,0x8e,0xf0,0x00,0x8e,0xf7,0x00,0xbc,0xae,0xee,0xe6,
+    // 'V' 7x9 at 0,0
+    0x70,0x00,0x00,0x7b,0xb0,0x00,0xbb,0x8d,0x00,0x0e,0x80,0xf0,0x00,0xf0,0x0e,0x70,0x8d,0x00,0xbb,0x0b,0xb0,0x07,0xe0,0xe7,0x00,0x0f,0x0f,0x00,0x00,0xde,0xd0,0x00,
+    // 'W' 11x9 at 0,0
+    0x70,0x00,0x08,0x00,0x07,0x0b,0xb0,0x0a,0xf0,0x00,0xe6,0x8d,0x00,0xce,0x80,0x0e,0x00,0xe0,0x0e,0x9b,0x08,0xd0,0x0e,0x00,0xe6,0xd0,0xbb,0x00,0xd8,0x9b,0x0e,0x0c,0x80,0x0b,0xbb,0x90,0xd7,0xe0,0x00,0x8c,0xe0,0x0b,0xae,0x00,0x00,0xfe,0x00,0x8e,0xd0,0x00,
+    // 'X' 7x9 at 0,0
+    0x70,0x00,0x06,0x68,0xe0,0x00,0xe0,0x0d,0x90,0xca,0x00,0x6e,0x8e,0x00,0x00,0xbf,0x70,0x00,0x0c,0xe8,0x00,0x07,0xe6,0xe0,0x00,0xe7,0x0b,0xb0,0xbb,0x00,0x0e,0x70,
+    // 'Y' 6x9 at 0,0
+    0x80,0x00,0x07,0xbc,0x00,0x6e,0x0e,0x60,0xca,0x0a,0xc8,0xe0,0x00,0xee,0x80,0x00,0x9e,0x00,0x00,0x8e,0x00,0x00,0x8e,0x00,0x00,0x8e,0x00,
+    // 'Z' 6x9 at 0,0
+    0x68,0x88,0x88,0x8b,0xbb,0xcf,0x00,0x00,0xdb,0x00,0x0a,0xd0,0x00,0x6e,0x00,0x00,0xe9,0x00,0x0b,0xc0,0x00,0x7e,0x00,0x00,0xbe,0xee,0xee,
+    // '[' 3x11 at 1,0
+    0xfe,0xae,0x00,0xe0,0x0e,0x00,0xe0,0x0e,0x00,0xe0,0x0e,0x00,0xe0,0x0e,0x86,0xbb,0x80,
+    // '\' 5x9 at 0,0
+    0x76,0x00,0x0a,0xc0,0x00,0x0e,0x00,0x00,0xbb,0x00,0x00,0xe0,0x00,0x0c,0xa0,0x00,0x6e,0x00,0x00,0xd8,0x00,0x08,0xd0,
+    // ']' 3x11 at 0,0
+    0xae,0xf0,0x0f,0x00,0xf0,0x0f,0x00,0xf0,0x0f,0x00,0xf0,0x0f,0x00,0xf6,0x8f,0x8b,0xb0,
+    // '^' 5x5 at 1,1
+    0x08,0xf0,0x00,0xeb,0xb0,0xab,0x0e,0x6e,0x00,0x9c,0x70,0x00,0x80,
+    // '_' 6x1 at 1,10
+    0xef,0xff,0xf8,
+    // '`' 3x2 at 0,0
+    0xda,0x06,0xbc,
+    // 'a' 6x6 at 0,3
+    0x6e,0xee,0xd0,0x00,0x00,0xe0,0x09,0xbc,0xf0,0xad,0x80,0xe0,0xbb,0x00,0xe0,0x7e,0xee,0xec,
+    // 'b' 6x9 at 0,0
+    0x6a,0x00,0x00,0x8e,0x00,0x00,0x8e,0x00,0x00,0x8f,0xee,0xe7,0x8e,0x00,0xac,0x8e,0x00,0x8e,0x8e,0x00,0x8e,0x8e,0x00,0xbb,0x8f,0xee,0xe6,
+    // 'c' 5x6 at 0,3
+    0x0c,0xee,0xc8,0xe0,0x00,0xab,0x00,0x0a,0xb0,0x00,0x8e,0x00,0x00,0xde,0xec,
+    // 'd' 6x9 at 0,0
+    0x00,0x00,0x88,0x00,0x00,0xbb,0x00,0x00,0xbb,0x0c,0xee,0xeb,0x7e,0x00,0xbb,0xab,0x00,0xbb,0xbb,0x00,0xbb,0x8e,0x00,0xbb,0x0e,0xee,0xeb,
+    // 'e' 6x6 at 0,3
+    0x0c,0xee,0xe0,0x7e,0x00,0xca,0xbc,0x88,0xcb,0xbe,0xbb,0xb8,0x8e,0x00,0x00,0x0d,0xee,0xe7,
+    // 'f' 4x9 at 0,0
+    0x08,0xee,0x0e,0x70,0x0f,0x00,0xcf,0xec,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,
+    // 'g' 6x9 at 0,3
+    0x0e,0xdd,0xfe,0x8c,0x00,0xe7,0x8c,0x00,0xe7,0x0e,0xee,0xc0,0x0d,0x00,0x00,0x0d,0xfe,0xe9,0x8c,0x00,0x6e,0xad,0x00,0x8d,0x0c,0xee,0xc6,
+    // 'h' 6x9 at 0,0
+    0x6a,0x00,0x00,0x8e,0x00,0x00,0x8e,0x00,0x00,0x8f,0xee,0xe7,0x8e,0x00,0xab,0x8e,0x00,0x8d,0x8e,0x00,0x8e,0x8e,0x00,0x8e,0x8e,0x00,0x8e,
+    // 'i' 2x9 at 0,0
+    0x6a,0x7c,0x00,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,
+    // 'j' 2x12 at 0,0
+    0x6a,0x7c,0x00,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0x8e,0xe9,0x80,
+    // 'k' 6x9 at 0,0
+    0x6a,0x00,0x00,0x8e,0x00,0x00,0x8e,0x00,0x00,0x8e,0x00,0xe7,0x8e,0x0d,0xa0,0x8e,0xcd,0x00,0x8e,0x9e,0x00,0x8e,0x0b,0xc0,0x8e,0x00,0xe7,
+    // 'l' 1x9 at 1,0
+    0xae,0xee,0xee,0xee,0xe0,
+    // 'm' 10x6 at 0,3
+    0x8f,0xee,0xed,0xee,0xe0,0x8e,0x00,0xbb,0x00,0xe6,0x8e,0x00,0xbb,0x00,0xe8,0x8e,0x00,0xbb,0x00,0xe8,0x8e,0x00,0xbb,0x00,0xe8,0x8e,0x00,0xbb,0x00,0xe8,
+    // 'n' 6x6 at 0,3
+    0x8f,0xee,0xe7,0x8e,0x00,0xab,0x8e,0x00,0x8d,0x8e,0x00,0x8e,0x8e,0x00,0x8e,0x8e,0x00,0x8e,
+    // 'o' 6x6 at 0,3
+    0x0c,0xee,0xe6,0x7e,0x00,0xac,0xbb,0x00,0x8e,0xbb,0x00,0x8e,0x7e,0x00,0xac,0x0c,0xee,0xe6,
+    // 'p' 6x9 at 0,3
+    0x8f,0xee,0xf6,0x8e,0x00,0xac,0x8e,0x00,0x8e,0x8e,0x00,0x8e,0x8e,0x00,0xbc,0x8f,0xee,0xe6,0x8e,0x00,0x00,0x8e,0x00,0x00,0x7c,0x00,0x00,
+    // 'q' 6x9 at 0,3
+    0x0c,0xee,0xeb,0x7e,0x00,0xbb,0xbb,0x00,0xbb,0xbb,0x00,0xbb,0x8e,0x00,0xbb,0x0e,0xee,0xfb,0x00,0x00,0xbb,0x00,0x00,0xbb,0x00,0x00,0xaa,
+    // 'r' 4x6 at 0,3
+    0x8e,0xce,0x8e,0x80,0x8e,0x00,0x8e,0x00,0x8e,0x00,0x8e,0x00,
+    // 's' 5x6 at 0,3
+    0x6e,0xee,0xdb,0xb0,0x00,0x8f,0xca,0x00,0x08,0xce,0x00,0x00,0xe9,0xee,0xec,
+    // 't' 4x8 at 0,1
+    0x0c,0x00,0x0e,0x00,0xcf,0xee,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0c,0xee,
+    // 'u' 6x6 at 0,3
+    0x8e,0x00,0xbb,0x8e,0x00,0xbb,0x8e,0x00,0xbb,0x8e,0x00,0xbb,0x6e,0x00,0xbb,0x0e,0xee,0xeb,
+    // 'v' 6x6 at 0,3
+    0xca,0x00,0xca,0x9d,0x00,0xe0,0x0f,0x06,0xe0,0x0d,0x7b,0xb0,0x0b,0xbd,0x70,0x06,0xfe,0x00,
+    // 'w' 9x6 at 0,3
+    0xca,0x00,0xf6,0x08,0xc8,0xc0,0x9e,0xb0,0xbb,0x0e,0x0c,0xad,0x0d,0x70,0xe0,0xe0,0xe0,0xe0,0x0c,0xbd,0x0c,0xbd,0x00,0x9f,0xb0,0x9f,0xb0,
+    // 'x' 5x6 at 0,3
+    0xbc,0x06,0xe0,0xe7,0xe7,0x07,0xfc,0x00,0x7f,0xc0,0x0e,0x7e,0x8b,0xc0,0x7e,
+    // 'y' 6x9 at 0,3
+    0xca,0x00,0xca,0x9c,0x00,0xe0,0x0f,0x06,0xe0,0x0d,0x7a,0xb0,0x0b,0xbd,0x70,0x06,0xff,0x00,0x00,0x8c,0x00,0x00,0xca,0x00,0x00,0xc0,0x00,
+    // 'z' 5x6 at 0,3
+    0xae,0xee,0xf0,0x00,0xdb,0x00,0xbc,0x00,0x7e,0x00,0x0e,0x70,0x0b,0xfe,0xee,
+    // '{' 4x11 at 0,0
+    0x06,0xec,0x0b,0xb0,0x0b,0xb0,0x0b,0xb0,0x7e,0x80,0xce,0x00,0x0c,0xb0,0x0b,0xb0,0x0b,0xa0,0x09,0xe7,0x00,0x8a,
+    // '|' 1x12 at 1,0
+    0xae,0xee,0xee,0xee,0xee,0xec,
+    // '}' 4x11 at 0,0
+    0xae,0x70,0x09,0xd0,0x08,0xe0,0x08,0xe0,0x00,0xe8,0x00,0xce,0x07,0xe0,0x08,0xe0,0x08,0xe0,0x6c,0xb0,0x8a,0x00,
+    // '~' 5x2 at 1,5
+    0xde,0xb8,0xb7,0x0a,0xc9,
 };
 
-const uint8 titillium_web_widths[] = {
-    3, 3, 5, 7, 7, 7, 9, 3, 3, 3, 5, 7, 3, 5, 3, 5, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 3, 3, 7, 7, 7, 6, 12, 7, 8, 7, 8, 7, 7, 8, 8, 3, 4, 7, 6, 10, 8, 8, 7, 8, 8, 7, 7, 8, 7, 11, 7, 7, 7, 4, 5, 4, 7, 8, 3, 6, 7, 5, 7, 6, 4, 6, 7, 3, 3, 6, 3, 10, 7, 7, 7, 7, 4, 6, 4, 7, 6, 10, 6, 6, 6, 4, 3, 4, 7, 3, 7, 3, 3, 7, 4, 9, 6, 7, 3, 10, 7, 4, 12, 3, 7, 3, 3, 3, 3, 5, 5, 6, 8, 14, 3, 8, 6, 4, 11, 3, 6, 7, 3, 3, 7, 7, 7, 7, 3, 6, 3, 8, 5, 7, 7, 3, 8, 3, 7, 7, 3, 3, 3, 7, 7, 3, 3, 3, 5, 7, 7, 7, 7, 6, 7, 7, 7, 7, 7, 7, 11, 7, 7, 7, 7, 7, 3, 3, 3, 3, 8, 8, 8, 8, 8, 8, 8, 7, 8, 8, 8, 8, 8, 7, 7, 7, 6, 6, 6, 6, 6, 6, 10, 5, 6, 6, 6, 6, 3, 3, 3, 3, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 6, 7, 6
+const imglyph_t titillium_web_glyphs[] = {
+    {0, 3, 0, 0, 0, 0}, // ' '
+    {0, 3, 1, 0, 1, 9}, // '!'
+    {5, 5, 0, 0, 4, 4}, // '"'
+    {13, 7, 0, 1, 7, 8}, // '#'
+    {41, 7, 0, 0, 6, 11}, // '$'
+    {74, 7, 0, 1, 7, 9}, // '%'
+    {106, 9, 0, 0, 8, 9}, // '&'
+    {142, 3, 0, 0, 2, 4}, // '''
+    {146, 3, 0, 0, 3, 11}, // '('
+    {163, 3, 0, 0, 3, 11}, // ')'
+    {180, 5, 0, 0, 5, 5}, // '*'
+    {193, 7, 0, 3, 6, 6}, // '+'
+    {211, 3, 0, 7, 2, 4}, // ','
+    {215, 5, 0, 5, 5, 2}, // '-'
+    {220, 3, 0, 7, 2, 2}, // '.'
+    {222, 5, 0, 0, 5, 9}, // '/'
+    {245, 7, 0, 1, 7, 8}, // '0'
+    {273, 7, 1, 1, 4, 8}, // '1'
+    {289, 7, 0, 1, 6, 8}, // '2'
+    {313, 7, 0, 1, 6, 8}, // '3'
+    {337, 7, 0, 1, 7, 8}, // '4'
+    {365, 7, 0, 1, 6, 8}, // '5'
+    {389, 7, 0, 1, 7, 8}, // '6'
+    {417, 7, 1, 1, 5, 8}, // '7'
+    {437, 7, 0, 1, 7, 8}, // '8'
+    {465, 7, 0, 1, 6, 8}, // '9'
+    {489, 3, 0, 3, 2, 6}, // ':'
+    {495, 3, 0, 3, 2, 8}, // ';'
+    {503, 7, 0, 3, 6, 6}, // '<'
+    {521, 7, 0, 4, 6, 4}, // '='
+    {533, 7, 1, 3, 5, 6}, // '>'
+    {548, 6, 0, 0, 5, 9}, // '?'
+    {571, 12, 0, 0, 12, 12}, // '@'
+    {643, 7, 0, 0, 7, 9}, // 'A'
+    {675, 8, 1, 0, 6, 9}, // 'B'
+    {702, 7, 0, 0, 6, 9}, // 'C'
+    {729, 8, 1, 0, 6, 9}, // 'D'
+    {756, 7, 1, 0, 5, 9}, // 'E'
+    {779, 7, 1, 0, 5, 9}, // 'F'
+    {802, 8, 0, 0, 7, 9}, // 'G'
+    {834, 8, 1, 0, 6, 9}, // 'H'
+    {861, 3, 1, 0, 1, 9}, // 'I'
+    {866, 4, 0, 0, 3, 10}, // 'J'
+    {881, 7, 1, 0, 6, 9}, // 'K'
+    {908, 6, 1, 0, 5, 9}, // 'L'
+    {931, 10, 1, 0, 8, 9}, // 'M'
+    {967, 8, 1, 0, 6, 9}, // 'N'
+    {994, 8, 0, 0, 8, 9}, // 'O'
+    {1030, 7, 1, 0, 6, 9}, // 'P'
+    {1057, 8, 0, 0, 8, 11}, // 'Q'
+    {1101, 8, 1, 0, 6, 9}, // 'R'
+    {1128, 7, 0, 0, 6, 9}, // 'S'
+    {1155, 7, 0, 0, 7, 9}, // 'T'
+    {1187, 8, 1, 0, 6, 9}, // 'U'
+    {1214, 7, 0, 0, 7, 9}, // 'V'
+    {1246, 11, 0, 0, 11, 9}, // 'W'
+    {1296, 7, 0, 0, 7, 9}, // 'X'
+    {1328, 7, 0, 0, 6, 9}, // 'Y'
+    {1355, 7, 0, 0, 6, 9}, // 'Z'
+    {1382, 4, 1, 0, 3, 11}, // '['
+    {1399, 5, 0, 0, 5, 9}, // '\'
+    {1422, 4, 0, 0, 3, 11}, // ']'
+    {1439, 7, 1, 1, 5, 5}, // '^'
+    {1452, 8, 1, 10, 6, 1}, // '_'
+    {1455, 3, 0, 0, 3, 2}, // '`'
+    {1458, 6, 0, 3, 6, 6}, // 'a'
+    {1476, 7, 0, 0, 6, 9}, // 'b'
+    {1503, 5, 0, 3, 5, 6}, // 'c'
+    {1518, 7, 0, 0, 6, 9}, // 'd'
+    {1545, 6, 0, 3, 6, 6}, // 'e'
+    {1563, 4, 0, 0, 4, 9}, // 'f'
+    {1581, 6, 0, 3, 6, 9}, // 'g'
+    {1608, 7, 0, 0, 6, 9}, // 'h'
+    {1635, 3, 0, 0, 2, 9}, // 'i'
+    {1644, 3, 0, 0, 2, 12}, // 'j'
+    {1656, 6, 0, 0, 6, 9}, // 'k'
+    {1683, 3, 1, 0, 1, 9}, // 'l'
+    {1688, 10, 0, 3, 10, 6}, // 'm'
+    {1718, 7, 0, 3, 6, 6}, // 'n'
+    {1736, 7, 0, 3, 6, 6}, // 'o'
+    {1754, 7, 0, 3, 6, 9}, // 'p'
+    {1781, 7, 0, 3, 6, 9}, // 'q'
+    {1808, 4, 0, 3, 4, 6}, // 'r'
+    {1820, 6, 0, 3, 5, 6}, // 's'
+    {1835, 4, 0, 1, 4, 8}, // 't'
+    {1851, 7, 0, 3, 6, 6}, // 'u'
+    {1869, 6, 0, 3, 6, 6}, // 'v'
+    {1887, 10, 0, 3, 9, 6}, // 'w'
+    {1914, 6, 0, 3, 5, 6}, // 'x'
+    {1929, 6, 0, 3, 6, 9}, // 'y'
+    {1956, 6, 0, 3, 5, 6}, // 'z'
+    {1971, 4, 0, 0, 4, 11}, // '{'
+    {1993, 3, 1, 0, 1, 12}, // '|'
+    {1999, 4, 0, 0, 4, 11}, // '}'
+    {2021, 7, 1, 5, 5, 2}, // '~'
 };
 
 imfont_t font_titillium_web = {
     titillium_web_bytes,
-    titillium_web_offsets,
-    titillium_web_widths,
+    titillium_web_glyphs,
+    NULL, 0,
+    4,
     18, 12
 };
\ No newline at end of file
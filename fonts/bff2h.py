@@ -1,4 +1,4 @@
-
+import sys
 from bffloader import BffFont
 
 # BFF_FILE = "Segoe UI.bff"
@@ -9,8 +9,18 @@ BFF_FILE = "Titillium Web.bff"
 OUTPUT_H_FILE = "TitilliumWeb.h"
 FONT_NAME = "titillium_web"
 
+# Or: bff2h.py font.bff output.h font_name [kerning.txt]
+if len(sys.argv) >= 4:
+    BFF_FILE, OUTPUT_H_FILE, FONT_NAME = sys.argv[1:4]
+
+# Optional kerning pairs, one per line: two characters and an adjustment in pixels (eg. "AV -1")
+KERNING_FILE = sys.argv[4] if len(sys.argv) >= 5 else None
+
 FONT_END = ord('~')
 
+# Bits of coverage per pixel (1, 2 or 4)
+BPP = 4
+
 font = BffFont()
 font.load(BFF_FILE)
 
@@ -19,42 +29,81 @@ if font.base != ord(' '):
 
 font.image = font.image.convert('L')
 
+kerning = []
+if KERNING_FILE:
+    for line in open(KERNING_FILE):
+        if line.strip():
+            pair, adjust = line.split()
+            kerning.append((pair[0], pair[1], int(adjust)))
+    kerning.sort()
+
+
+def c_char(c):
+    return "'\\%s'" % c if c in "\\'" else "'%s'" % c
+
+
+def pack(values):
+    # MSB first, rows aren't padded
+    data = []
+    byte = 0
+    bits = 0
+    for v in values:
+        byte = (byte << BPP) | v
+        bits += BPP
+        if bits == 8:
+            data.append(byte)
+            byte = 0
+            bits = 0
+    if bits:
+        data.append(byte << (8 - bits))
+    return data
+
 
 with open(OUTPUT_H_FILE, 'w') as f:
-    offsets = []
+    glyphs = []
     offset = 0
 
     f.write("uint8 __eds__ {fontname}_bytes[] __attribute__((space(prog))) = {{\n".format(fontname=FONT_NAME))
     for c in range(font.base, FONT_END+1):
         glyph, width = font.get_glyph(chr(c))
 
-        offsets.append(offset)
-        f.write("    // '{char}'\n".format(char=chr(c)))
-        for y in range(font.cellHeight):
-            f.write("    ")
-            for x in range(width):
-                px = glyph.getpixel((x, y)) * (2**5) / (2**8)
-                f.write("0x%.2x," % px)
-                offset += 1
-            f.write("\n")
-        f.write("\n")
+        # Coverage, cropped to the glyph's bounding box
+        cov = [[glyph.getpixel((x, y)) * (2**BPP) // (2**8) for x in range(width)] for y in range(font.cellHeight)]
+        xs = [x for x in range(width) if any(cov[y][x] for y in range(font.cellHeight))]
+        ys = [y for y in range(font.cellHeight) if any(cov[y])]
+        if xs:
+            bx, by = xs[0], ys[0]
+            bw, bh = xs[-1] - bx + 1, ys[-1] - by + 1
+        else:
+            bx, by, bw, bh = 0, 0, 0, 0
+
+        data = pack([cov[y][x] for y in range(by, by+bh) for x in range(bx, bx+bw)])
+        glyphs.append((offset, width, bx, by, bw, bh))
+
+        f.write("    // '{char}' {w}x{h} at {x},{y}\n".format(char=chr(c), w=bw, h=bh, x=bx, y=by))
+        if data:
+            f.write("    " + "".join("0x%.2x," % b for b in data) + "\n")
+        offset += len(data)
 
     f.write("};\n\n")
 
-    f.write("const uint16 {fontname}_offsets[] = {{\n".format(fontname=FONT_NAME))
-    f.write("    ")
-    f.write(", ".join([str(w) for w in offsets]))
-    f.write("\n};\n\n")
+    f.write("const imglyph_t {fontname}_glyphs[] = {{\n".format(fontname=FONT_NAME))
+    for c, g in zip(range(font.base, FONT_END+1), glyphs):
+        f.write("    {{{0}, {1}, {2}, {3}, {4}, {5}}},".format(*g) + " // '{char}'\n".format(char=chr(c)))
+    f.write("};\n\n")
 
-    f.write("const uint8 {fontname}_widths[] = {{\n".format(fontname=FONT_NAME))
-    f.write("    ")
-    f.write(", ".join([str(w) for w in font.widths[font.base:]]))
-    f.write("\n};\n\n")
+    if kerning:
+        f.write("const imkern_t {fontname}_kerning[] = {{\n".format(fontname=FONT_NAME))
+        for left, right, adjust in kerning:
+            f.write("    {{{0}, {1}, {2}}},\n".format(c_char(left), c_char(right), adjust))
+        f.write("};\n\n")
 
     f.write("""\
 imfont_t font_{fontname} = {{
     {fontname}_bytes,
-    {fontname}_offsets,
-    {fontname}_widths,
+    {fontname}_glyphs,
+    {kerning}, {num_kerning},
+    {bpp},
     {cellwidth}, {cellheight}
-}};""".format(fontname=FONT_NAME, cellwidth=font.cellWidth, cellheight=font.cellHeight))
+}};""".format(fontname=FONT_NAME, cellwidth=font.cellWidth, cellheight=font.cellHeight, bpp=BPP,
+              kerning=(FONT_NAME + "_kerning") if kerning else "NULL", num_kerning=len(kerning)))
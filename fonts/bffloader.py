@@ -30,12 +30,12 @@ class BffFont(object):
 
     def load(self, filename):
         with open(filename, 'rb') as f:
-            dat = f.read()
+            dat = bytearray(f.read())
 
         offset = 0
 
         # Check ID is 'BFF2'
-        if ord(dat[0]) != 0xBF or ord(dat[1]) != 0xF2:
+        if dat[0] != 0xBF or dat[1] != 0xF2:
             raise Exception("Invalid file header")
         offset += 2
 
@@ -48,16 +48,16 @@ class BffFont(object):
         self.imgWidth, self.imgHeight = struct.unpack("ii", dat[2:10])
         self.cellWidth, self.cellHeight = struct.unpack("ii", dat[10:18])
 
-        self.bpp = ord(dat[18])
-        self.base = ord(dat[19])
+        self.bpp = dat[18]
+        self.base = dat[19]
 
-        ImgSize = (self.imgWidth*self.imgHeight)*(self.bpp/8)
+        ImgSize = (self.imgWidth*self.imgHeight)*(self.bpp//8)
 
         if len(dat) != (MAP_DATA_OFFSET + ImgSize):
             raise Exception("Invalid filesize")
 
         # Calculate font params
-        RowPitch = self.imgWidth / self.cellWidth
+        RowPitch = self.imgWidth // self.cellWidth
         ColFactor = float(self.cellWidth)/float(self.imgWidth)
         RowFactor = float(self.cellHeight)/float(self.imgHeight)
         YOffset = self.cellHeight
@@ -76,10 +76,10 @@ class BffFont(object):
             raise Exception("Unsupported bit depth")
 
         # Grab char widths
-        self.widths = [ord(w) for w in dat[WIDTH_DATA_OFFSET:WIDTH_DATA_OFFSET+256]]
+        self.widths = list(dat[WIDTH_DATA_OFFSET:WIDTH_DATA_OFFSET+256])
 
         # Grab image data
-        image_data = dat[MAP_DATA_OFFSET:MAP_DATA_OFFSET+ImgSize]
+        image_data = bytes(dat[MAP_DATA_OFFSET:MAP_DATA_OFFSET+ImgSize])
         self.image = Image.frombuffer(imgMode, (self.imgWidth, self.imgHeight), image_data, 'raw', imgMode, 0, 1)
         #self.image.save("out.png")
 
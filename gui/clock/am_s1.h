@@ -1,34 +1,34 @@
 #define AM_S1_WIDTH	26
 #define AM_S1_HEIGHT	28
-#define AM_S1_SIZE	(AM_S1_WIDTH * AM_S1_HEIGHT * 2)
-uint16 __eds__ am_s1_bytes[1456] __attribute__((space(prog))) = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x5b53,0x2988,0x5b53,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x84ba,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0x9d7e,0x9d7e,0x9d7e,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0x8d1c,0x84ba,0x8d1c,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0x7c78,0x0000,0x7c78,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0x7416,0x0000,0x7416,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0xffff,0x9d7e,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0x5b53,0x0000,0x5b53,0xffff,0xffff,0xffff,0x84ba,0xffff,0xffff,0xffff,0x84ba,0xffff,0xffff,0xffff,0xffff,0x84ba,0xffff,0xffff,0xffff,0x5b53,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x5b53,0x18e5,0x0000,0x18e5,0x5b53,0x7416,0x5b53,0x2988,0x5b53,0x7416,0x5b53,0x2988,0x5b53,0x7416,0x7416,0x5b53,0x2988,0x5b53,0x7416,0x5b53,0x18e5,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+#define AM_S1_SIZE	610
+uint16 __eds__ am_s1_bytes[305] __attribute__((space(prog))) = {
+	0x001a,
+	0x001a,
+	0x001a,
+	0x001a,
+	0x001a,
+	0x001a,
+	0x001a,
+	0x001a,
+	0x001a,
+	0x001a,
+	0x001a,
+	0x001a,
+	0x001a,
+	0x0001,0x8002,0x18e5,0x5b53,0x4007,0x7416,0x8003,0x5b53,0x2988,0x5b53,0x400a,0x7416,0x8002,0x5b53,0x18e5,0x0001,
+	0x0001,0x8001,0x5b53,0x4009,0xffff,0x8001,0x84ba,0x400c,0xffff,0x8001,0x5b53,0x0001,
+	0x0001,0x8001,0x7416,0x4009,0xffff,0x8001,0x9d7e,0x400c,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4009,0xffff,0x8001,0x9d7e,0x400c,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4003,0xffff,0x4003,0x9d7e,0x4003,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x9d7e,0x4004,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4009,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x9d7e,0x4004,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4009,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x9d7e,0x4004,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4009,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x9d7e,0x4004,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4009,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x9d7e,0x4004,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4003,0xffff,0x8003,0x8d1c,0x84ba,0x8d1c,0x4003,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x9d7e,0x4004,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4003,0xffff,0x8001,0x7c78,0x0001,0x8001,0x7c78,0x4003,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x9d7e,0x4004,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4003,0xffff,0x8001,0x7416,0x0001,0x8001,0x7416,0x4003,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x9d7e,0x4004,0xffff,0x8001,0x9d7e,0x4003,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x5b53,0x4003,0xffff,0x8001,0x5b53,0x0001,0x8001,0x5b53,0x4003,0xffff,0x8001,0x84ba,0x4003,0xffff,0x8001,0x84ba,0x4004,0xffff,0x8001,0x84ba,0x4003,0xffff,0x8001,0x5b53,0x0001,
+	0x0001,0x8005,0x18e5,0x5b53,0x7416,0x5b53,0x18e5,0x0001,0x8012,0x18e5,0x5b53,0x7416,0x5b53,0x2988,0x5b53,0x7416,0x5b53,0x2988,0x5b53,0x7416,0x7416,0x5b53,0x2988,0x5b53,0x7416,0x5b53,0x18e5,0x0001,
+	0x001a,
 };
-const image_t img_am_s1 = {am_s1_bytes, AM_S1_WIDTH, AM_S1_HEIGHT};
+const image_t img_am_s1 = {am_s1_bytes, AM_S1_WIDTH, AM_S1_HEIGHT, IMAGE_RLE};
@@ -1,34 +1,34 @@
 #define C1_S1_WIDTH	14
 #define C1_S1_HEIGHT	28
-#define C1_S1_SIZE	(C1_S1_WIDTH * C1_S1_HEIGHT * 2)
-uint16 __eds__ c1_s1_bytes[784] __attribute__((space(prog))) = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7c78,0x8d1c,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7c78,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+#define C1_S1_SIZE	438
+uint16 __eds__ c1_s1_bytes[219] __attribute__((space(prog))) = {
+	0x000e,
+	0x0001,0x8002,0x18e5,0x5b53,0x4008,0x7416,0x8002,0x5b53,0x18e5,0x0001,
+	0x0001,0x8001,0x5b53,0x400a,0xffff,0x8001,0x5b53,0x0001,
+	0x0001,0x8001,0x7416,0x400a,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x400a,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x400a,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x400a,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x5b53,0x400a,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8006,0x18e5,0x5b53,0x7416,0x7416,0x7c78,0x8d1c,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7c78,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0006,0x8001,0x5b53,0x4005,0xffff,0x8001,0x5b53,0x0001,
+	0x0006,0x8002,0x18e5,0x5b53,0x4003,0x7416,0x8002,0x5b53,0x18e5,0x0001,
+	0x000e,
 };
-const image_t img_c1_s1 = {c1_s1_bytes, C1_S1_WIDTH, C1_S1_HEIGHT};
+const image_t img_c1_s1 = {c1_s1_bytes, C1_S1_WIDTH, C1_S1_HEIGHT, IMAGE_RLE};
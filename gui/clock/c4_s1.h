@@ -1,34 +1,34 @@
 #define C4_S1_WIDTH	23
 #define C4_S1_HEIGHT	28
-#define C4_S1_SIZE	(C4_S1_WIDTH * C4_S1_HEIGHT * 2)
-uint16 __eds__ c4_s1_bytes[1288] __attribute__((space(prog))) = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7c78,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7c78,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8d1c,0x7c78,0x7416,0x7416,0x7416,0x7416,0x7c78,0x8d1c,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7c78,0x8d1c,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7c78,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+#define C4_S1_SIZE	660
+uint16 __eds__ c4_s1_bytes[330] __attribute__((space(prog))) = {
+	0x0017,
+	0x0001,0x8002,0x18e5,0x5b53,0x4004,0x7416,0x8002,0x5b53,0x18e5,0x0006,0x8002,0x18e5,0x5b53,0x4003,0x7416,0x8002,0x5b53,0x18e5,0x0001,
+	0x0001,0x8001,0x5b53,0x4006,0xffff,0x8001,0x5b53,0x0006,0x8001,0x5b53,0x4005,0xffff,0x8001,0x5b53,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8001,0x7416,0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8001,0x7416,0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8001,0x7416,0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8001,0x7416,0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8001,0x7416,0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8001,0x7416,0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8001,0x7416,0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8001,0x7416,0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8001,0x7416,0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8001,0x7416,0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8001,0x7416,0x0006,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8001,0x7c78,0x0006,0x8001,0x7c78,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4006,0xffff,0x8002,0x8d1c,0x7c78,0x4004,0x7416,0x8002,0x7c78,0x8d1c,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x5b53,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8002,0x18e5,0x5b53,0x400b,0x7416,0x8002,0x7c78,0x8d1c,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x000f,0x8001,0x7c78,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x000f,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x000f,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x000f,0x8001,0x5b53,0x4005,0xffff,0x8001,0x5b53,0x0001,
+	0x000f,0x8002,0x18e5,0x5b53,0x4003,0x7416,0x8002,0x5b53,0x18e5,0x0001,
+	0x0017,
 };
-const image_t img_c4_s1 = {c4_s1_bytes, C4_S1_WIDTH, C4_S1_HEIGHT};
+const image_t img_c4_s1 = {c4_s1_bytes, C4_S1_WIDTH, C4_S1_HEIGHT, IMAGE_RLE};
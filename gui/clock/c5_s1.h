@@ -1,34 +1,34 @@
 #define C5_S1_WIDTH	23
 #define C5_S1_HEIGHT	28
-#define C5_S1_SIZE	(C5_S1_WIDTH * C5_S1_HEIGHT * 2)
-uint16 __eds__ c5_s1_bytes[1288] __attribute__((space(prog))) = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x8d1c,0x7c78,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7c78,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7c78,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x8d1c,0x7c78,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7c78,0x8d1c,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7c78,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7c78,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7c78,0x8d1c,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+#define C5_S1_SIZE	476
+uint16 __eds__ c5_s1_bytes[238] __attribute__((space(prog))) = {
+	0x0017,
+	0x0001,0x8002,0x18e5,0x5b53,0x4011,0x7416,0x8002,0x5b53,0x18e5,0x0001,
+	0x0001,0x8001,0x5b53,0x4013,0xffff,0x8001,0x5b53,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x5b53,0x0001,
+	0x0001,0x8001,0x7416,0x4005,0xffff,0x8002,0x8d1c,0x7c78,0x400b,0x7416,0x8002,0x5b53,0x18e5,0x0001,
+	0x0001,0x8001,0x7416,0x4005,0xffff,0x8001,0x7c78,0x000f,
+	0x0001,0x8001,0x7416,0x4005,0xffff,0x8001,0x7c78,0x000f,
+	0x0001,0x8001,0x7416,0x4005,0xffff,0x8002,0x8d1c,0x7c78,0x400b,0x7416,0x8002,0x5b53,0x18e5,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x5b53,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x5b53,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8002,0x18e5,0x5b53,0x400b,0x7416,0x8002,0x7c78,0x8d1c,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x000f,0x8001,0x7c78,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x000f,0x8001,0x7c78,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8002,0x18e5,0x5b53,0x400b,0x7416,0x8002,0x7c78,0x8d1c,0x4005,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x5b53,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x7416,0x4013,0xffff,0x8001,0x7416,0x0001,
+	0x0001,0x8001,0x5b53,0x4013,0xffff,0x8001,0x5b53,0x0001,
+	0x0001,0x8002,0x18e5,0x5b53,0x4011,0x7416,0x8002,0x5b53,0x18e5,0x0001,
+	0x0017,
 };
-const image_t img_c5_s1 = {c5_s1_bytes, C5_S1_WIDTH, C5_S1_HEIGHT};
+const image_t img_c5_s1 = {c5_s1_bytes, C5_S1_WIDTH, C5_S1_HEIGHT, IMAGE_RLE};
@@ -1,34 +1,34 @@
 #define COLON_S1_WIDTH	10
 #define COLON_S1_HEIGHT	28
-#define COLON_S1_SIZE	(COLON_S1_WIDTH * COLON_S1_HEIGHT * 2)
-uint16 __eds__ colon_s1_bytes[560] __attribute__((space(prog))) = {
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,
-	0x0000,0x7416,0xffff,0xffff,0xffff,0xffff,0xffff,0x7416,0x0000,0x0000,
-	0x0000,0x5b53,0xffff,0xffff,0xffff,0xffff,0xffff,0x5b53,0x0000,0x0000,
-	0x0000,0x18e5,0x5b53,0x7416,0x7416,0x7416,0x5b53,0x18e5,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+#define COLON_S1_SIZE	268
+uint16 __eds__ colon_s1_bytes[134] __attribute__((space(prog))) = {
+	0x000a,
+	0x000a,
+	0x000a,
+	0x000a,
+	0x000a,
+	0x000a,
+	0x0001,0x8002,0x18e5,0x5b53,0x4003,0x7416,0x8002,0x5b53,0x18e5,0x0002,
+	0x0001,0x8001,0x5b53,0x4005,0xffff,0x8001,0x5b53,0x0002,
+	0x0001,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0002,
+	0x0001,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0002,
+	0x0001,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0002,
+	0x0001,0x8001,0x5b53,0x4005,0xffff,0x8001,0x5b53,0x0002,
+	0x0001,0x8002,0x18e5,0x5b53,0x4003,0x7416,0x8002,0x5b53,0x18e5,0x0002,
+	0x000a,
+	0x000a,
+	0x0001,0x8002,0x18e5,0x5b53,0x4003,0x7416,0x8002,0x5b53,0x18e5,0x0002,
+	0x0001,0x8001,0x5b53,0x4005,0xffff,0x8001,0x5b53,0x0002,
+	0x0001,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0002,
+	0x0001,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0002,
+	0x0001,0x8001,0x7416,0x4005,0xffff,0x8001,0x7416,0x0002,
+	0x0001,0x8001,0x5b53,0x4005,0xffff,0x8001,0x5b53,0x0002,
+	0x0001,0x8002,0x18e5,0x5b53,0x4003,0x7416,0x8002,0x5b53,0x18e5,0x0002,
+	0x000a,
+	0x000a,
+	0x000a,
+	0x000a,
+	0x000a,
+	0x000a,
 };
-const image_t img_colon_s1 = {colon_s1_bytes, COLON_S1_WIDTH, COLON_S1_HEIGHT};
+const image_t img_colon_s1 = {colon_s1_bytes, COLON_S1_WIDTH, COLON_S1_HEIGHT, IMAGE_RLE};
@@ -1,14 +1,14 @@
 @echo off
-img2hx.py c0_s1.png
-img2hx.py c1_s1.png
-img2hx.py c2_s1.png
-img2hx.py c3_s1.png
-img2hx.py c4_s1.png
-img2hx.py c5_s1.png
-img2hx.py c6_s1.png
-img2hx.py c7_s1.png
-img2hx.py c8_s1.png
-img2hx.py c9_s1.png
-img2hx.py colon_s1.png
-img2hx.py am_s1.png
-img2hx.py pm_s1.png
\ No newline at end of file
+python ..\..\tools\img2h.py -n -r -k 0x0000 c0_s1.png
+python ..\..\tools\img2h.py -n -r -k 0x0000 c1_s1.png
+python ..\..\tools\img2h.py -n -r -k 0x0000 c2_s1.png
+python ..\..\tools\img2h.py -n -r -k 0x0000 c3_s1.png
+python ..\..\tools\img2h.py -n -r -k 0x0000 c4_s1.png
+python ..\..\tools\img2h.py -n -r -k 0x0000 c5_s1.png
+python ..\..\tools\img2h.py -n -r -k 0x0000 c6_s1.png
+python ..\..\tools\img2h.py -n -r -k 0x0000 c7_s1.png
+python ..\..\tools\img2h.py -n -r -k 0x0000 c8_s1.png
+python ..\..\tools\img2h.py -n -r -k 0x0000 c9_s1.png
+python ..\..\tools\img2h.py -n -r -k 0x0000 colon_s1.png
+python ..\..\tools\img2h.py -n -r -k 0x0000 am_s1.png
+python ..\..\tools\img2h.py -n -r -k 0x0000 pm_s1.png
\ No newline at end of file
@@ -1,12 +1,12 @@
 #define POWER_WIDTH	14
 #define POWER_HEIGHT	6
-#define POWER_SIZE	(POWER_WIDTH * POWER_HEIGHT * 2)
-uint16 __eds__ power_bytes[168] __attribute__((space(prog))) = {
-	0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0x738e,0x0000,0x0000,0x0000,0x0000,
-	0xbdf7,0xbdf7,0xbdf7,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8410,0x0000,0x0000,0x0000,
-	0x6b4d,0x6b4d,0x6b4d,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0xa534,0xa534,
-	0x6b4d,0x6b4d,0x6b4d,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0xa534,0xa534,
-	0xc618,0xc618,0xbdf7,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8410,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0x738e,0x0000,0x0000,0x0000,0x0000,
+#define POWER_SIZE	88
+uint16 __eds__ power_bytes[44] __attribute__((space(prog))) = {
+	0x0004,0x4005,0xffff,0x8001,0x738e,0x0004,
+	0x4003,0xbdf7,0x0001,0x4006,0xffff,0x8001,0x8410,0x0003,
+	0x4003,0x6b4d,0x0001,0x4007,0xffff,0x4003,0xa534,
+	0x4003,0x6b4d,0x0001,0x4007,0xffff,0x4003,0xa534,
+	0x8003,0xc618,0xc618,0xbdf7,0x0001,0x4006,0xffff,0x8001,0x8410,0x0003,
+	0x0004,0x4005,0xffff,0x8001,0x738e,0x0004,
 };
-const image_t img_power = {power_bytes, POWER_WIDTH, POWER_HEIGHT};
+const image_t img_power = {power_bytes, POWER_WIDTH, POWER_HEIGHT, IMAGE_RLE};
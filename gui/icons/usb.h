@@ -1,15 +1,15 @@
 #define USB_WIDTH	16
 #define USB_HEIGHT	9
-#define USB_SIZE	(USB_WIDTH * USB_HEIGHT * 2)
-uint16 __eds__ usb_bytes[288] __attribute__((space(prog))) = {
-	0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a49,0x0000,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0x0000,0x0000,0x4a49,0xffff,0x4a49,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x8430,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a49,0xffff,0x0000,0x8430,0xffff,0x8430,
-	0x8410,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-	0x0000,0x8430,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a49,0xffff,0x8430,0xffff,0x8430,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0x7bef,0x0000,0x0000,0x4a49,0xffff,0x4a49,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a49,0x0000,0x0000,0x0000,0x0000,
-	0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+#define USB_SIZE	140
+uint16 __eds__ usb_bytes[70] __attribute__((space(prog))) = {
+	0x0004,0x4003,0xffff,0x0009,
+	0x0004,0x4006,0xffff,0x8001,0x4a49,0x0005,
+	0x0004,0x4003,0xffff,0x0002,0x8003,0x4a49,0xffff,0x4a49,0x0004,
+	0x0001,0x8002,0x8430,0xffff,0x0007,0x8002,0x4a49,0xffff,0x0001,0x8003,0x8430,0xffff,0x8430,
+	0x8001,0x8410,0x400f,0xffff,
+	0x0001,0x8002,0x8430,0xffff,0x0008,0x8005,0x4a49,0xffff,0x8430,0xffff,0x8430,
+	0x0005,0x8003,0x7bef,0xffff,0x7bef,0x0002,0x8003,0x4a49,0xffff,0x4a49,0x0003,
+	0x0005,0x4006,0xffff,0x8001,0x4a49,0x0004,
+	0x0005,0x8003,0x7bef,0xffff,0x7bef,0x0008,
 };
-const image_t img_usb = {usb_bytes, USB_WIDTH, USB_HEIGHT};
+const image_t img_usb = {usb_bytes, USB_WIDTH, USB_HEIGHT, IMAGE_RLE};
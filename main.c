@@ -38,6 +38,8 @@
 #include "core/kernel.h"
 #include "core/os.h"
 #include "core/cpu.h"
+#include "core/workqueue.h"
+#include "core/timers.h"
 
 // Peripherals
 #include "peripherals/adc.h"
@@ -66,7 +68,7 @@
     _CONFIG3(0xFFFF);
 #endif
 
-extern int current_app; // os.c
+extern uint current_app; // os.c
 
 void Initialize() {
     InitializeIO();
@@ -85,6 +87,8 @@ void Initialize() {
 
     InitializeClock();
     InitializeKernel();
+    InitializeWorkQueue();
+    InitializeTimers();
     InitializeComms();
     //InitializeOled();
     InitializeOS();
@@ -133,7 +137,6 @@ void Initialize() {
 }
 
 int main() {
-    KernelSetSP(); // Sets stack_base to the current stack address
     Initialize();
 
     RegisterUserApplication(&apptest);
@@ -20,6 +20,8 @@
 #define USE_AND_OR
 #include <adc.h>
 #include "adc.h"
+#include "core/workqueue.h"
+#include "core/trace.h"
 
 ////////// Defines /////////////////////////////////////////////////////////////
 
@@ -46,6 +48,9 @@ volatile adc_status_t adc_status = adcDone;
 
 volatile voltage_t vdd = 0; // Automatically set after any ADC conversion
 
+// Channels waiting for the current conversion to finish (see _ADC1Interrupt)
+static volatile uint32 pending_channels = 0;
+
 ////////// Prototypes //////////////////////////////////////////////////////////
 
 void adc_enable();
@@ -125,12 +130,7 @@ void adc_SetCallback(uint8 channel, adc_conversion_cb callback) {
     adc_channels[channel].callback = callback;
 }
 
-void adc_StartConversion(uint8 channel) {
-    //TODO: What if we are already converting??
-    if (!mAdcEnabled)
-        adc_enable();
-
-    adc_status = adcConverting;
+static void start_conversion(uint8 channel) {
     current_channel = channel;
     
     // Start ADC conversion on the specified channel
@@ -139,6 +139,25 @@ void adc_StartConversion(uint8 channel) {
     AD1CON1bits.SAMP = 1;
 }
 
+void adc_StartConversion(uint8 channel) {
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+
+    // Queue it behind the conversion in progress
+    if (mAdcBusy) {
+        pending_channels |= 1UL << channel;
+        RESTORE_CPU_IPL(ipl);
+        return;
+    }
+
+    if (!mAdcEnabled)
+        adc_enable();
+
+    adc_status = adcConverting;
+    start_conversion(channel);
+    RESTORE_CPU_IPL(ipl);
+}
+
 // Blocking read for debugging
 uint adc_Read(uint8 channel) {
     if (!mAdcEnabled)
@@ -161,10 +180,17 @@ uint adc_Read(uint8 channel) {
 
 
 
+// Runs the channel's conversion callback from the work task (see _ADC1Interrupt)
+static void adc_dispatch(uint channel) {
+    volatile adc_channel_t* ch = &adc_channels[channel];
+    if (ch->callback != NULL) ch->callback(ch->voltage);
+}
+
 ////////// Interrupts //////////////////////////////////////////////////////////
 
 void isr _ADC1Interrupt() {
     _AD1IF = 0;
+    TraceISREnter(TRACE_ISR_ADC);
 
     // ADC alternates between mux A and mux B,
     // and interrupt is triggered on every second sample.
@@ -179,12 +205,24 @@ void isr _ADC1Interrupt() {
     vdd = VBG_VOLTAGE * 1024UL / (unsigned long)ch->abg;
     ch->voltage = (unsigned long)vdd * (unsigned long)ch->ach / 1024;
 
-    // ADC Conversion Callback
-    if (ch->callback != NULL) ch->callback(ch->voltage);
+    // ADC Conversion Callback (deferred to the work queue)
+    if (ch->callback != NULL) QueueWork(adc_dispatch, current_channel);
 
     AD1CON1bits.ASAM = 0;
     //AD1CON1bits.SAMP = 0;
 
+    // Start the next queued conversion
+    if (pending_channels) {
+        uint8 next = 0;
+        while (!(pending_channels & (1UL << next)))
+            next++;
+        pending_channels &= ~(1UL << next);
+        start_conversion(next);
+
+        TraceISRExit(TRACE_ISR_ADC);
+        return;
+    }
+
     adc_status = adcDone;
     
     // If all conversions have finished, disable the ADC
@@ -199,5 +237,7 @@ void isr _ADC1Interrupt() {
     }
     if (!test) adc_disable();
 #endif
+
+    TraceISRExit(TRACE_ISR_ADC);
 }
 
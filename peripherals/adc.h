@@ -46,10 +46,10 @@ uint adc_Read(uint8 channel);
 void adc_SetBandgap(bool enabled);
 
 // Optionally register a callback for the ADC channel. Set to NULL to disable callback
-// WARNING: Called from within an ISR, take care to make sure it's thread-safe!
+// The callback is run from the work queue, not the ISR (see core/workqueue.h)
 extern void adc_SetCallback(uint8 channel, adc_conversion_cb callback);
 
-// Start conversion on the specified channel
+// Start conversion on the specified channel, after any that is in progress
 extern void adc_StartConversion(uint8 channel);
 
 ////////// Properties //////////////////////////////////////////////////////////
@@ -9,6 +9,8 @@
 #include "hardware.h"
 #include "peripherals/gpio.h"
 #include "peripherals/cn.h"
+#include "core/workqueue.h"
+#include "core/trace.h"
 
 typedef struct {
     uint cn_pin;            // eg. CN1
@@ -48,13 +50,22 @@ void cn_register_cb(uint cn_pin, pinref_t pinref, cn_cb callback) {
     }*/
 }
 
+// Runs the pin callback from the work task (see _CNInterrupt)
+// param: index into cn_pins in the low byte, new pin state in the high byte
+static void cn_dispatch(uint param) {
+    cn_info_t* info = &cn_pins[param & 0xFF];
+    info->callback(param >> 8);
+}
+
 
 
 
 
 // Global pin-change interrupt handler
+// Callbacks are deferred to the work queue, so they may take as long as they need.
 void isr _CNInterrupt() {
     _CNIF = 0;
+    TraceISREnter(TRACE_ISR_CN);
 
     // Determine which pin changed
     int i;
@@ -64,8 +75,10 @@ void isr _CNInterrupt() {
         bool new_state = gpio_read(&info->pinref);
         if (info->state != new_state) {
             info->state = new_state;
-            info->callback(new_state);
+            QueueWork(cn_dispatch, i | ((uint)new_state << 8));
         }
     }
 
+    TraceISRExit(TRACE_ISR_CN);
+
 }
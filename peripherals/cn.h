@@ -10,7 +10,8 @@
 
 typedef void (*cn_cb)(bool value);
 
-// Register a pin-change interrupt callback
+// Register a pin-change interrupt callback.
+// The callback is run from the work queue, not the ISR (see core/workqueue.h)
 void cn_register_cb(uint cn_pin, pinref_t pinref, cn_cb callback);
 
 #endif	/* CN_H */
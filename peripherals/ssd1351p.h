@@ -25,7 +25,9 @@
 
 extern void ssd1351_write(BYTE c);
 extern void ssd1351_writebuf(char* buf, uint size);
-extern void ssd1351_writeimgbuf(__eds__ color_t* buf, uint size);
+// Send pixels from the screen buffer (already in bus order with GFX_WIRE_ORDER,
+// one byte per pixel with GFX_8BPP)
+extern void ssd1351_writeimgbuf(__eds__ pixel_t* buf, uint size);
 extern char ssd1351_read();
 
 extern void ssd1351_command(uint8 cmd);
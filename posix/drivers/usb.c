@@ -0,0 +1,181 @@
+/*
+ * File:   drivers/usb.c
+ * Author: Jared
+ *
+ * Host version of the USB HID driver (see drivers/usb/usb.c).
+ * When the cable is plugged in (host_vbus), the USB interrupt fires on every
+ * 1ms frame like the SOF interrupt on the PIC. Each frame can carry one OUT
+ * packet, read from a file of 64-byte packets, and one IN packet, which is
+ * appended to the output file.
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+#include "posix/host.h"
+#include "drivers/usb/usb.h"
+#include "core/kernel.h"
+#include "core/trace.h"
+#include "core/timers.h"
+
+////////// Defines /////////////////////////////////////////////////////////////
+
+#define CONNECTION_TIMEOUT 500
+#define FRAME_CYCLES (FCY / 1000)   // Full speed frame (1ms)
+#define ENUMERATION_FRAMES 100      // Frames after plugging in until configured
+
+////////// Global Variables ////////////////////////////////////////////////////
+
+unsigned char usb_rx_buffer[PACKET_SIZE];
+
+semaphore_t usb_transfer_sem;
+
+FILE* host_usb_in = NULL;   // OUT packets sent by the PC
+FILE* host_usb_out = NULL;  // IN packets received by the PC
+
+////////// Local Variables /////////////////////////////////////////////////////
+
+static proc_t on_usb_sleep = NULL;
+static proc_t on_usb_wake = NULL;
+static bool connected = false;
+static soft_timer_t connection_timer;
+
+static uint frame = 0;
+static bool rx_full = false;    // A packet is waiting in usb_rx_buffer
+static bool tx_busy = false;
+static unsigned char tx_packet[PACKET_SIZE];
+
+static uint32 packets_in = 0, packets_out = 0, packets_dropped = 0;
+
+////////// Prototypes //////////////////////////////////////////////////////////
+
+static void usb_timeout(uint param);
+static void usb_frame(int param);
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+void InitializeUSB(proc_t usb_sleep_cb, proc_t usb_wake_cb) {
+    on_usb_sleep = usb_sleep_cb;
+    on_usb_wake = usb_wake_cb;
+    connected = false;
+
+    SemInit(&usb_transfer_sem, 0);
+    TimerInit(&connection_timer, usb_timeout, 0);
+
+    _USB1IF = 0;
+    _USB1IP = 4;
+    _USB1IE = 1;
+
+    HostSchedule(HostTime() + FRAME_CYCLES, usb_frame, 0);
+}
+
+static void usb_reset_timeout() {
+    TimerStart(&connection_timer, CONNECTION_TIMEOUT, 0);
+}
+static void usb_connect() {
+    if (!connected) {
+        connected = true;
+        usb_reset_timeout();
+        if (on_usb_wake != NULL)
+            on_usb_wake();
+    }
+}
+static void usb_disconnect() {
+    if (connected) {
+        connected = false;
+        if (on_usb_sleep != NULL)
+            on_usb_sleep();
+    }
+}
+static void usb_timeout(uint param) {
+    usb_disconnect();
+}
+
+// Start of frame (simulated hardware)
+static void usb_frame(int param) {
+    HostSchedule(HostTime() + FRAME_CYCLES, usb_frame, 0);
+
+    if (!host_vbus) {
+        frame = 0;
+        return;
+    }
+
+    if (frame < ENUMERATION_FRAMES)
+        frame++;
+    _USB1IF = 1;
+}
+
+void USBProcess(usb_rx_packet_cb receive_callback) {
+    if (frame < ENUMERATION_FRAMES)
+        return;
+
+    if (rx_full) {
+        receive_callback(usb_rx_buffer);
+        rx_full = false;
+    }
+}
+
+void USBSendPacket(unsigned char* packet) {
+    if (!tx_busy) {
+        memcpy(tx_packet, packet, PACKET_SIZE);
+        tx_busy = true;
+    } else {
+        packets_dropped++;
+    }
+}
+
+BOOL USBBusy() {
+    if (frame < ENUMERATION_FRAMES) return false;
+    return !rx_full || tx_busy;
+}
+
+BOOL USBTxBusy() {
+    if (frame < ENUMERATION_FRAMES) return true;
+    return tx_busy;
+}
+
+void HostUsbReport() {
+    fprintf(host_report, "USB: %s, %lu packets in, %lu packets out, %lu dropped\n",
+            connected ? "connected" : "disconnected",
+            (unsigned long)packets_in, (unsigned long)packets_out, (unsigned long)packets_dropped);
+}
+
+////////// Interrupts //////////////////////////////////////////////////////////
+
+void isr _USB1Interrupt() {
+    bool transfer = false;
+
+    _USB1IF = 0;
+    if (!host_vbus)
+        return;
+
+    usb_connect();
+    usb_reset_timeout();
+
+    if (frame < ENUMERATION_FRAMES)
+        return;
+
+    // IN transfer
+    if (tx_busy) {
+        if (host_usb_out != NULL)
+            fwrite(tx_packet, PACKET_SIZE, 1, host_usb_out);
+        tx_busy = false;
+        packets_out++;
+        transfer = true;
+    }
+
+    // OUT transfer (only once the previous packet has been processed)
+    if (!rx_full && host_usb_in != NULL) {
+        if (fread(usb_rx_buffer, PACKET_SIZE, 1, host_usb_in) == 1) {
+            rx_full = true;
+            packets_in++;
+            transfer = true;
+        }
+    }
+
+    if (transfer) {
+        TraceMark(TRACE_MARK_USB, 0);
+        SemPost(&usb_transfer_sem);
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * File:   hardware.c
+ * Author: Jared
+ *
+ * Storage for the registers in p24_host.h that are just memory,
+ * and the simulated board inputs (buttons, USB VBUS).
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include "posix/host.h"
+
+////////// Registers ///////////////////////////////////////////////////////////
+
+#define HOST_PORT_STORAGE(x) \
+    host_tris##x##_t host_tris##x = {0xFFFF}; \
+    host_port##x##_t host_port##x; \
+    host_lat##x##_t host_lat##x; \
+    host_odc##x##_t host_odc##x; \
+    host_ans##x##_t host_ans##x;
+
+HOST_PORT_STORAGE(B)
+HOST_PORT_STORAGE(C)
+HOST_PORT_STORAGE(D)
+HOST_PORT_STORAGE(E)
+HOST_PORT_STORAGE(F)
+HOST_PORT_STORAGE(G)
+
+volatile uint8 host_cnie[NUM_HOST_CN];
+volatile uint8 host_cnpue[NUM_HOST_CN];
+volatile uint8 host_cnpde[NUM_HOST_CN];
+
+host_rcon_reg_t host_rcon = {_RCON_POR_MASK};
+
+volatile uint16 PMD1, PMD2, PMD3, PMD4, PMD5, PMD6;
+volatile uint16 host_dummy;
+
+volatile bool host_vbus = false;
+
+host_clkdiv_t CLKDIVbits;
+host_osccon_t OSCCONbits;
+host_rcfgcal_t RCFGCALbits;
+
+////////// Buttons /////////////////////////////////////////////////////////////
+
+// Buttons are active high, and raise a pin change interrupt if it is enabled
+void HostButton(uint btn, bool pressed) {
+    uint cn;
+
+    switch (btn) {
+        case 1: _PORT(BTN1) = pressed; cn = _CNIDX(BTN1_CN); break;
+        case 2: _PORT(BTN2) = pressed; cn = _CNIDX(BTN2_CN); break;
+        case 3: _PORT(BTN3) = pressed; cn = _CNIDX(BTN3_CN); break;
+        case 4: _PORT(BTN4) = pressed; cn = _CNIDX(BTN4_CN); break;
+        default: return;
+    }
+
+    if (host_cnie[cn])
+        host_sfr.cnif = 1;
+}
@@ -0,0 +1,67 @@
+/*
+ * File:   host.h
+ * Author: Jared
+ *
+ * Internals shared between the files of the host port.
+ * The firmware only sees the interface in p24_host.h.
+ */
+
+#ifndef HOST_H
+#define	HOST_H
+
+#include <stdio.h>
+#include "system.h"
+#include "hardware.h"
+#include "core/kernel.h"
+
+////////// Configuration ///////////////////////////////////////////////////////
+
+// Cycle costs charged to virtual time. These are estimates of what the
+// firmware spends on the real hardware, so only relative timings are meaningful.
+#define HOST_ACCESS_CYCLES  2       // Each SFR access, ClrWdt() or IPL change
+#define HOST_SWITCH_CYCLES  120     // Context switch (register save/restore in kernel_asm.s)
+#define HOST_ISR_CYCLES     20      // Interrupt entry/exit
+
+#define HOST_STACK_SIZE     (256*1024) // Host stack for each task
+
+////////// Options /////////////////////////////////////////////////////////////
+
+typedef struct {
+    host_time_t run_time;   // Stop after this much virtual time (cycles)
+    double cpu_scale;       // Cycles charged per ns of host CPU time (0 for deterministic)
+    bool verbose;
+} host_options_t;
+
+extern host_options_t host_options;
+extern FILE* host_report;     // Report at the end of the run (stdout)
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+// Run time in milliseconds <-> cycles
+#define HostMsToCycles(ms) ((host_time_t)(ms) * (FCY / 1000))
+#define HostCyclesToMs(cycles) ((double)(cycles) * 1000.0 / FCY)
+
+// Print the end of run report and exit (see host_main.c)
+extern void HostExit(int status);
+
+// Called just before the first task starts, once the firmware's tasks are registered
+extern void HostStart();
+
+// Timer1 (systick) interrupts taken so far
+extern uint32 HostTimerInterrupts();
+
+// Simulated peripherals
+extern void HostButton(uint btn, bool pressed);
+extern void HostDisplayReport();
+extern uint32 HostDisplayTransferCycles();   // Cycles spent in ssd1351_writeimgbuf()
+extern bool HostDisplayWritePPM(const char* filename);
+extern void HostAccelSet(int x, int y, int z);
+extern void HostAnalogSet(uint channel, uint millivolts);
+extern void HostUsbReport();
+
+// Interrupt handlers, dispatched by kernel_port.c
+extern void _CNInterrupt();
+extern void _ADC1Interrupt();
+extern void _USB1Interrupt();
+
+#endif	/* HOST_H */
@@ -0,0 +1,291 @@
+/*
+ * File:   host_main.c
+ * Author: Jared
+ *
+ * Entry point of the host build. Sets up the simulated board from the
+ * command line, runs the firmware's main() (renamed to zeitgeber_main),
+ * and prints a report once the virtual run time has elapsed.
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#define _XOPEN_SOURCE 700
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "posix/host.h"
+#include "api/graphics/gfx.h"
+#include "api/graphics/imfont.h"
+
+////////// Variables ///////////////////////////////////////////////////////////
+
+host_options_t host_options = {
+    .run_time = HostMsToCycles(10000),
+    .cpu_scale = 0,
+    .verbose = false,
+};
+
+static const char* screenshot_file = NULL;
+
+// Tickless sleep check (-c)
+static uint check_period = 0;       // ms
+static systick_t check_start_tick;
+static host_time_t check_start_time;
+static uint32 check_start_t1;
+static systick_t check_last_tick;   // At the last wakeup, when systick is up to date
+static host_time_t check_last_time;
+static uint32 check_last_t1;
+static uint32 check_wakeups = 0;
+static uint32 check_late = 0;       // Wakeups that weren't on the expected systick
+
+FILE* host_report;
+
+extern task_t tasks[];
+extern uint num_tasks;
+extern FILE* host_usb_in;
+extern FILE* host_usb_out;
+
+extern int zeitgeber_main();
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+static void usage() {
+    fprintf(stderr,
+        "Usage: zeitgeber [options]\n"
+        "  -t ms           Virtual time to run for (default 10000)\n"
+        "  -b btn@ms[+ms]  Press button 1-4 at a time, for a duration (default 100ms)\n"
+        "  -u              USB cable plugged in\n"
+        "  -i file         OUT packets to send over USB (64 bytes each)\n"
+        "  -o file         Save the IN packets received over USB\n"
+        "  -a x,y,z        Accelerometer reading (1/64 g, default 0,0,64)\n"
+        "  -l mV           Ambient light sensor voltage (default 1000)\n"
+        "  -s file.ppm     Save the display contents at the end of the run\n"
+        "  -p scale        Also charge host CPU time (cycles per ns, not deterministic)\n"
+        "  -c ms           Check that a task sleeping ms at a time wakes on time (see make check)\n"
+        "  -v              Print the firmware's debug messages\n");
+    exit(2);
+}
+
+static void press(int btn) { HostButton(btn, true); }
+static void release(int btn) { HostButton(btn, false); }
+
+// Sleeps in a loop, counting the wakeups that don't land on the expected systick
+static void check_task() {
+    systick_t expected = GetSystick();
+
+    check_start_tick = expected;
+    check_start_time = HostTime();
+    check_start_t1 = HostTimerInterrupts();
+
+    while (1) {
+        expected += check_period;
+        Delay(check_period);
+
+        check_last_tick = GetSystick();
+        check_last_time = HostTime();
+        check_last_t1 = HostTimerInterrupts();
+
+        check_wakeups++;
+        if (check_last_tick != expected) {
+            check_late++;
+            expected = check_last_tick;
+        }
+    }
+}
+
+void HostStart() {
+    if (check_period)
+        RegisterTask("Check", check_task, PRIORITY_HIGH, 256);
+}
+
+// Returns false if the check failed. Compares up to the last wakeup, since the
+// systick doesn't catch up with a tickless sleep until it ends.
+static bool check_report() {
+    systick_t ticks = check_last_tick - check_start_tick;
+    uint32 t1 = check_last_t1 - check_start_t1;
+    bool ok;
+
+    // Systick is counted from Timer1, so it should be exactly the SOSC clocks / counts per tick
+    uint64_t sosc = (uint64_t)((unsigned __int128)(check_last_time - check_start_time) * SOSC / FCY);
+    long expected_ticks = (long)(sosc / SYSTICK_TMR_COUNTS);
+    long drift = (long)ticks - expected_ticks;
+
+    // Timer1 shouldn't interrupt on every systick either, unless USB is
+    // connected (its frames wake the CPU every ms)
+    ok = check_wakeups > 0 && check_late == 0 &&
+         check_wakeups == ticks / check_period &&
+         drift >= -1 && drift <= 1 &&
+         (host_vbus || t1 < ticks / TICKLESS_MIN_TICKS);
+
+    fprintf(host_report, "Tickless check: %lu wakeups every %u ms (%lu late), systick %lu of %ld from Timer1, "
+            "%lu Timer1 interrupts: %s\n",
+            (unsigned long)check_wakeups, check_period, (unsigned long)check_late,
+            (unsigned long)ticks, expected_ticks, (unsigned long)t1, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+static void report() {
+    cpu_stats_t stats;
+    imfont_cache_stats_t glyphs;
+    gfx_stats_t gfx;
+    uint i;
+
+    KernelGetStats(&stats);
+
+    fprintf(host_report, "\n");
+    fprintf(host_report, "Virtual time: %.3f ms, systick %lu\n", HostCyclesToMs(HostTime()), (unsigned long)systick);
+    fprintf(host_report, "CPU (last window): %u.%u%% busy, %u.%u%% idle, %u.%u%% sleep\n",
+            stats.cpu_usage / 10, stats.cpu_usage % 10,
+            stats.idle_usage / 10, stats.idle_usage % 10,
+            stats.sleep_usage / 10, stats.sleep_usage % 10);
+
+    fprintf(host_report, "%-8s %4s %10s %6s %8s %8s %8s %8s\n",
+            "Task", "Pri", "Cycles", "CPU%", "Switches", "Overruns", "JitMax", "JitAvg");
+    for (i=0; i<num_tasks; i++) {
+        task_t* task = &tasks[i];
+        fprintf(host_report, "%-8s %4u %10lu %3u.%u%% %8u",
+                task->name, task->priority, (unsigned long)task->cpu_cycles,
+                task->cpu_usage / 10, task->cpu_usage % 10, task->cpu_ticks);
+        if (task->period)
+            fprintf(host_report, " %8u %6uus %6uus", task->overruns, task->jitter_max, task->jitter_avg);
+        fprintf(host_report, "\n");
+    }
+
+    HostDisplayReport();
+
+    ImFontGetCacheStats(&glyphs);
+    fprintf(host_report, "Glyph cache: %u glyphs, %u words, %lu hits, %lu misses, %lu evictions\n",
+            glyphs.entries, glyphs.words_used,
+            (unsigned long)glyphs.hits, (unsigned long)glyphs.misses, (unsigned long)glyphs.evictions);
+
+    GetGfxStats(&gfx);
+    if (gfx.frames) {
+        fprintf(host_report, "Graphics: %lu frames, %.0f pixels drawn/frame\n",
+                (unsigned long)gfx.frames, (double)gfx.pixels / gfx.frames);
+        fprintf(host_report, "Transfer: %.0f cycles/frame (model estimate)\n",
+                (double)HostDisplayTransferCycles() / gfx.frames);
+#ifdef GFX_DISPLAY_LIST
+        fprintf(host_report, "Display list: %.1f commands/frame, %.1f replayed/frame, %.1f bands/frame, "
+                "max %u of %u, %lu overflows\n",
+                (double)gfx.commands / gfx.frames, (double)gfx.replayed / gfx.frames,
+                (double)gfx.bands / gfx.frames, gfx.max_commands, DISPLAY_LIST_SIZE,
+                (unsigned long)gfx.overflows);
+#endif
+    }
+    HostUsbReport();
+}
+
+void HostExit(int status) {
+    report();
+
+    if (check_period && !check_report() && status == 0)
+        status = 1;
+
+    if (screenshot_file != NULL && !HostDisplayWritePPM(screenshot_file)) {
+        fprintf(stderr, "host: can't write %s\n", screenshot_file);
+        status = 1;
+    }
+
+    if (host_usb_out != NULL)
+        fclose(host_usb_out);
+
+    fflush(host_report);
+    exit(status);
+}
+
+void HostReset() {
+    fprintf(stderr, "host: firmware reset\n");
+    HostExit(1);
+}
+
+void HostCriticalError(const char* msg, const char* task_name) {
+    fprintf(stderr, "host: critical error: %s (task %s)\n", msg, task_name ? task_name : "-");
+    HostExit(1);
+}
+
+int main(int argc, char** argv) {
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:b:ui:o:a:l:s:p:c:vh")) != -1) {
+        switch (opt) {
+            case 't':
+                host_options.run_time = HostMsToCycles(atol(optarg));
+                break;
+
+            case 'b': {
+                int btn = 0, duration = 100;
+                long at = 0;
+                if (sscanf(optarg, "%d@%ld+%d", &btn, &at, &duration) < 2 || btn < 1 || btn > 4)
+                    usage();
+                HostSchedule(HostMsToCycles(at), press, btn);
+                HostSchedule(HostMsToCycles(at + duration), release, btn);
+                break;
+            }
+
+            case 'u':
+                host_vbus = true;
+                break;
+
+            case 'i':
+                if ((host_usb_in = fopen(optarg, "rb")) == NULL) {
+                    perror(optarg);
+                    return 1;
+                }
+                break;
+
+            case 'o':
+                if ((host_usb_out = fopen(optarg, "wb")) == NULL) {
+                    perror(optarg);
+                    return 1;
+                }
+                break;
+
+            case 'a': {
+                int x, y, z;
+                if (sscanf(optarg, "%d,%d,%d", &x, &y, &z) != 3)
+                    usage();
+                HostAccelSet(x, y, z);
+                break;
+            }
+
+            case 'l':
+                HostAnalogSet(AN_LIGHT, atoi(optarg));
+                break;
+
+            case 's':
+                screenshot_file = optarg;
+                break;
+
+            case 'p':
+                host_options.cpu_scale = atof(optarg);
+                break;
+
+            case 'c':
+                check_period = atoi(optarg);
+                break;
+
+            case 'v':
+                host_options.verbose = true;
+                break;
+
+            default:
+                usage();
+        }
+    }
+
+    // The charger reports charging while plugged in (STAT1 low)
+    _PORT(PW_STAT1) = !host_vbus;
+    _PORT(PW_STAT2) = 1;
+
+    // The firmware's printf goes to stdout, so the report needs its own copy
+    host_report = fdopen(dup(STDOUT_FILENO), "w");
+    if (!host_options.verbose && freopen("/dev/null", "w", stdout) == NULL)
+        return 1;
+
+    zeitgeber_main();
+
+    // KernelStart() never returns
+    return 1;
+}
@@ -0,0 +1,27 @@
+/*
+ * File:   GenericTypeDefs.h
+ * Author: Jared
+ *
+ * Host stand-in for the Microchip type definitions (see posix/p24_host.h)
+ */
+
+#ifndef GENERIC_TYPE_DEFS_H
+#define	GENERIC_TYPE_DEFS_H
+
+#include <stdint.h>
+
+typedef enum { FALSE = 0, TRUE } BOOL;
+
+typedef unsigned char BYTE;
+typedef unsigned short WORD;
+typedef uint32_t DWORD;
+
+typedef unsigned short UINT;
+typedef uint8_t UINT8;
+typedef uint16_t UINT16;
+typedef uint32_t UINT32;
+typedef int8_t INT8;
+typedef int16_t INT16;
+typedef int32_t INT32;
+
+#endif	/* GENERIC_TYPE_DEFS_H */
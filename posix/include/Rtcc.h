@@ -0,0 +1,60 @@
+/*
+ * File:   Rtcc.h
+ * Author: Jared
+ *
+ * Host stand-in for the PIC24 RTCC peripheral library header.
+ * The clock runs from virtual time (see posix/rtcc.c), all fields are BCD.
+ */
+
+#ifndef RTCC_H
+#define	RTCC_H
+
+#include <GenericTypeDefs.h>
+
+typedef union {
+    struct {
+        unsigned char rsvd;
+        unsigned char sec;
+        unsigned char min;
+        unsigned char hour;
+    } f;
+    unsigned char b[4];
+    unsigned short w[2];
+    UINT32 l;
+} rtccTime;
+
+typedef union {
+    struct {
+        unsigned char wday;
+        unsigned char mday;
+        unsigned char mon;
+        unsigned char year;
+    } f;
+    unsigned char b[4];
+    unsigned short w[2];
+    UINT32 l;
+} rtccDate;
+
+typedef union {
+    struct {
+        unsigned char year;
+        unsigned char rsvd;
+        unsigned char mday;
+        unsigned char mon;
+        unsigned char hour;
+        unsigned char wday;
+        unsigned char sec;
+        unsigned char min;
+    } f;
+    unsigned char b[8];
+    unsigned short w[4];
+    UINT32 l[2];
+} rtccTimeDate;
+
+void RtccReadTime(rtccTime* pTm);
+void RtccReadDate(rtccDate* pDt);
+void RtccReadTimeDate(rtccTimeDate* pTD);
+BOOL RtccWriteTime(const rtccTime* pTm, BOOL di);
+BOOL RtccWriteDate(const rtccDate* pDt, BOOL di);
+
+#endif	/* RTCC_H */
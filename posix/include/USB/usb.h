@@ -0,0 +1,15 @@
+/*
+ * File:   USB/usb.h
+ * Author: Jared
+ *
+ * Host stand-in for the Microchip USB stack header.
+ * The stack is replaced by posix/drivers/usb.c, which only implements
+ * the interface in drivers/usb/usb.h.
+ */
+
+#ifndef HOST_USB_H
+#define	HOST_USB_H
+
+#include <GenericTypeDefs.h>
+
+#endif	/* HOST_USB_H */
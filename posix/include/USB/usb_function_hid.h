@@ -0,0 +1,13 @@
+/*
+ * File:   USB/usb_function_hid.h
+ * Author: Jared
+ *
+ * Host stand-in for the Microchip USB HID function header (see USB/usb.h)
+ */
+
+#ifndef HOST_USB_FUNCTION_HID_H
+#define	HOST_USB_FUNCTION_HID_H
+
+#include "USB/usb.h"
+
+#endif	/* HOST_USB_FUNCTION_HID_H */
@@ -0,0 +1,10 @@
+/*
+ * File:   gui/Wallpapers/hackaday_thp.h
+ * Author: Jared
+ *
+ * Placeholder for the test app's wallpaper, which is not checked in.
+ * A blank 128x128 image, so the test app can be built on the host.
+ */
+
+static uint16 hackaday_thp_bytes[128*128];
+const image_t img_hackaday_thp = {hackaday_thp_bytes, 128, 128};
@@ -0,0 +1,24 @@
+/*
+ * File:   timer.h
+ * Author: Jared
+ *
+ * Host stand-in for the PIC24 timer peripheral library header.
+ * Only the Timer1 configuration bits used by the kernel are defined.
+ */
+
+#ifndef TIMER_H
+#define	TIMER_H
+
+#define T1_OFF              0x0000
+#define T1_ON               0x8000
+#define T1_IDLE_CON         0x0000
+#define T1_GATE_OFF         0x0000
+#define T1_PS_1_1           0x0000
+#define T1_PS_1_8           0x0010
+#define T1_PS_1_64          0x0020
+#define T1_PS_1_256         0x0030
+#define T1_SYNC_EXT_OFF     0x0000
+#define T1_SOURCE_EXT       0x0002
+#define T1_SOURCE_INT       0x0000
+
+#endif	/* TIMER_H */
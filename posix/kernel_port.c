@@ -0,0 +1,378 @@
+/*
+ * File:   kernel_port.c
+ * Author: Jared
+ *
+ * Host port of the kernel core (replaces core/kernel_asm.s),
+ * and the simulated CPU it runs on.
+ *
+ * Each task runs on its own ucontext, so the scheduler in core/kernel.c is
+ * used unmodified. Time is virtual: it only advances by the cycle costs in
+ * host.h, the cycles charged by the simulated peripherals, and by skipping
+ * ahead to the next event when the firmware goes to Sleep/Idle.
+ * The same build and inputs always produce the same run.
+ *
+ * Interrupts can only be taken at the points where the firmware talks to the
+ * hardware (SFR accesses, ClrWdt(), changing the CPU priority), so a task
+ * that spins without touching the hardware will never be pre-empted.
+ */
+
+#define _XOPEN_SOURCE 700
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include <ucontext.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "posix/host.h"
+
+////////// Defines /////////////////////////////////////////////////////////////
+
+#define MAX_HOST_EVENTS 64
+
+typedef struct {
+    host_time_t time;
+    host_event_t proc;
+    int param;
+} host_event_info_t;
+
+////////// Variables ///////////////////////////////////////////////////////////
+
+host_sfr_t host_sfr;
+volatile host_sr_t SRbits;
+
+extern task_t tasks[];
+extern task_t* current_task;
+
+// kernel.c
+extern void KernelSwitchTask();
+void KernelSwitchContext();
+
+static ucontext_t task_context[MAX_TASKS];
+
+static host_time_t host_time = 0;   // Virtual time (instruction cycles)
+static uint64_t sosc_count = 0;     // SOSC clocks up to host_time (Timer1)
+static uint32 cycle_counter = 0;    // Timer2/3
+static uint16 shadow_tmr2 = 0;      // Detects writes to TMR2/TMR3
+static uint16 shadow_tmr3 = 0;
+static bool cpu_sleeping = false;   // Instruction clock stopped (Sleep mode)
+static uint isr_depth = 0;          // Interrupt handlers running on this stack
+static bool run_ended = false;
+static uint32 t1_interrupts = 0;
+
+// Pending events, sorted by time
+static host_event_info_t events[MAX_HOST_EVENTS];
+static uint num_events = 0;
+
+static struct timespec cpu_last;    // Host CPU time already charged (cpu_scale)
+
+////////// Prototypes //////////////////////////////////////////////////////////
+
+static void dispatch();
+
+////////// Virtual Time ////////////////////////////////////////////////////////
+
+host_time_t HostTime() {
+    return host_time;
+}
+
+// SOSC clocks elapsed at a virtual time
+static uint64_t time_to_sosc(host_time_t time) {
+    return (uint64_t)((unsigned __int128)time * SOSC / FCY);
+}
+
+// First virtual time at which the SOSC count reaches 'count'
+static host_time_t sosc_to_time(uint64_t count) {
+    return (host_time_t)(((unsigned __int128)count * FCY + SOSC - 1) / SOSC);
+}
+
+// Timer1 counts until it next matches PR1 and sets T1IF
+static uint32 t1_counts_to_match() {
+    if (host_sfr.tmr1 <= host_sfr.pr1)
+        return host_sfr.pr1 - host_sfr.tmr1 + 1;
+    else
+        return 0x10000 - host_sfr.tmr1 + host_sfr.pr1 + 1; // Runs past PR1 and wraps
+}
+
+static void t1_count(uint64_t counts) {
+    uint32 period = (uint32)host_sfr.pr1 + 1;
+
+    while (counts) {
+        uint32 to_match = t1_counts_to_match();
+        if (counts < to_match) {
+            host_sfr.tmr1 += counts;
+            return;
+        }
+
+        counts -= to_match;
+        host_sfr.tmr1 = 0;
+        host_sfr.t1if = 1;
+
+        // Whole periods don't change anything
+        counts %= period;
+    }
+}
+
+// Move the peripherals forward to 'time' (no events or interrupts)
+static void advance_to(host_time_t time) {
+    if (time <= host_time)
+        return;
+
+    uint64_t sosc = time_to_sosc(time);
+    if (host_sfr.t1conbits.TON)
+        t1_count(sosc - sosc_count);
+    sosc_count = sosc;
+
+    // The cycle counter is clocked from FCY, so it stops in Sleep mode
+    if (host_sfr.t2conbits.TON && !cpu_sleeping)
+        cycle_counter += (uint32)(time - host_time);
+
+    host_time = time;
+}
+
+// Advance virtual time, running any events that are due on the way
+static void advance(host_time_t cycles) {
+    host_time_t target = host_time + cycles;
+
+    if (target > host_options.run_time)
+        target = host_options.run_time;
+
+    while (num_events && events[0].time <= target) {
+        host_event_info_t event = events[0];
+        uint i;
+
+        for (i=1; i<num_events; i++)
+            events[i-1] = events[i];
+        num_events--;
+
+        advance_to(event.time);
+        event.proc(event.param);
+    }
+
+    advance_to(target);
+
+    // The report calls back into the kernel, which mustn't end the run again
+    if (host_time >= host_options.run_time && !run_ended) {
+        run_ended = true;
+        HostExit(0);
+    }
+}
+
+// Charge the host CPU time used since the last call (only if cpu_scale is set)
+static void charge_host_cpu() {
+    struct timespec now;
+    int64_t ns;
+
+    if (host_options.cpu_scale <= 0)
+        return;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    ns = (int64_t)(now.tv_sec - cpu_last.tv_sec) * 1000000000 + (now.tv_nsec - cpu_last.tv_nsec);
+    cpu_last = now;
+
+    if (ns > 0)
+        advance((host_time_t)(ns * host_options.cpu_scale));
+}
+
+void HostSchedule(host_time_t time, host_event_t proc, int param) {
+    uint i;
+
+    if (num_events == MAX_HOST_EVENTS) {
+        fprintf(stderr, "host: too many pending events\n");
+        HostExit(1);
+    }
+
+    // Events at the same time run in the order they were scheduled
+    i = num_events++;
+    while (i > 0 && events[i-1].time > time) {
+        events[i] = events[i-1];
+        i--;
+    }
+
+    events[i].time = time;
+    events[i].proc = proc;
+    events[i].param = param;
+}
+
+// Time of the next Timer1 match or event, whichever is first (at most 'limit')
+static host_time_t next_wake(host_time_t limit) {
+    host_time_t wake = limit;
+
+    if (host_sfr.t1conbits.TON && host_sfr.t1ie) {
+        host_time_t match = sosc_to_time(sosc_count + t1_counts_to_match());
+        if (match < wake) wake = match;
+    }
+    if (num_events && events[0].time < wake)
+        wake = events[0].time;
+
+    return wake > host_time ? wake : host_time;
+}
+
+void HostCharge(uint32 cycles) {
+    host_time_t end;
+
+    charge_host_cpu();
+
+    // Long operations can be interrupted part way through, like on the PIC
+    end = host_time + cycles;
+    do {
+        advance(next_wake(end) - host_time);
+        dispatch();
+    } while (host_time < end);
+}
+
+host_sfr_t* HostSync() {
+    // Pick up any writes to the cycle counter since the last access
+    if (host_sfr.tmr2 != shadow_tmr2 || host_sfr.tmr3 != shadow_tmr3)
+        cycle_counter = ((uint32)host_sfr.tmr3 << 16) | host_sfr.tmr2;
+
+    charge_host_cpu();
+    advance(HOST_ACCESS_CYCLES);
+
+    // Reading TMR2 latches the upper word into TMR3HLD
+    host_sfr.tmr2 = shadow_tmr2 = (uint16)cycle_counter;
+    host_sfr.tmr3 = shadow_tmr3 = (uint16)(cycle_counter >> 16);
+    host_sfr.tmr3hld = shadow_tmr3;
+
+    dispatch();
+    return &host_sfr;
+}
+
+void HostPoll() {
+    HostCharge(HOST_ACCESS_CYCLES);
+}
+
+////////// Interrupts //////////////////////////////////////////////////////////
+
+static void T1Interrupt() {
+    // Same as __T1Interrupt in kernel_asm.s
+    host_sfr.t1if = 0;
+    host_sfr.pr1 = SYSTICK_TMR_PERIOD;
+    t1_interrupts++;
+    IncSystick();
+    KernelSwitchContext();
+}
+
+// Highest priority interrupt that is requested and enabled, or 0 if none
+static uint pending(proc_t* handler) {
+    uint best = 0;
+
+    #define CHECK(src, proc) \
+        if (host_sfr.src##if && host_sfr.src##ie && host_sfr.src##ip > best) { \
+            best = host_sfr.src##ip; *handler = proc; }
+
+    CHECK(t1, T1Interrupt);
+    CHECK(cn, _CNInterrupt);
+    CHECK(ad1, _ADC1Interrupt);
+    CHECK(usb1, _USB1Interrupt);
+
+    #undef CHECK
+    return best;
+}
+
+// Run any interrupts with a priority above the CPU priority
+static void dispatch() {
+    proc_t handler;
+    uint priority;
+
+    while (pending(&handler) > SRbits.IPL) {
+        uint ipl = SRbits.IPL;
+
+        // An event during the entry latency can dispatch the interrupt itself,
+        // so pick the handler again after it (or it would run twice)
+        advance(HOST_ISR_CYCLES);
+        priority = pending(&handler);
+        if (priority <= ipl)
+            continue;
+
+        SRbits.IPL = priority;
+        isr_depth++;
+        handler();
+        isr_depth--;
+        SRbits.IPL = ipl;
+    }
+}
+
+void HostSetIPL(uint ipl) {
+    uint old = SRbits.IPL;
+    SRbits.IPL = ipl;
+
+    if (ipl < old) {
+        charge_host_cpu();
+        dispatch();
+    }
+}
+
+void HostPowerSave(bool sleep) {
+    proc_t handler;
+
+    charge_host_cpu();
+
+    // Wake up on any enabled interrupt, even if its priority is masked
+    cpu_sleeping = sleep;
+    while (!pending(&handler))
+        advance(next_wake(host_options.run_time) - host_time);
+    cpu_sleeping = false;
+
+    dispatch();
+}
+
+////////// Kernel Core /////////////////////////////////////////////////////////
+
+static void task_entry() {
+    // Tasks always start at IPL 0 (see KernelInitTaskStack in kernel_asm.s)
+    HostSetIPL(0);
+    current_task->proc();
+
+    fprintf(stderr, "host: task '%s' returned\n", current_task->name);
+    HostExit(1);
+}
+
+void KernelInitTaskStack(task_t* task, task_proc_t proc) {
+    ucontext_t* context = &task_context[task - tasks];
+
+    getcontext(context);
+    context->uc_stack.ss_sp = malloc(HOST_STACK_SIZE);
+    context->uc_stack.ss_size = HOST_STACK_SIZE;
+    context->uc_link = NULL;
+    if (context->uc_stack.ss_sp == NULL) {
+        fprintf(stderr, "host: out of memory\n");
+        exit(1);
+    }
+
+    // The task proc is taken from current_task when it first runs
+    makecontext(context, task_entry, 0);
+}
+
+uint32 HostTimerInterrupts() {
+    return t1_interrupts;
+}
+
+void KernelStartTask(task_t* task) {
+    HostStart();
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_last);
+    SRbits.IPL = 7;
+    setcontext(&task_context[task - tasks]);
+}
+
+void KernelSwitchContext() {
+    task_t* task = current_task;
+
+    // Interrupts are disabled for the whole switch (disi in kernel_asm.s)
+    SRbits.IPL = 7;
+    charge_host_cpu();
+    advance(HOST_SWITCH_CYCLES);
+
+    KernelSwitchTask();
+
+    if (current_task != task)
+        swapcontext(&task_context[task - tasks], &task_context[current_task - tasks]);
+
+    // Back in the task (possibly much later). Like retfie, this restores IPL 0,
+    // and any interrupts that arrived in the meantime are taken now. From the
+    // T1 interrupt, that is left to the dispatch loop so the ISRs don't nest.
+    SRbits.IPL = 0;
+    if (isr_depth == 0)
+        dispatch();
+}
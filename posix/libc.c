@@ -0,0 +1,38 @@
+/*
+ * File:   libc.c
+ * Author: Jared
+ *
+ * Functions from the XC16 C library that glibc doesn't have.
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include "system.h"
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+char* utoa(char* buf, unsigned val, int base) {
+    char tmp[8 * sizeof(unsigned) + 1];
+    char* s = tmp;
+    char* d = buf;
+
+    do {
+        uint digit = val % base;
+        *s++ = digit < 10 ? '0' + digit : 'a' + digit - 10;
+        val /= base;
+    } while (val);
+
+    while (s != tmp)
+        *d++ = *--s;
+    *d = '\0';
+    return buf;
+}
+
+char* itoa(char* buf, int val, int base) {
+    if (val < 0 && base == 10) {
+        buf[0] = '-';
+        utoa(buf + 1, -(unsigned)val, base);
+        return buf;
+    }
+    return utoa(buf, val, base);
+}
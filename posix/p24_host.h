@@ -0,0 +1,344 @@
+/*
+ * File:   p24_host.h
+ * Author: Jared
+ *
+ * Stand-ins for the PIC24FJ256DA206 registers and compiler intrinsics,
+ * so the firmware can be built as a Linux executable (see posix/README.md).
+ *
+ * Most registers are just memory. Registers that are driven by virtual time
+ * (Timer1, the Timer2/3 cycle counter and the interrupt flags) are accessed
+ * through HostSync(), which brings the simulated peripherals up to date first.
+ */
+
+#ifndef P24_HOST_H
+#define	P24_HOST_H
+
+#include <GenericTypeDefs.h>
+
+////////// Compiler Intrinsics /////////////////////////////////////////////////
+
+#define __eds__
+#define __prog__
+#define __psv__
+#define __near
+#define __far
+
+#define Nop()
+#define ClrWdt()        HostPoll()
+#define Sleep()         HostPowerSave(true)
+#define Idle()          HostPowerSave(false)
+#define Reset()         HostReset()
+
+// Find first one from the left (MSB is 1), 0 if no bits are set
+#define __builtin_ff1l(x)   ((uint16)(x) ? __builtin_clz((uint16)(x)) - 15 : 0)
+#define __builtin_ff1r(x)   __builtin_ffs((uint16)(x))
+#define __builtin_btg(p, bit) (*(volatile uint16*)(p) ^= (1 << (bit)))
+
+// XC16 libc extensions (see libc.c)
+char* itoa(char* buf, int val, int base);
+char* utoa(char* buf, unsigned val, int base);
+
+////////// CPU Priority ////////////////////////////////////////////////////////
+
+typedef struct {
+    unsigned C:1;
+    unsigned Z:1;
+    unsigned OV:1;
+    unsigned N:1;
+    unsigned RA:1;
+    unsigned IPL:3;
+    unsigned DC:1;
+} host_sr_t;
+extern volatile host_sr_t SRbits;
+
+// Changing the CPU priority services any interrupts that are no longer masked
+#define SET_CPU_IPL(ipl)                HostSetIPL(ipl)
+#define SET_AND_SAVE_CPU_IPL(save, ipl) do { (save) = SRbits.IPL; HostSetIPL(ipl); } while (0)
+#define RESTORE_CPU_IPL(save)           HostSetIPL(save)
+
+////////// Virtual Time Peripherals ////////////////////////////////////////////
+
+typedef struct {
+    unsigned TCS:1;
+    unsigned TSYNC:1;
+    unsigned :1;
+    unsigned T32:1;
+    unsigned TCKPS:2;
+    unsigned TGATE:1;
+    unsigned :6;
+    unsigned TSIDL:1;
+    unsigned :1;
+    unsigned TON:1;
+} host_tcon_t;
+
+typedef struct {
+    // Timer1 (systick), clocked from the 32.768kHz SOSC
+    uint16 tmr1;
+    uint16 pr1;
+    union { uint16 t1con; host_tcon_t t1conbits; };
+
+    // Timer2/3 (32-bit instruction cycle counter)
+    uint16 tmr2;
+    uint16 tmr3;
+    uint16 tmr3hld;
+    uint16 pr2;
+    uint16 pr3;
+    union { uint16 t2con; host_tcon_t t2conbits; };
+    union { uint16 t3con; host_tcon_t t3conbits; };
+
+    // Interrupt flags, enables and priorities of the emulated sources
+    unsigned t1if:1, t1ie:1, t1ip:3;
+    unsigned cnif:1, cnie:1, cnip:3;
+    unsigned ad1if:1, ad1ie:1, ad1ip:3;
+    unsigned usb1if:1, usb1ie:1, usb1ip:3;
+} host_sfr_t;
+
+extern host_sfr_t host_sfr;
+extern host_sfr_t* HostSync();
+
+#define TMR1        (HostSync()->tmr1)
+#define PR1         (HostSync()->pr1)
+#define T1CON       (HostSync()->t1con)
+#define T1CONbits   (HostSync()->t1conbits)
+#define TMR2        (HostSync()->tmr2)
+#define TMR3        (HostSync()->tmr3)
+#define TMR3HLD     (host_sfr.tmr3hld)    // Latched when TMR2 is read
+#define PR2         (HostSync()->pr2)
+#define PR3         (HostSync()->pr3)
+#define T2CON       (HostSync()->t2con)
+#define T2CONbits   (HostSync()->t2conbits)
+#define T3CON       (HostSync()->t3con)
+#define T3CONbits   (HostSync()->t3conbits)
+
+#define _T1IF       (HostSync()->t1if)
+#define _T1IE       (HostSync()->t1ie)
+#define _T1IP       (HostSync()->t1ip)
+#define _CNIF       (HostSync()->cnif)
+#define _CNIE       (HostSync()->cnie)
+#define _CNIP       (HostSync()->cnip)
+#define _AD1IF      (HostSync()->ad1if)
+#define _AD1IE      (HostSync()->ad1ie)
+#define _AD1IP      (HostSync()->ad1ip)
+#define _USB1IF     (HostSync()->usb1if)
+#define _USB1IE     (HostSync()->usb1ie)
+#define _USB1IP     (HostSync()->usb1ip)
+
+////////// GPIO ////////////////////////////////////////////////////////////////
+
+#define HOST_BITS16(prefix) \
+    unsigned prefix##0:1; unsigned prefix##1:1; unsigned prefix##2:1; unsigned prefix##3:1; \
+    unsigned prefix##4:1; unsigned prefix##5:1; unsigned prefix##6:1; unsigned prefix##7:1; \
+    unsigned prefix##8:1; unsigned prefix##9:1; unsigned prefix##10:1; unsigned prefix##11:1; \
+    unsigned prefix##12:1; unsigned prefix##13:1; unsigned prefix##14:1; unsigned prefix##15:1;
+
+// TRISx/PORTx/LATx/ODCx/ANSx for each port, with the same bit names as XC16
+#define HOST_PORT(x) \
+    typedef union { volatile uint16 w; struct { HOST_BITS16(TRIS##x) }; } host_tris##x##_t; \
+    typedef union { volatile uint16 w; struct { HOST_BITS16(R##x) }; } host_port##x##_t; \
+    typedef union { volatile uint16 w; struct { HOST_BITS16(LAT##x) }; } host_lat##x##_t; \
+    typedef union { volatile uint16 w; struct { HOST_BITS16(ODC##x) }; } host_odc##x##_t; \
+    typedef union { volatile uint16 w; struct { HOST_BITS16(ANS##x) }; } host_ans##x##_t; \
+    extern host_tris##x##_t host_tris##x; \
+    extern host_port##x##_t host_port##x; \
+    extern host_lat##x##_t host_lat##x; \
+    extern host_odc##x##_t host_odc##x; \
+    extern host_ans##x##_t host_ans##x;
+
+HOST_PORT(B)
+HOST_PORT(C)
+HOST_PORT(D)
+HOST_PORT(E)
+HOST_PORT(F)
+HOST_PORT(G)
+
+#define TRISB host_trisB.w
+#define TRISC host_trisC.w
+#define TRISD host_trisD.w
+#define TRISE host_trisE.w
+#define TRISF host_trisF.w
+#define TRISG host_trisG.w
+#define TRISBbits host_trisB
+#define TRISCbits host_trisC
+#define TRISDbits host_trisD
+#define TRISEbits host_trisE
+#define TRISFbits host_trisF
+#define TRISGbits host_trisG
+
+#define PORTB host_portB.w
+#define PORTC host_portC.w
+#define PORTD host_portD.w
+#define PORTE host_portE.w
+#define PORTF host_portF.w
+#define PORTG host_portG.w
+#define PORTBbits host_portB
+#define PORTCbits host_portC
+#define PORTDbits host_portD
+#define PORTEbits host_portE
+#define PORTFbits host_portF
+#define PORTGbits host_portG
+
+#define LATB host_latB.w
+#define LATC host_latC.w
+#define LATD host_latD.w
+#define LATE host_latE.w
+#define LATF host_latF.w
+#define LATG host_latG.w
+#define LATBbits host_latB
+#define LATCbits host_latC
+#define LATDbits host_latD
+#define LATEbits host_latE
+#define LATFbits host_latF
+#define LATGbits host_latG
+
+#define ODCBbits host_odcB
+#define ODCDbits host_odcD
+#define ODCEbits host_odcE
+#define ODCFbits host_odcF
+#define ODCGbits host_odcG
+
+#define ANSB host_ansB.w
+#define ANSC host_ansC.w
+#define ANSD host_ansD.w
+#define ANSF host_ansF.w
+#define ANSG host_ansG.w
+#define ANSBbits host_ansB
+
+#define NUM_HOST_CN 84
+
+// Pin change notification enables/pull-ups, indexed by CN number
+extern volatile uint8 host_cnie[NUM_HOST_CN];
+extern volatile uint8 host_cnpue[NUM_HOST_CN];
+extern volatile uint8 host_cnpde[NUM_HOST_CN];
+
+// CN pins used in hardware.h
+#define _CN11IE   host_cnie[11]
+#define _CN11PUE  host_cnpue[11]
+#define _CN11PDE  host_cnpde[11]
+#define _CN17IE   host_cnie[17]
+#define _CN17PUE  host_cnpue[17]
+#define _CN17PDE  host_cnpde[17]
+#define _CN18IE   host_cnie[18]
+#define _CN18PUE  host_cnpue[18]
+#define _CN18PDE  host_cnpde[18]
+#define _CN28IE   host_cnie[28]
+#define _CN28PUE  host_cnpue[28]
+#define _CN28PDE  host_cnpde[28]
+#define _CN30IE   host_cnie[30]
+#define _CN30PUE  host_cnpue[30]
+#define _CN30PDE  host_cnpde[30]
+#define _CN31IE   host_cnie[31]
+#define _CN31PUE  host_cnpue[31]
+#define _CN31PDE  host_cnpde[31]
+#define _CN32IE   host_cnie[32]
+#define _CN32PUE  host_cnpue[32]
+#define _CN32PDE  host_cnpde[32]
+#define _CN56IE   host_cnie[56]
+#define _CN56PUE  host_cnpue[56]
+#define _CN56PDE  host_cnpde[56]
+#define _CN63IE   host_cnie[63]
+#define _CN63PUE  host_cnpue[63]
+#define _CN63PDE  host_cnpde[63]
+#define _CN83IE   host_cnie[83]
+#define _CN83PUE  host_cnpue[83]
+#define _CN83PDE  host_cnpde[83]
+
+////////// Misc Registers //////////////////////////////////////////////////////
+
+typedef struct {
+    unsigned POR:1;
+    unsigned BOR:1;
+    unsigned IDLE:1;
+    unsigned SLEEP:1;
+    unsigned WDTO:1;
+    unsigned SWDTEN:1;
+    unsigned SWR:1;
+    unsigned EXTR:1;
+    unsigned VREGS:1;
+    unsigned CM:1;
+    unsigned :4;
+    unsigned IOPUWR:1;
+    unsigned TRAPR:1;
+} host_rcon_t;
+typedef union { volatile uint16 w; host_rcon_t bits; } host_rcon_reg_t;
+extern host_rcon_reg_t host_rcon;
+#define RCON        host_rcon.w
+#define RCONbits    host_rcon.bits
+
+#define _RCON_POR_MASK      0x0001
+#define _RCON_BOR_MASK      0x0002
+#define _RCON_WDTO_MASK     0x0010
+#define _RCON_SWR_MASK      0x0040
+#define _RCON_EXTR_MASK     0x0080
+#define _RCON_CM_MASK       0x0200
+#define _RCON_IOPUWR_MASK   0x4000
+#define _RCON_TRAPR_MASK    0x8000
+
+extern volatile uint16 PMD1, PMD2, PMD3, PMD4, PMD5, PMD6;
+extern volatile uint16 host_dummy;
+
+// Peripheral module disable bits and other single bit registers that
+// only need to hold a value
+#define _T1MD       host_dummy
+#define _T2MD       host_dummy
+#define _T3MD       host_dummy
+#define _USB1MD     host_dummy
+#define _RTCCMD     host_dummy
+#define _CPDIV      host_dummy
+
+extern volatile bool host_vbus;     // USB cable plugged in
+#define _SESVD      host_vbus
+
+// Oscillator and RTCC control, which have no effect on the host
+typedef struct {
+    unsigned PLLEN:1;
+    unsigned RCDIV:3;
+    unsigned CPDIV:2;
+} host_clkdiv_t;
+extern host_clkdiv_t CLKDIVbits;
+
+typedef struct {
+    unsigned SOSCEN:1;
+    unsigned LOCK:1;
+} host_osccon_t;
+extern host_osccon_t OSCCONbits;
+
+typedef struct {
+    unsigned CAL:8;
+    unsigned RTCPTR:2;
+    unsigned RTCOE:1;
+    unsigned HALFSEC:1;
+    unsigned RTCSYNC:1;
+    unsigned RTCWREN:1;
+    unsigned :1;
+    unsigned RTCEN:1;
+} host_rcfgcal_t;
+extern host_rcfgcal_t RCFGCALbits;
+
+#define _CAL        RCFGCALbits.CAL
+#define _RTCOE      RCFGCALbits.RTCOE
+#define _RTSECSEL   host_dummy
+#define _ALRMEN     host_dummy
+
+////////// Host Interface //////////////////////////////////////////////////////
+
+// Virtual time, in instruction cycles (FCY) since the firmware started
+typedef unsigned long long host_time_t;
+extern host_time_t HostTime();
+
+// Account for time the firmware would have spent on the real hardware
+// (eg. the emulated display bus charges the cycles of each port write)
+extern void HostCharge(uint32 cycles);
+
+// Run 'proc(param)' at the given virtual time, from the simulated hardware.
+// Events are how peripherals set their interrupt flags, or wake the CPU.
+typedef void (*host_event_t)(int param);
+extern void HostSchedule(host_time_t time, host_event_t proc, int param);
+
+extern void HostPoll();
+extern void HostSetIPL(uint ipl);
+extern void HostPowerSave(bool sleep);
+extern void HostReset();
+extern void HostCriticalError(const char* msg, const char* task_name);
+
+#endif	/* P24_HOST_H */
+
@@ -0,0 +1,154 @@
+/*
+ * File:   peripherals/adc.c
+ * Author: Jared
+ *
+ * Host version of the ADC driver (see peripherals/adc.c).
+ * Conversions read fixed input voltages (set with HostAnalogSet),
+ * and complete with an interrupt after the time they take on the PIC.
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include "posix/host.h"
+#include "peripherals/adc.h"
+#include "core/workqueue.h"
+#include "core/trace.h"
+
+////////// Defines /////////////////////////////////////////////////////////////
+
+#define VBG_VOLTAGE 1200UL  //mV - Bandgap reference voltage
+#define HOST_VDD    3300UL  //mV
+
+// Two conversions (channel and bandgap) of 31 TAD sampling + 12 TAD, TAD = 256 Tcy
+#define CONVERSION_CYCLES (2 * (31 + 12) * 256)
+
+////////// Global Variables ////////////////////////////////////////////////////
+
+volatile uint8 current_channel = 0;
+volatile adc_channel_t adc_channels[ADC_CHANNELS];
+volatile adc_status_t adc_status = adcDone;
+
+volatile voltage_t vdd = 0;
+
+////////// Local Variables /////////////////////////////////////////////////////
+
+static bool adc_enabled = false;
+
+// Channels waiting for the current conversion to finish (see _ADC1Interrupt)
+static uint32 pending_channels = 0;
+
+// Voltage at each input (mV). The battery is divided by 2 on the board.
+static uint host_analog[ADC_CHANNELS] = {
+    [AN_VBAT] = 3900 / 2,
+    [AN_LIGHT] = 1000,
+    [AN_VBG] = VBG_VOLTAGE,
+};
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+void HostAnalogSet(uint channel, uint millivolts) {
+    if (channel < ADC_CHANNELS)
+        host_analog[channel] = millivolts;
+}
+
+void adc_init() {
+    uint i;
+    for (i=0; i<ADC_CHANNELS; i++) {
+        adc_channels[i].callback = NULL;
+        adc_channels[i].voltage = 0;
+        adc_channels[i].abg = 0;
+        adc_channels[i].ach = 0;
+    }
+}
+
+void adc_enable() {
+    adc_enabled = true;
+    _AD1IF = 0;
+    _AD1IP = 4;
+    _AD1IE = 1;
+}
+
+void adc_disable() {
+    adc_enabled = false;
+}
+
+void adc_SetCallback(uint8 channel, adc_conversion_cb callback) {
+    adc_channels[channel].callback = callback;
+}
+
+static void adc_done(int param) {
+    _AD1IF = 1;
+}
+
+static void start_conversion(uint8 channel) {
+    current_channel = channel;
+    HostSchedule(HostTime() + CONVERSION_CYCLES, adc_done, 0);
+}
+
+void adc_StartConversion(uint8 channel) {
+    uint ipl;
+    SET_AND_SAVE_CPU_IPL(ipl, 7);
+
+    // Queue it behind the conversion in progress
+    if (mAdcBusy) {
+        pending_channels |= 1UL << channel;
+        RESTORE_CPU_IPL(ipl);
+        return;
+    }
+
+    if (!adc_enabled)
+        adc_enable();
+
+    adc_status = adcConverting;
+    start_conversion(channel);
+    RESTORE_CPU_IPL(ipl);
+}
+
+uint adc_Read(uint8 channel) {
+    adc_channels[channel].callback = NULL;
+    adc_StartConversion(channel);
+
+    while (mAdcBusy)
+        HostPowerSave(false);
+
+    return adc_channels[channel].voltage;
+}
+
+// Runs the channel's conversion callback from the work task (see _ADC1Interrupt)
+static void adc_dispatch(uint channel) {
+    volatile adc_channel_t* ch = &adc_channels[channel];
+    if (ch->callback != NULL) ch->callback(ch->voltage);
+}
+
+////////// Interrupts //////////////////////////////////////////////////////////
+
+void isr _ADC1Interrupt() {
+    _AD1IF = 0;
+    TraceISREnter(TRACE_ISR_ADC);
+
+    volatile adc_channel_t* ch = &adc_channels[current_channel];
+    ch->abg = VBG_VOLTAGE * 1024UL / HOST_VDD;
+    ch->ach = host_analog[current_channel] * 1024UL / HOST_VDD;
+
+    // Calibration (same as the PIC)
+    vdd = VBG_VOLTAGE * 1024UL / (unsigned long)ch->abg;
+    ch->voltage = (unsigned long)vdd * (unsigned long)ch->ach / 1024;
+
+    if (ch->callback != NULL) QueueWork(adc_dispatch, current_channel);
+
+    // Start the next queued conversion
+    if (pending_channels) {
+        uint8 next = 0;
+        while (!(pending_channels & (1UL << next)))
+            next++;
+        pending_channels &= ~(1UL << next);
+        start_conversion(next);
+
+        TraceISRExit(TRACE_ISR_ADC);
+        return;
+    }
+
+    adc_status = adcDone;
+
+    TraceISRExit(TRACE_ISR_ADC);
+}
@@ -0,0 +1,127 @@
+/*
+ * File:   peripherals/i2c.c
+ * Author: Jared
+ *
+ * Host version of the I2C master (see peripherals/i2c.c).
+ * Transactions go to a register model of the MMA7455 accelerometer,
+ * and each byte is charged the time it takes on the 100kHz bus.
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include "posix/host.h"
+#include "peripherals/i2c.h"
+
+////////// Defines /////////////////////////////////////////////////////////////
+
+#define BYTE_CYCLES (FCY / 100000 * 9)  // 8 data bits + ACK at 100kHz
+#define COND_CYCLES (FCY / 100000)      // Start/stop condition
+
+#define MMA7455_I2CADDR 0x1D
+#define MMA7455_WHOAMI  85
+#define MMA7455_REGS    0x20
+
+////////// Variables ///////////////////////////////////////////////////////////
+
+static uint8 accel_regs[MMA7455_REGS];
+
+static bool addressed;      // The next byte written is the device address
+static bool selected;       // The accelerometer is being addressed
+static bool reg_written;    // The register pointer has been set in this write
+static uint8 reg_ptr;
+
+// Acceleration in 1/64 g (8-bit 2g range)
+static int accel_x = 0, accel_y = 0, accel_z = 64;
+
+////////// Accelerometer Model /////////////////////////////////////////////////
+
+static void accel_update() {
+    // 10-bit outputs are 64 LSB/g in 8g mode, the 8-bit outputs depend on the range
+    uint range = accel_regs[0x16] & 0x0C;
+    int shift = (range == 0x04) ? 0 : (range == 0x08) ? 1 : 2; // 2g, 4g, 8g
+    int v[3] = {accel_x, accel_y, accel_z};
+    uint i;
+
+    for (i=0; i<3; i++) {
+        int v8 = v[i] >> shift;
+        int v10 = v[i];
+        if (v8 > 127) v8 = 127;
+        if (v8 < -128) v8 = -128;
+
+        accel_regs[i*2] = v10 & 0xFF;
+        accel_regs[i*2+1] = (v10 >> 8) & 0x03;
+        accel_regs[6+i] = (uint8)v8;
+    }
+
+    accel_regs[0x09] = 0x01; // DRDY
+    accel_regs[0x0D] = MMA7455_I2CADDR;
+    accel_regs[0x0F] = MMA7455_WHOAMI;
+}
+
+void HostAccelSet(int x, int y, int z) {
+    accel_x = x;
+    accel_y = y;
+    accel_z = z;
+}
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+void i2c_init() {
+    addressed = false;
+    selected = false;
+}
+
+void i2c_start() {
+    HostCharge(COND_CYCLES);
+    addressed = true;
+    reg_written = false;
+}
+
+void i2c_repeated_restart() {
+    i2c_start();
+}
+
+void i2c_stop() {
+    HostCharge(COND_CYCLES);
+    selected = false;
+}
+
+void i2c_ack() {
+}
+
+void i2c_nack() {
+}
+
+void i2c_write(uint8 data) {
+    HostCharge(BYTE_CYCLES);
+
+    if (addressed) {
+        addressed = false;
+        selected = (data >> 1) == MMA7455_I2CADDR;
+        return;
+    }
+    if (!selected)
+        return;
+
+    // The first byte written is the register, then data with auto-increment
+    if (!reg_written) {
+        reg_ptr = data % MMA7455_REGS;
+        reg_written = true;
+    } else {
+        accel_regs[reg_ptr] = data;
+        reg_ptr = (reg_ptr + 1) % MMA7455_REGS;
+    }
+}
+
+uint8 i2c_read() {
+    uint8 data;
+
+    HostCharge(BYTE_CYCLES);
+    if (!selected)
+        return 0xFF;
+
+    accel_update();
+    data = accel_regs[reg_ptr];
+    reg_ptr = (reg_ptr + 1) % MMA7455_REGS;
+    return data;
+}
@@ -0,0 +1,265 @@
+/*
+ * File:   peripherals/ssd1351p.c
+ * Author: Jared
+ *
+ * Host version of the SSD1351 parallel interface (see peripherals/ssd1351p.c).
+ * Instead of driving the data bus, each byte is fed to a model of the display
+ * controller, which keeps the display RAM so it can be saved as an image.
+ * Every bus write is charged the cycles it takes on the real hardware.
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include <stdarg.h>
+#include <stdio.h>
+#include "posix/host.h"
+#include "peripherals/ssd1351p.h"
+#include "util/util.h"
+
+////////// Defines /////////////////////////////////////////////////////////////
+
+// Cycles per byte written by ssd1351_write(), and per pixel in ssd1351_writeimgbuf().
+// These are model estimates counted from the C loops, not measured or checked against
+// an xc16 listing. A GFX_WIRE_ORDER buffer is assumed to save the two bitreverse[]
+// lookups per pixel, 3 instructions each. GFX_8BPP sends one byte per pixel.
+#define BUS_WRITE_CYCLES    24
+#if defined(GFX_8BPP) && defined(GFX_WIRE_ORDER)
+#define BUS_PIXEL_CYCLES    5
+#elif defined(GFX_8BPP)
+#define BUS_PIXEL_CYCLES    8
+#elif defined(GFX_WIRE_ORDER)
+#define BUS_PIXEL_CYCLES    10
+#else
+#define BUS_PIXEL_CYCLES    16
+#endif
+
+// Commands that the model understands (see drivers/ssd1351.c)
+#define CMD_SET_COLUMN_ADDR         0x15
+#define CMD_SET_ROW_ADDR            0x75
+#define CMD_WRITE_RAM               0x5C
+#define CMD_COLORDEPTH              0xA0
+#define CMD_DISPLAY_OFF             0xAE
+#define CMD_DISPLAY_ON              0xAF
+#define CMD_MASTER_CONTRAST         0xC7
+
+////////// Variables ///////////////////////////////////////////////////////////
+
+static struct {
+    uint16 ram[DISPLAY_WIDTH * DISPLAY_HEIGHT];
+
+    uint8 cmd;          // Last command
+    uint arg;           // Number of data bytes received since the command
+    uint8 hi;           // First byte of a pixel
+
+    uint8 col_start, col_end, col;
+    uint8 row_start, row_end, row;
+    bool vertical;      // Address increment mode (CMD_COLORDEPTH bit 0)
+    bool depth8;        // 256 colour mode, one byte per pixel (CMD_COLORDEPTH bits 7:6)
+
+    bool on;
+    uint8 contrast;
+    host_time_t on_time;        // Last turned on
+
+    // Statistics
+    uint32 commands;
+    uint32 bytes;
+    uint32 pixels;
+    uint32 transfer_cycles;     // Spent in ssd1351_writeimgbuf()
+} oled = {
+    .col_end = DISPLAY_WIDTH-1,
+    .row_end = DISPLAY_HEIGHT-1,
+    .contrast = 0x0F,
+};
+
+////////// Display Controller Model ////////////////////////////////////////////
+
+static void oled_pixel(uint16 c) {
+    oled.ram[oled.row * DISPLAY_WIDTH + oled.col] = c;
+    oled.pixels++;
+
+    // Wrap around within the window
+    if (oled.vertical) {
+        if (oled.row++ >= oled.row_end) {
+            oled.row = oled.row_start;
+            if (oled.col++ >= oled.col_end)
+                oled.col = oled.col_start;
+        }
+    } else {
+        if (oled.col++ >= oled.col_end) {
+            oled.col = oled.col_start;
+            if (oled.row++ >= oled.row_end)
+                oled.row = oled.row_start;
+        }
+    }
+}
+
+static void oled_command(uint8 cmd) {
+    oled.cmd = cmd;
+    oled.arg = 0;
+    oled.commands++;
+
+    switch (cmd) {
+        case CMD_WRITE_RAM:
+            oled.col = oled.col_start;
+            oled.row = oled.row_start;
+            break;
+        case CMD_DISPLAY_ON:
+            if (!oled.on)
+                oled.on_time = HostTime();
+            oled.on = true;
+            break;
+        case CMD_DISPLAY_OFF:
+            oled.on = false;
+            break;
+    }
+}
+
+static void oled_data(uint8 data) {
+    uint arg = oled.arg++;
+    oled.bytes++;
+
+    switch (oled.cmd) {
+        case CMD_SET_COLUMN_ADDR:
+            if (arg == 0) oled.col_start = data & 0x7F;
+            if (arg == 1) oled.col_end = data & 0x7F;
+            break;
+        case CMD_SET_ROW_ADDR:
+            if (arg == 0) oled.row_start = data & 0x7F;
+            if (arg == 1) oled.row_end = data & 0x7F;
+            break;
+        case CMD_WRITE_RAM:
+            if (oled.depth8) {
+                // RRRGGGBB, stored as RGB565 so the screenshot doesn't care
+                uint16 r = data >> 5, g = (data >> 2) & 7, b = data & 3;
+                oled_pixel((((r << 2) | (r >> 1)) << 11) | (((g << 3) | g) << 5) |
+                           ((b << 3) | (b << 1) | (b >> 1)));
+            } else if (arg & 1)
+                oled_pixel(((uint16)oled.hi << 8) | data);
+            else
+                oled.hi = data;
+            break;
+        case CMD_COLORDEPTH:
+            oled.vertical = data & 1;
+            oled.depth8 = (data & 0xC0) == 0;
+            break;
+        case CMD_MASTER_CONTRAST:
+            oled.contrast = data & 0x0F;
+            break;
+    }
+}
+
+uint32 HostDisplayTransferCycles() {
+    return oled.transfer_cycles;
+}
+
+void HostDisplayReport() {
+    if (oled.on && _LAT(OL_POWER))
+        fprintf(host_report, "Display: on at %.1f ms", HostCyclesToMs(oled.on_time));
+    else
+        fprintf(host_report, "Display: off");
+
+    fprintf(host_report, ", contrast %u, %lu commands, %lu data bytes, %lu pixels written\n",
+            oled.contrast,
+            (unsigned long)oled.commands, (unsigned long)oled.bytes, (unsigned long)oled.pixels);
+}
+
+bool HostDisplayWritePPM(const char* filename) {
+    FILE* f = fopen(filename, "wb");
+    uint i;
+
+    if (f == NULL)
+        return false;
+
+    fprintf(f, "P6\n%d %d\n255\n", DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    for (i=0; i<DISPLAY_WIDTH*DISPLAY_HEIGHT; i++) {
+        uint16 c = oled.ram[i];
+        uint8 r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+        fputc((r << 3) | (r >> 2), f);
+        fputc((g << 2) | (g >> 4), f);
+        fputc((b << 3) | (b >> 2), f);
+    }
+
+    fclose(f);
+    return true;
+}
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+void ssd1351_write(BYTE c) {
+    HostCharge(BUS_WRITE_CYCLES);
+
+    if (_LAT(OL_DC) == DATA)
+        oled_data(c);
+    else
+        oled_command(c);
+}
+
+void ssd1351_writebuf(char* buf, uint size) {
+    uint i;
+    for (i=0; i<size; i++)
+        ssd1351_write(buf[i]);
+}
+
+void ssd1351_writeimgbuf(__eds__ pixel_t* buf, uint size) {
+    uint i;
+
+    _LAT(OL_DC) = DATA;
+    HostCharge((uint32)size * BUS_PIXEL_CYCLES);
+    oled.transfer_cycles += (uint32)size * BUS_PIXEL_CYCLES;
+
+    for (i=0; i<size; i++) {
+#if defined(GFX_8BPP) && defined(GFX_WIRE_ORDER)
+        oled_data(bitreverse[buf[i]]);
+#elif defined(GFX_8BPP)
+        oled_data(buf[i]);
+#elif defined(GFX_WIRE_ORDER)
+        // The bus is wired backwards, so the controller sees the bytes reversed
+        oled_data(bitreverse[(uint8)buf[i]]);
+        oled_data(bitreverse[(uint8)(buf[i] >> 8)]);
+#else
+        oled_data((uint8)(buf[i] >> 8));
+        oled_data((uint8)buf[i]);
+#endif
+    }
+}
+
+char ssd1351_read() {
+    HostCharge(BUS_WRITE_CYCLES);
+
+    // Only used to read back the master contrast (see ssd1351_Test)
+    return oled.contrast;
+}
+
+void ssd1351_command(uint8 cmd) {
+    _LAT(OL_DC) = COMMAND;
+    ssd1351_write(cmd);
+}
+
+void ssd1351_data(uint8 data) {
+    _LAT(OL_DC) = DATA;
+    ssd1351_write(data);
+}
+
+void ssd1351_send(uint8 cmd, uint8 data) {
+    ssd1351_command(cmd);
+    ssd1351_data(data);
+}
+
+void ssd1351_sendv(uint8 cmd, uint8 count, ...) {
+    va_list ap;
+    uint i;
+
+    va_start(ap, count);
+    ssd1351_command(cmd);
+    for (i=0; i<count; i++)
+        ssd1351_data(va_arg(ap, int));
+    va_end(ap);
+}
+
+void ssd1351_sendbuf(uint8 cmd, uint8* buf, uint8 len) {
+    uint i;
+
+    ssd1351_command(cmd);
+    for (i=0; i<len; i++)
+        ssd1351_data(buf[i]);
+}
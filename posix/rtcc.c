@@ -0,0 +1,121 @@
+/*
+ * File:   rtcc.c
+ * Author: Jared
+ *
+ * Host stand-in for the RTCC peripheral library (see include/Rtcc.h).
+ * The clock counts virtual time from the date it was last set to.
+ */
+
+////////// Includes ////////////////////////////////////////////////////////////
+
+#include <Rtcc.h>
+#include "posix/host.h"
+#include "util/util.h"
+
+////////// Variables ///////////////////////////////////////////////////////////
+
+// Date and time when the clock was last written
+static uint8 set_year = 14, set_mon = 1, set_mday = 1, set_wday = 3;
+static uint32 set_seconds = 0;      // Seconds into the day
+static host_time_t set_time = 0;    // Virtual time it was written
+
+static const uint8 month_days[] = {0,31,28,31,30,31,30,31,31,30,31,30,31};
+
+////////// Methods /////////////////////////////////////////////////////////////
+
+// Current date/time as binary values
+static void rtcc_now(uint8* year, uint8* mon, uint8* mday, uint8* wday, uint32* seconds) {
+    uint32 elapsed = (HostTime() - set_time) / FCY;
+    uint32 days = (set_seconds + elapsed) / 86400;
+
+    *seconds = (set_seconds + elapsed) % 86400;
+    *year = set_year;
+    *mon = set_mon;
+    *mday = set_mday;
+    *wday = (set_wday + days) % 7;
+
+    while (days--) {
+        uint8 len = month_days[*mon] + ((*mon == 2 && (*year % 4) == 0) ? 1 : 0);
+        if (++*mday > len) {
+            *mday = 1;
+            if (++*mon > 12) {
+                *mon = 1;
+                *year = (*year + 1) % 100;
+            }
+        }
+    }
+}
+
+// Re-base the clock at the current virtual time
+static void rtcc_set(uint8 year, uint8 mon, uint8 mday, uint8 wday, uint32 seconds) {
+    set_year = year;
+    set_mon = mon;
+    set_mday = mday;
+    set_wday = wday;
+    set_seconds = seconds;
+    set_time = HostTime() - (HostTime() % FCY);
+}
+
+void RtccReadTime(rtccTime* pTm) {
+    uint8 year, mon, mday, wday;
+    uint32 seconds;
+    rtcc_now(&year, &mon, &mday, &wday, &seconds);
+
+    pTm->l = 0;
+    pTm->f.hour = int2bcd(seconds / 3600);
+    pTm->f.min = int2bcd((seconds / 60) % 60);
+    pTm->f.sec = int2bcd(seconds % 60);
+}
+
+void RtccReadDate(rtccDate* pDt) {
+    uint8 year, mon, mday, wday;
+    uint32 seconds;
+    rtcc_now(&year, &mon, &mday, &wday, &seconds);
+
+    pDt->f.wday = int2bcd(wday);
+    pDt->f.mday = int2bcd(mday);
+    pDt->f.mon = int2bcd(mon);
+    pDt->f.year = int2bcd(year);
+}
+
+void RtccReadTimeDate(rtccTimeDate* pTD) {
+    rtccTime tm;
+    rtccDate dt;
+    RtccReadTime(&tm);
+    RtccReadDate(&dt);
+
+    pTD->l[0] = pTD->l[1] = 0;
+    pTD->f.year = dt.f.year;
+    pTD->f.mday = dt.f.mday;
+    pTD->f.mon = dt.f.mon;
+    pTD->f.wday = dt.f.wday;
+    pTD->f.hour = tm.f.hour;
+    pTD->f.min = tm.f.min;
+    pTD->f.sec = tm.f.sec;
+}
+
+BOOL RtccWriteTime(const rtccTime* pTm, BOOL di) {
+    uint8 year, mon, mday, wday;
+    uint32 seconds;
+    uint8 hour = bcd2int(pTm->f.hour), min = bcd2int(pTm->f.min), sec = bcd2int(pTm->f.sec);
+
+    if (hour > 23 || min > 59 || sec > 59)
+        return FALSE;
+
+    rtcc_now(&year, &mon, &mday, &wday, &seconds);
+    rtcc_set(year, mon, mday, wday, hour * 3600UL + min * 60 + sec);
+    return TRUE;
+}
+
+BOOL RtccWriteDate(const rtccDate* pDt, BOOL di) {
+    uint8 year, mon, mday, wday;
+    uint32 seconds;
+    uint8 new_mon = bcd2int(pDt->f.mon), new_mday = bcd2int(pDt->f.mday);
+
+    if (new_mon < 1 || new_mon > 12 || new_mday < 1 || new_mday > 31 || bcd2int(pDt->f.wday) > 6)
+        return FALSE;
+
+    rtcc_now(&year, &mon, &mday, &wday, &seconds);
+    rtcc_set(bcd2int(pDt->f.year), new_mon, new_mday, bcd2int(pDt->f.wday), seconds);
+    return TRUE;
+}
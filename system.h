@@ -32,6 +32,30 @@ typedef unsigned int uint32;
 #define PROGMEM
 #define INLINE
 
+#elif defined(POSIX)
+
+// Linux host build (see posix/)
+#include <stdint.h>
+#include <stddef.h>
+
+typedef unsigned short uint;
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef int8_t int8;
+typedef int16_t int16;
+typedef int32_t int32;
+typedef uint8_t byte;
+
+#define bool uint8
+#define true 1
+#define false 0
+
+#define PROGMEM
+#define INLINE inline
+
+#include "posix/p24_host.h"
+
 #else
 
 #include <p24Fxxxx.h>
@@ -69,8 +93,14 @@ typedef UINT8 byte;
 // Generic function pointer
 typedef void (*proc_t)(void);
 
+#ifdef POSIX
+// Interrupts are dispatched by the host port (see posix/kernel_port.c)
+#define isr
+#define shadow_isr
+#else
 #define isr __attribute__((interrupt, auto_psv))
 #define shadow_isr __attribute__((interrupt, shadow, auto_psv))
+#endif
 
 #endif	/* SYSTEM_H */
 
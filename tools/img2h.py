@@ -1,16 +1,39 @@
 
 import sys
 import os.path
-from PIL import Image
+import re
 
 IMG_FILENAME = 'fluffy.jpg'
 SIZE = (128,128)
 
 SAVE_OUTPUT_IMAGE = False
 
-
-if len(sys.argv) >= 2:
-    IMG_FILENAME = ' '.join(sys.argv[1:])
+# Options:
+#   -n          Keep the image's own size (icons, clock digits) instead of filling the screen
+#   -r          Run-length encode the image (IMAGE_RLE, see api/graphics/img.c)
+#   -k 0xNNNN   Transparent colour (RGB565) for -r, skipped when drawing.
+#               Transparent pixels in images with alpha are always skipped.
+#
+# The input can also be a raw header previously generated by this script, to re-encode it.
+
+NATIVE_SIZE = False
+RLE = False
+KEY = None
+
+args = sys.argv[1:]
+while args and args[0].startswith('-'):
+    opt = args.pop(0)
+    if opt == '-n':
+        NATIVE_SIZE = True
+    elif opt == '-r':
+        RLE = True
+    elif opt == '-k':
+        KEY = int(args.pop(0), 0)
+    else:
+        sys.exit("Unknown option " + opt)
+
+if len(args) >= 1:
+    IMG_FILENAME = ' '.join(args)
 
 (IMG_PATH, IMG_FNAME) = os.path.split(IMG_FILENAME)
 IMG_NAME = os.path.splitext(IMG_FNAME)[0]
@@ -19,99 +42,141 @@ H_FILENAME = os.path.join(IMG_PATH, IMG_NAME + '.h')
 DISP_WIDTH = SIZE[0]
 DISP_HEIGHT = SIZE[1]
 
-########## Resize/crop ##########
-im = Image.open(IMG_FILENAME)
-
-im_width = im.size[0]
-im_height = im.size[1]
-im_ratio = float(im_width) / float(im_height)
+TRANSPARENT = -1
 
-#print im_ratio
+# 65K color (5:6:5) format (16 bits, 2 bytes per pixel)
+# R4 R3 R2 R1 R0 G5 G4 G3 G2 G1 G0 B4 B3 B2 B1 B0
 
-# Portrait
-if 1.0 > im_ratio:
-    im_height = int(DISP_HEIGHT/im_ratio)
-    im = im.resize((DISP_WIDTH, im_height), Image.ANTIALIAS)
-    im = im.crop((0, im_height/2 - DISP_HEIGHT/2, DISP_WIDTH, im_height/2 + DISP_HEIGHT/2))
+def rgb565(p):
+    if len(p) == 4 and p[3] < 128:
+        return TRANSPARENT
+    return (p[0]*32//256) << 11 | (p[1]*64//256) << 5 | (p[2]*32//256)
 
-# Landscape
-elif 1.0 < im_ratio:
-    im_width = int(DISP_WIDTH*im_ratio)
-    im = im.resize((im_width, DISP_HEIGHT), Image.ANTIALIAS)
-    im = im.crop((im_width/2 - DISP_WIDTH/2, 0, im_width/2 + DISP_WIDTH/2, DISP_HEIGHT))
+if IMG_FILENAME.endswith('.h'):
+    ########## Read Raw Header ##########
+    src = open(IMG_FILENAME).read()
+    DISP_WIDTH = int(re.search(r'_WIDTH\s+(\d+)', src).group(1))
+    DISP_HEIGHT = int(re.search(r'_HEIGHT\s+(\d+)', src).group(1))
+    body = src[src.index('{')+1:src.index('}')]
+    pixels = [int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+', body)][:DISP_WIDTH*DISP_HEIGHT]
 
-# Square
 else:
-    im = im.resize((DISP_WIDTH, DISP_HEIGHT), Image.ANTIALIAS)
+    from PIL import Image
+    ANTIALIAS = getattr(Image, 'LANCZOS', None) or Image.ANTIALIAS
 
+    ########## Resize/crop ##########
+    im = Image.open(IMG_FILENAME)
+    im = im.convert('RGBA' if 'A' in im.getbands() or 'transparency' in im.info else 'RGB')
 
-if SAVE_OUTPUT_IMAGE:
-    im.save('out.png')
+    im_width = im.size[0]
+    im_height = im.size[1]
+    im_ratio = float(im_width) / float(im_height)
 
-########## Extract Raw Pixels ##########
+    #print im_ratio
 
-pixels = []
-for y in range(DISP_HEIGHT):
-    for x in range(DISP_WIDTH):
-        pixels.append(im.getpixel((x,y)))
+    if NATIVE_SIZE:
+        DISP_WIDTH = im_width
+        DISP_HEIGHT = im_height
 
-########## Pack Pixels ##########
+    # Portrait
+    elif 1.0 > im_ratio:
+        im_height = int(DISP_HEIGHT/im_ratio)
+        im = im.resize((DISP_WIDTH, im_height), ANTIALIAS)
+        im = im.crop((0, im_height//2 - DISP_HEIGHT//2, DISP_WIDTH, im_height//2 + DISP_HEIGHT//2))
 
-# Assuming RGB layout
+    # Landscape
+    elif 1.0 < im_ratio:
+        im_width = int(DISP_WIDTH*im_ratio)
+        im = im.resize((im_width, DISP_HEIGHT), ANTIALIAS)
+        im = im.crop((im_width//2 - DISP_WIDTH//2, 0, im_width//2 + DISP_WIDTH//2, DISP_HEIGHT))
 
-# 262K color (6:6:6) format (18 bits, 3 bytes per pixel)
-# R5 R4 R3 R2 R1 R0, G5 G4 G3 G2 G1 G0, B5 B4 B3 B2 B1
+    # Square
+    else:
+        im = im.resize((DISP_WIDTH, DISP_HEIGHT), ANTIALIAS)
 
-# pixels = ["0x%.2x,0x%.2x,0x%.2x" % (
-#     p[0]*64/256,
-#     p[1]*64/256,
-#     p[2]*64/256
-# ) for p in pixels]
-# dataformat = 'const uint8 __attribute__((space(prog)))'
-# byte_multiplier = 3
 
-# 65K color (5:6:5) format (16 bits, 2 bytes per pixel)
-# R4 R3 R2 R1 R0 G5 G4 G3 G2 G1 G0 B4 B3 B2 B1 B0
+    if SAVE_OUTPUT_IMAGE:
+        im.save('out.png')
+
+    ########## Extract Raw Pixels ##########
+
+    pixels = []
+    for y in range(DISP_HEIGHT):
+        for x in range(DISP_WIDTH):
+            pixels.append(rgb565(im.getpixel((x,y))))
+
+if KEY is not None:
+    pixels = [TRANSPARENT if p == KEY else p for p in pixels]
+
+if not RLE:
+    # Nothing can be transparent in a raw image
+    pixels = [(KEY or 0) if p == TRANSPARENT else p for p in pixels]
 
-pixels = ["0x%.4x" % (
-    (p[0]*32/256) << 11 | (p[1]*64/256) << 5 | (p[2]*32/256)
-) for p in pixels]
-#dataformat = 'const uint16 __attribute__((space(prog)))'
-dataformat = 'uint16 PROGMEM'
-byte_multiplier = 2
+########## Run-Length Encode ##########
 
-# 256 color (3:3:2) format (8 bits, 1 byte per pixel)
-# NOTE: Not directly supported by the SD1351 driver!
-# Have to implement additional code to expand the bytes to one of the above formats (probably 6:6:6)
+# Packets never cross rows. The header word has the type in the top 2 bits
+# and the number of pixels in the rest (see api/graphics/img.c).
+RLE_SKIP = 0x0000   # Transparent pixels
+RLE_FILL = 0x4000   # Pixels of the colour in the next word
+RLE_COPY = 0x8000   # Pixels that follow
+RLE_MIN_FILL = 3    # Shorter runs are cheaper as part of a copy
 
-# pixels = ["0x%.2x" % (
-#     (p[0]*8/256) << 5 | (p[1]*8/256) << 2 | (p[2]*4/256)
-# ) for p in pixels]
-# dataformat = 'const uint8 __attribute__((space(prog)))'
-# byte_multiplier = 1
+def run_length(row, i):
+    n = 1
+    while i + n < len(row) and row[i + n] == row[i]:
+        n += 1
+    return n
 
+def encode_row(row):
+    words = []
+    literal = []
+
+    def flush():
+        if literal:
+            words.append(RLE_COPY | len(literal))
+            words.extend(literal)
+            del literal[:]
+
+    i = 0
+    while i < len(row):
+        n = run_length(row, i)
+        if row[i] == TRANSPARENT:
+            flush()
+            words.append(RLE_SKIP | n)
+        elif n >= RLE_MIN_FILL:
+            flush()
+            words.extend([RLE_FILL | n, row[i]])
+        else:
+            literal.extend(row[i:i+n])
+        i += n
+    flush()
+    return words
 
 ########## Generate Header ##########
 
-size = DISP_WIDTH*DISP_HEIGHT*byte_multiplier
+if RLE:
+    rows = [encode_row(pixels[y*DISP_WIDTH:(y+1)*DISP_WIDTH]) for y in range(DISP_HEIGHT)]
+    words = sum(len(r) for r in rows)
+    print("%s: %d bytes raw, %d bytes encoded" % (IMG_NAME, DISP_WIDTH*DISP_HEIGHT*2, words*2))
+else:
+    rows = [pixels[y*DISP_WIDTH:(y+1)*DISP_WIDTH] for y in range(DISP_HEIGHT)]
+    words = DISP_WIDTH*DISP_HEIGHT
+
+dataformat = 'uint16 __eds__'
+attr = '__attribute__((space(prog)))'
 
 f = open(H_FILENAME, 'w')
 f.write("#define %s_WIDTH\t%d\n" % (IMG_NAME.upper(), DISP_WIDTH))
 f.write("#define %s_HEIGHT\t%d\n" % (IMG_NAME.upper(), DISP_HEIGHT))
-f.write("#define {0}_SIZE\t({0}_WIDTH * {0}_HEIGHT * {1})".format(IMG_NAME.upper(), byte_multiplier))
-f.write("\n")
-f.write("%s %s_bytes[%d] = {\n" % (dataformat, IMG_NAME, size))
+f.write("#define %s_SIZE\t%d\n" % (IMG_NAME.upper(), words*2))
+f.write("%s %s_bytes[%d] %s = {\n" % (dataformat, IMG_NAME, words, attr))
 
 try:
-    i = 0
-    for i in range(DISP_HEIGHT):
-        x = i*DISP_WIDTH
-        line = pixels[x:x+DISP_WIDTH]
-        f.write("\t" + ','.join(line) + ",\n")
-
+    for row in rows:
+        f.write("\t" + ','.join("0x%.4x" % w for w in row) + ",\n")
 
 finally:
-    f.write("};")
+    f.write("};\n")
+    f.write("const image_t img_%s = {%s_bytes, %s_WIDTH, %s_HEIGHT%s};\n" % (IMG_NAME, IMG_NAME, IMG_NAME.upper(), IMG_NAME.upper(),
+                                                                         ", IMAGE_RLE" if RLE else ""))
     f.close()
-
-
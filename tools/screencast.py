@@ -0,0 +1,341 @@
+#!/usr/bin/env python3
+"""
+Mirrors the watch's screen over USB HID with the screen capture stream
+(CMD_DISPLAY_STREAM_*, see background/capture.h), and saves it as PNGs or a video.
+
+Usage:
+    screencast.py record out.png        Keep out.png updated with the latest frame
+    screencast.py record out%04d.png    Save every frame
+    screencast.py record out.mp4        Save a video (any format ffmpeg can write)
+    screencast.py convert in.raw out    Convert a previously saved stream (see --raw),
+                                        or the -o file from the host build (posix/)
+
+Options:
+    --device /dev/hidrawN               HID device (default: first one matching VID/PID)
+    --raw file.raw                      Also save the received packets
+    --interval ms                       Minimum time between frames (default 100)
+    --seconds n                         Stop recording after n seconds (default: Ctrl-C)
+    --fps n                             Video frame rate (default 10)
+    --scale n                           Scale the output up by n (default 1)
+"""
+
+import sys
+import os
+import glob
+import select
+import struct
+import subprocess
+import time
+
+VID = 0x04D8
+PID = 0x003F
+PACKET_SIZE = 64
+
+# comms.h
+CMD_DISPLAY_STREAM_START = 0x26
+CMD_DISPLAY_STREAM_STOP = 0x27
+CMD_DISPLAY_STREAM_DATA = 0x28
+STREAM_FRAME_START = 0x80
+
+# capture.h
+CAPTURE_KEYFRAME = 0x01
+
+WIDTH = 128
+HEIGHT = 128
+
+
+########## USB HID ##########
+
+def find_device():
+    # /sys/class/hidraw/hidrawN/device/uevent contains HID_ID=0003:000004D8:0000003F
+    hid_id = '%08X:%08X' % (VID, PID)
+    for path in sorted(glob.glob('/sys/class/hidraw/hidraw*')):
+        try:
+            with open(os.path.join(path, 'device', 'uevent')) as f:
+                if hid_id in f.read().upper():
+                    return os.path.join('/dev', os.path.basename(path))
+        except IOError:
+            pass
+    raise IOError('Watch not found (VID=%04X PID=%04X)' % (VID, PID))
+
+
+class Device(object):
+    def __init__(self, path):
+        self.fd = os.open(path, os.O_RDWR)
+
+    def close(self):
+        os.close(self.fd)
+
+    def send(self, cmd, payload=b''):
+        # The reply isn't waited for, it's mixed in with the stream packets
+        packet = bytes([cmd, 0]) + payload
+        packet += b'\x00' * (PACKET_SIZE - len(packet))
+        os.write(self.fd, b'\x00' + packet)  # Report ID 0
+
+    def read(self, timeout):
+        if not select.select([self.fd], [], [], timeout)[0]:
+            return None
+        return os.read(self.fd, PACKET_SIZE)
+
+
+########## Decoding ##########
+
+def read_u16():
+    lo = yield
+    hi = yield
+    return lo | hi << 8
+
+
+def decode_frame(pixels):
+    """Generator that's sent the frame's bytes one at a time, and returns its header"""
+    flags = yield
+    number = yield from read_u16()
+    systick = (yield from read_u16()) | (yield from read_u16()) << 16
+
+    y = 0
+    while y < HEIGHT:
+        code = yield
+        if code < 0x80:
+            y += code + 1   # Unchanged rows
+            continue
+
+        x = 0
+        row = y * WIDTH
+        while x < WIDTH:
+            code = yield
+            n = (code & 0x7F) + 1
+            if code & 0x80:
+                c = yield from read_u16()
+                pixels[row + x:row + x + n] = [c] * n
+            else:
+                for i in range(n):
+                    pixels[row + x + i] = yield from read_u16()
+            x += n
+        y += 1
+
+    return (flags, number, systick)
+
+
+def to_rgb(pixels):
+    out = bytearray(WIDTH * HEIGHT * 3)
+    for i, c in enumerate(pixels):
+        r, g, b = (c >> 11) & 0x1F, (c >> 5) & 0x3F, c & 0x1F
+        out[i * 3] = (r << 3) | (r >> 2)
+        out[i * 3 + 1] = (g << 2) | (g >> 4)
+        out[i * 3 + 2] = (b << 3) | (b >> 2)
+    return bytes(out)
+
+
+class StreamDecoder(object):
+    def __init__(self):
+        self.pixels = [0] * (WIDTH * HEIGHT)
+        self.parser = None
+        self.sequence = None
+        self.synced = False     # Until the first keyframe, and again after a lost packet
+        self.lost = 0
+
+    def packet(self, packet):
+        """Returns (systick, rgb bytes) if the packet completes a frame"""
+        if packet[0] != CMD_DISPLAY_STREAM_DATA:
+            return None
+
+        sequence = packet[1] & 0x7F
+        if self.sequence is not None and sequence != (self.sequence + 1) & 0x7F:
+            self.lost += 1
+            self.synced = False
+            self.parser = None
+        self.sequence = sequence
+
+        if packet[1] & STREAM_FRAME_START:
+            if self.parser is not None:
+                self.synced = False     # The last frame was cut short
+            self.parser = decode_frame(self.pixels)
+            next(self.parser)
+
+        if self.parser is None:
+            return None
+
+        for b in packet[2:]:
+            try:
+                self.parser.send(b)
+            except StopIteration as done:
+                (flags, number, systick) = done.value
+                self.parser = None
+                if flags & CAPTURE_KEYFRAME:
+                    self.synced = True
+                if self.synced:
+                    return (systick, to_rgb(self.pixels))
+                return None     # The rest of the packet is padding
+
+        return None
+
+
+########## Output ##########
+
+class PngWriter(object):
+    def __init__(self, filename, scale):
+        from PIL import Image
+        self.Image = Image
+        self.filename = filename
+        self.scale = scale
+        self.count = 0
+
+    def frame(self, systick, rgb):
+        im = self.Image.frombytes('RGB', (WIDTH, HEIGHT), rgb)
+        if self.scale != 1:
+            im = im.resize((WIDTH * self.scale, HEIGHT * self.scale), self.Image.NEAREST)
+
+        if '%' in self.filename:
+            im.save(self.filename % self.count)
+        else:
+            # Replace it in one go, so a viewer never sees half a file
+            tmp = self.filename + '.tmp.png'
+            im.save(tmp)
+            os.replace(tmp, self.filename)
+        self.count += 1
+
+    def close(self):
+        pass
+
+
+class VideoWriter(object):
+    def __init__(self, filename, fps, scale):
+        self.fps = fps
+        self.start = None
+        self.written = 0
+        self.last = None
+        self.ffmpeg = subprocess.Popen([
+            'ffmpeg', '-loglevel', 'error', '-y',
+            '-f', 'rawvideo', '-pix_fmt', 'rgb24', '-s', '%dx%d' % (WIDTH, HEIGHT), '-r', str(fps),
+            '-i', '-',
+            '-vf', 'scale=iw*%d:ih*%d:flags=neighbor' % (scale, scale), '-pix_fmt', 'yuv420p',
+            filename], stdin=subprocess.PIPE)
+        self.count = 0
+
+    def frame(self, systick, rgb):
+        # Frames only come when the screen changes, so repeat the last one until this one's time
+        if self.start is None:
+            self.start = systick
+        due = (systick - self.start) * self.fps // 1000
+        while self.last is not None and self.written < due:
+            self.ffmpeg.stdin.write(self.last)
+            self.written += 1
+        self.last = rgb
+        self.count += 1
+
+    def close(self):
+        if self.last is not None:
+            self.ffmpeg.stdin.write(self.last)
+        self.ffmpeg.stdin.close()
+        self.ffmpeg.wait()
+
+
+def open_writer(filename, fps, scale):
+    if filename.lower().endswith('.png'):
+        return PngWriter(filename, scale)
+    return VideoWriter(filename, fps, scale)
+
+
+########## Main ##########
+
+def record(dev, writer, raw, interval, seconds):
+    decoder = StreamDecoder()
+    end = time.time() + seconds if seconds else None
+
+    dev.send(CMD_DISPLAY_STREAM_START, struct.pack('<H', interval))
+    try:
+        while end is None or time.time() < end:
+            packet = dev.read(0.5)
+            if packet is None:
+                continue
+            if raw:
+                raw.write(packet)
+
+            lost = decoder.lost
+            frame = decoder.packet(packet)
+            if frame:
+                writer.frame(*frame)
+                sys.stdout.write('\r%d frames' % writer.count)
+                sys.stdout.flush()
+
+            # Ask for a keyframe rather than waiting for the next one
+            if decoder.lost != lost:
+                dev.send(CMD_DISPLAY_STREAM_START, struct.pack('<H', interval))
+
+    except KeyboardInterrupt:
+        pass
+    finally:
+        dev.send(CMD_DISPLAY_STREAM_STOP)
+
+    print('\n%d frames, %d packets lost' % (writer.count, decoder.lost))
+
+
+def convert(raw, writer):
+    decoder = StreamDecoder()
+    while True:
+        packet = raw.read(PACKET_SIZE)
+        if len(packet) < PACKET_SIZE:
+            break
+        frame = decoder.packet(packet)
+        if frame:
+            writer.frame(*frame)
+    print('%d frames, %d packets lost' % (writer.count, decoder.lost))
+
+
+def main(argv):
+    device = None
+    raw_file = None
+    interval = 100
+    seconds = None
+    fps = 10
+    scale = 1
+    args = []
+
+    i = 0
+    while i < len(argv):
+        if argv[i] == '--device':
+            device = argv[i + 1]
+        elif argv[i] == '--raw':
+            raw_file = argv[i + 1]
+        elif argv[i] == '--interval':
+            interval = int(argv[i + 1])
+        elif argv[i] == '--seconds':
+            seconds = float(argv[i + 1])
+        elif argv[i] == '--fps':
+            fps = int(argv[i + 1])
+        elif argv[i] == '--scale':
+            scale = int(argv[i + 1])
+        else:
+            args.append(argv[i])
+            i += 1
+            continue
+        i += 2
+
+    if len(args) < 2 or args[0] not in ('record', 'convert') or (args[0] == 'convert' and len(args) < 3):
+        print(__doc__)
+        return 1
+
+    if args[0] == 'convert':
+        writer = open_writer(args[2], fps, scale)
+        try:
+            with open(args[1], 'rb') as raw:
+                convert(raw, writer)
+        finally:
+            writer.close()
+        return 0
+
+    writer = open_writer(args[1], fps, scale)
+    raw = open(raw_file, 'wb') if raw_file else None
+    dev = Device(device or find_device())
+    try:
+        record(dev, writer, raw, interval, seconds)
+    finally:
+        dev.close()
+        writer.close()
+        if raw:
+            raw.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,259 @@
+#!/usr/bin/env python3
+"""
+Downloads the kernel trace buffer from the watch over USB HID,
+and converts it to Chrome trace JSON (open in chrome://tracing or ui.perfetto.dev)
+
+The firmware must be built with KERNEL_TRACE defined (see core/trace.h).
+
+Usage:
+    trace2json.py start                 Clear the buffer and start recording
+    trace2json.py dump [out.json]       Stop recording, download and convert the buffer
+    trace2json.py convert in.raw [out.json]
+                                        Convert a previously saved raw dump (see --raw)
+
+Options:
+    --device /dev/hidrawN               HID device (default: first one matching VID/PID)
+    --raw file.raw                      Also save the downloaded events for later conversion
+"""
+
+import sys
+import os
+import glob
+import json
+import struct
+
+VID = 0x04D8
+PID = 0x003F
+PACKET_SIZE = 64
+
+# comms.h
+CMD_GET_TASK_INFO = 0x13
+CMD_TRACE_START = 0x60
+CMD_TRACE_STOP = 0x61
+CMD_TRACE_INFO = 0x62
+CMD_TRACE_READ = 0x63
+
+ERR_OK = 0x00
+ERR_NOT_IMPLEMENTED = 0x11
+
+# trace.h
+TRACE_SWITCH = 0x01
+TRACE_ISR_ENTER = 0x02
+TRACE_ISR_EXIT = 0x03
+TRACE_DELAY = 0x04
+TRACE_WAIT = 0x05
+TRACE_SLEEP = 0x06
+TRACE_MARK = 0x10
+TRACE_BEGIN = 0x11
+TRACE_END = 0x12
+
+ISR_NAMES = {0x01: 'CN', 0x02: 'ADC'}
+MARK_NAMES = {0x01: 'Comms', 0x02: 'Draw', 0x03: 'USB transfer'}
+
+EVENT_FORMAT = '<IBBH'  # trace_event_t
+EVENT_SIZE = struct.calcsize(EVENT_FORMAT)
+EVENTS_PER_PACKET = 7
+
+ISR_TID = 100
+
+
+########## USB HID ##########
+
+def find_device():
+    # /sys/class/hidraw/hidrawN/device/uevent contains HID_ID=0003:000004D8:0000003F
+    hid_id = '%08X:%08X' % (VID, PID)
+    for path in sorted(glob.glob('/sys/class/hidraw/hidraw*')):
+        try:
+            with open(os.path.join(path, 'device', 'uevent')) as f:
+                if hid_id in f.read().upper():
+                    return os.path.join('/dev', os.path.basename(path))
+        except IOError:
+            pass
+    raise IOError('Watch not found (VID=%04X PID=%04X)' % (VID, PID))
+
+
+class Device(object):
+    def __init__(self, path):
+        self.fd = os.open(path, os.O_RDWR)
+
+    def close(self):
+        os.close(self.fd)
+
+    def command(self, cmd, payload=b''):
+        packet = bytes([cmd, 0]) + payload
+        packet += b'\x00' * (PACKET_SIZE - len(packet))
+        os.write(self.fd, b'\x00' + packet)  # Report ID 0
+
+        while True:
+            response = os.read(self.fd, PACKET_SIZE)
+            if response[0] == cmd:
+                break
+
+        if response[1] == ERR_NOT_IMPLEMENTED:
+            raise IOError('Firmware was not built with KERNEL_TRACE')
+        if response[1] != ERR_OK:
+            raise IOError('Command 0x%02X failed (error 0x%02X)' % (cmd, response[1]))
+        return response[2:]
+
+
+def get_task_names(dev, num_tasks):
+    names = []
+    for i in range(num_tasks):
+        data = dev.command(CMD_GET_TASK_INFO, struct.pack('<H', i))
+        name = data[2:9].split(b'\x00')[0].decode('ascii', 'replace')
+        names.append(name)
+    return names
+
+
+def download(dev):
+    dev.command(CMD_TRACE_STOP)
+
+    data = dev.command(CMD_TRACE_INFO)
+    (enabled, event_size, capacity, count, dropped, fcy, cycles_per_systick, num_tasks) = \
+        struct.unpack('<BBHHIIHH', data[:18])
+
+    if event_size != EVENT_SIZE:
+        raise IOError('Unexpected event size %d' % event_size)
+
+    print('%d events (%d dropped), FCY=%dHz' % (count, dropped, fcy))
+
+    events = []
+    while len(events) < count:
+        data = dev.command(CMD_TRACE_READ, struct.pack('<H', len(events)))
+        (index, n) = struct.unpack('<HH', data[:4])
+        for i in range(n):
+            offset = 4 + i * EVENT_SIZE
+            events.append(struct.unpack(EVENT_FORMAT, data[offset:offset + EVENT_SIZE]))
+
+    return {
+        'fcy': fcy,
+        'cycles_per_systick': cycles_per_systick,
+        'dropped': dropped,
+        'tasks': get_task_names(dev, num_tasks),
+        'events': events,
+    }
+
+
+########## Conversion ##########
+
+def convert(dump):
+    fcy = float(dump['fcy'])
+    tasks = dump['tasks']
+
+    def task_name(i):
+        return tasks[i] if i < len(tasks) else 'Task %d' % i
+
+    out = []
+    meta = lambda tid, name: out.append(
+        {'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': tid, 'args': {'name': name}})
+
+    for i in range(len(tasks)):
+        meta(i, task_name(i))
+    meta(ISR_TID, 'Interrupts')
+
+    # The cycle counter is 32 bits and stops in Sleep mode,
+    # so build a monotonic timeline from the deltas and sleep events.
+    last = None
+    total = 0
+
+    current = None     # Task currently running
+    switched_at = 0
+
+    for (time, type, id, arg) in dump['events']:
+        if last is None:
+            last = time
+
+        total += (time - last) & 0xFFFFFFFF
+        last = time
+        us = total * 1e6 / fcy
+
+        if type == TRACE_SLEEP:
+            slept = arg * dump['cycles_per_systick']
+            out.append({'name': 'Sleep', 'ph': 'X', 'pid': 1, 'tid': 0,
+                        'ts': us, 'dur': slept * 1e6 / fcy, 'args': {'systicks': arg}})
+            total += slept
+            continue
+
+        if type == TRACE_SWITCH:
+            if current is not None:
+                out.append({'name': task_name(current), 'ph': 'X', 'pid': 1, 'tid': current,
+                            'ts': switched_at, 'dur': us - switched_at})
+            current = id
+            switched_at = us
+
+        elif type == TRACE_ISR_ENTER or type == TRACE_ISR_EXIT:
+            out.append({'name': ISR_NAMES.get(id, 'ISR %d' % id), 'pid': 1, 'tid': ISR_TID,
+                        'ph': 'B' if type == TRACE_ISR_ENTER else 'E', 'ts': us})
+
+        elif type == TRACE_DELAY or type == TRACE_WAIT:
+            name = 'Delay' if type == TRACE_DELAY else 'Wait'
+            out.append({'name': name, 'ph': 'i', 's': 't', 'pid': 1, 'tid': id,
+                        'ts': us, 'args': {'ms': arg}})
+
+        elif type in (TRACE_MARK, TRACE_BEGIN, TRACE_END):
+            name = MARK_NAMES.get(id, 'Mark 0x%02X' % id)
+            tid = current if current is not None else ISR_TID
+            ph = {TRACE_MARK: 'i', TRACE_BEGIN: 'B', TRACE_END: 'E'}[type]
+            event = {'name': name, 'ph': ph, 'pid': 1, 'tid': tid, 'ts': us, 'args': {'value': arg}}
+            if ph == 'i':
+                event['s'] = 't'
+            out.append(event)
+
+    return {'traceEvents': out, 'displayTimeUnit': 'ms',
+            'otherData': {'fcy': dump['fcy'], 'dropped': dump['dropped']}}
+
+
+########## Main ##########
+
+def main(argv):
+    device = None
+    raw_file = None
+    args = []
+
+    i = 0
+    while i < len(argv):
+        if argv[i] == '--device':
+            device = argv[i + 1]
+            i += 1
+        elif argv[i] == '--raw':
+            raw_file = argv[i + 1]
+            i += 1
+        else:
+            args.append(argv[i])
+        i += 1
+
+    if not args:
+        print(__doc__)
+        return 1
+
+    if args[0] == 'convert':
+        with open(args[1]) as f:
+            dump = json.load(f)
+        out_file = args[2] if len(args) > 2 else os.path.splitext(args[1])[0] + '.json'
+
+    else:
+        dev = Device(device or find_device())
+        try:
+            if args[0] == 'start':
+                dev.command(CMD_TRACE_START)
+                print('Trace started')
+                return 0
+
+            dump = download(dev)
+        finally:
+            dev.close()
+
+        out_file = args[1] if len(args) > 1 else 'trace.json'
+
+        if raw_file:
+            with open(raw_file, 'w') as f:
+                json.dump(dump, f)
+
+    with open(out_file, 'w') as f:
+        json.dump(convert(dump), f)
+    print('Written to %s' % out_file)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -20,5 +20,8 @@ byte int2bcd(byte i);
 
 char* decitoa(char* buf, unsigned val);
 
+// Bits of each byte in reverse order (bitreverse.c)
+extern const uint8 bitreverse[256];
+
 #endif	/* UTIL_H */
 
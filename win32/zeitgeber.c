@@ -160,8 +160,8 @@ DLLEXPORT task_t* zGetTask(uint index) {
 	return NULL;
 }
 
-extern volatile uint systick;
-DLLEXPORT void zSetSystick(uint tick) {
+extern volatile systick_t systick;
+DLLEXPORT void zSetSystick(systick_t tick) {
 	systick = tick;
 }
 